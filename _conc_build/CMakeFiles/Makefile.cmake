@@ -0,0 +1,113 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmark/CMakeLists.txt"
+  "/root/repo/deps/3rd/usr/local/lib/cmake/jsoncpp/jsoncpp-namespaced-targets.cmake"
+  "/root/repo/deps/3rd/usr/local/lib/cmake/jsoncpp/jsoncpp-targets-release.cmake"
+  "/root/repo/deps/3rd/usr/local/lib/cmake/jsoncpp/jsoncpp-targets.cmake"
+  "/root/repo/deps/3rd/usr/local/lib/cmake/jsoncpp/jsoncppConfig.cmake"
+  "/root/repo/deps/3rd/usr/local/lib/cmake/jsoncpp/jsoncppConfigVersion.cmake"
+  "/root/repo/deps/3rd/usr/local/share/cmake/replxx/replxx-config-version.cmake"
+  "/root/repo/deps/3rd/usr/local/share/cmake/replxx/replxx-config.cmake"
+  "/root/repo/deps/3rd/usr/local/share/cmake/replxx/replxx-targets-release.cmake"
+  "/root/repo/deps/3rd/usr/local/share/cmake/replxx/replxx-targets.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/common/CMakeLists.txt"
+  "/root/repo/src/cpplings/CMakeLists.txt"
+  "/root/repo/src/obclient/CMakeLists.txt"
+  "/root/repo/src/oblsm/CMakeLists.txt"
+  "/root/repo/src/observer/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/tmp/shim/cmake/libevent/LibeventConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBISON.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFLEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/observer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/obclient/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/oblsm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cpplings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "src/observer/CMakeFiles/observer.dir/DependInfo.cmake"
+  "src/observer/CMakeFiles/observer_static.dir/DependInfo.cmake"
+  "src/obclient/CMakeFiles/obclient.dir/DependInfo.cmake"
+  "src/oblsm/CMakeFiles/oblsm.dir/DependInfo.cmake"
+  "src/oblsm/CMakeFiles/oblsm_cli.dir/DependInfo.cmake"
+  "src/oblsm/CMakeFiles/oblsm_bench.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/cas.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/condition_variable.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/lambda.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/lock.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/mutex.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/smart_pointer.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/template.dir/DependInfo.cmake"
+  "src/cpplings/CMakeFiles/stl.dir/DependInfo.cmake"
+  "tools/CMakeFiles/clog_dump.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/aggregate_hash_table_performance_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/arithmetic_operator_performance_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/bplus_tree_concurrency_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/buffer_pool_concurrency_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/buffer_pool_replacement_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/log_commit_performance_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/memtracer_performance_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/oblsm_performance_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/pax_storage_concurrency_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/record_manager_concurrency_test.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/server_concurrency_test.dir/DependInfo.cmake"
+  )
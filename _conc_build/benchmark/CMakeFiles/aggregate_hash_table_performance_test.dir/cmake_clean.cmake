@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aggregate_hash_table_performance_test.dir/aggregate_hash_table_performance_test.cpp.o"
+  "CMakeFiles/aggregate_hash_table_performance_test.dir/aggregate_hash_table_performance_test.cpp.o.d"
+  "aggregate_hash_table_performance_test"
+  "aggregate_hash_table_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aggregate_hash_table_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
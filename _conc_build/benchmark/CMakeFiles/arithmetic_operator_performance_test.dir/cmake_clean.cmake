@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetic_operator_performance_test.dir/arithmetic_operator_performance_test.cpp.o"
+  "CMakeFiles/arithmetic_operator_performance_test.dir/arithmetic_operator_performance_test.cpp.o.d"
+  "arithmetic_operator_performance_test"
+  "arithmetic_operator_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetic_operator_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
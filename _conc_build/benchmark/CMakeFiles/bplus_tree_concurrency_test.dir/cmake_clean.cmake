@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o"
+  "CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o.d"
+  "bplus_tree_concurrency_test"
+  "bplus_tree_concurrency_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bplus_tree_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/log_commit_performance_test.dir/log_commit_performance_test.cpp.o"
+  "CMakeFiles/log_commit_performance_test.dir/log_commit_performance_test.cpp.o.d"
+  "log_commit_performance_test"
+  "log_commit_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log_commit_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memtracer_performance_test.dir/memtracer_performance_test.cpp.o"
+  "CMakeFiles/memtracer_performance_test.dir/memtracer_performance_test.cpp.o.d"
+  "memtracer_performance_test"
+  "memtracer_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memtracer_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
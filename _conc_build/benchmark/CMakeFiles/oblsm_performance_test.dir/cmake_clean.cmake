@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oblsm_performance_test.dir/oblsm_performance_test.cpp.o"
+  "CMakeFiles/oblsm_performance_test.dir/oblsm_performance_test.cpp.o.d"
+  "oblsm_performance_test"
+  "oblsm_performance_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oblsm_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
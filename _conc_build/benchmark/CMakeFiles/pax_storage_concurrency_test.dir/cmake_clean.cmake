@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pax_storage_concurrency_test.dir/pax_storage_concurrency_test.cpp.o"
+  "CMakeFiles/pax_storage_concurrency_test.dir/pax_storage_concurrency_test.cpp.o.d"
+  "pax_storage_concurrency_test"
+  "pax_storage_concurrency_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pax_storage_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/record_manager_concurrency_test.dir/record_manager_concurrency_test.cpp.o"
+  "CMakeFiles/record_manager_concurrency_test.dir/record_manager_concurrency_test.cpp.o.d"
+  "record_manager_concurrency_test"
+  "record_manager_concurrency_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/record_manager_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/server_concurrency_test.dir/server_concurrency_test.cpp.o"
+  "CMakeFiles/server_concurrency_test.dir/server_concurrency_test.cpp.o.d"
+  "server_concurrency_test"
+  "server_concurrency_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/server_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
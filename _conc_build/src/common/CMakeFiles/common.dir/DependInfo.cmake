@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/conf/ini.cpp" "src/common/CMakeFiles/common.dir/conf/ini.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/conf/ini.cpp.o.d"
+  "/root/repo/src/common/io/io.cpp" "src/common/CMakeFiles/common.dir/io/io.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/io/io.cpp.o.d"
+  "/root/repo/src/common/lang/bitmap.cpp" "src/common/CMakeFiles/common.dir/lang/bitmap.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/lang/bitmap.cpp.o.d"
+  "/root/repo/src/common/lang/comparator.cpp" "src/common/CMakeFiles/common.dir/lang/comparator.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/lang/comparator.cpp.o.d"
+  "/root/repo/src/common/lang/mutex.cpp" "src/common/CMakeFiles/common.dir/lang/mutex.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/lang/mutex.cpp.o.d"
+  "/root/repo/src/common/lang/serializer.cpp" "src/common/CMakeFiles/common.dir/lang/serializer.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/lang/serializer.cpp.o.d"
+  "/root/repo/src/common/lang/string.cpp" "src/common/CMakeFiles/common.dir/lang/string.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/lang/string.cpp.o.d"
+  "/root/repo/src/common/linereader/line_reader.cpp" "src/common/CMakeFiles/common.dir/linereader/line_reader.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/linereader/line_reader.cpp.o.d"
+  "/root/repo/src/common/log/backtrace.cpp" "src/common/CMakeFiles/common.dir/log/backtrace.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/log/backtrace.cpp.o.d"
+  "/root/repo/src/common/log/log.cpp" "src/common/CMakeFiles/common.dir/log/log.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/log/log.cpp.o.d"
+  "/root/repo/src/common/math/crc.cpp" "src/common/CMakeFiles/common.dir/math/crc.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/math/crc.cpp.o.d"
+  "/root/repo/src/common/math/md5.cpp" "src/common/CMakeFiles/common.dir/math/md5.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/math/md5.cpp.o.d"
+  "/root/repo/src/common/math/random_generator.cpp" "src/common/CMakeFiles/common.dir/math/random_generator.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/math/random_generator.cpp.o.d"
+  "/root/repo/src/common/math/regex.cpp" "src/common/CMakeFiles/common.dir/math/regex.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/math/regex.cpp.o.d"
+  "/root/repo/src/common/math/simd_util.cpp" "src/common/CMakeFiles/common.dir/math/simd_util.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/math/simd_util.cpp.o.d"
+  "/root/repo/src/common/mm/mem_pool.cpp" "src/common/CMakeFiles/common.dir/mm/mem_pool.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/mm/mem_pool.cpp.o.d"
+  "/root/repo/src/common/os/os.cpp" "src/common/CMakeFiles/common.dir/os/os.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/os.cpp.o.d"
+  "/root/repo/src/common/os/path.cpp" "src/common/CMakeFiles/common.dir/os/path.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/path.cpp.o.d"
+  "/root/repo/src/common/os/pidfile.cpp" "src/common/CMakeFiles/common.dir/os/pidfile.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/pidfile.cpp.o.d"
+  "/root/repo/src/common/os/process.cpp" "src/common/CMakeFiles/common.dir/os/process.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/process.cpp.o.d"
+  "/root/repo/src/common/os/process_param.cpp" "src/common/CMakeFiles/common.dir/os/process_param.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/process_param.cpp.o.d"
+  "/root/repo/src/common/os/signal.cpp" "src/common/CMakeFiles/common.dir/os/signal.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/os/signal.cpp.o.d"
+  "/root/repo/src/common/sys/rc.cpp" "src/common/CMakeFiles/common.dir/sys/rc.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/sys/rc.cpp.o.d"
+  "/root/repo/src/common/thread/thread_pool_executor.cpp" "src/common/CMakeFiles/common.dir/thread/thread_pool_executor.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/thread/thread_pool_executor.cpp.o.d"
+  "/root/repo/src/common/thread/thread_util.cpp" "src/common/CMakeFiles/common.dir/thread/thread_util.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/thread/thread_util.cpp.o.d"
+  "/root/repo/src/common/time/datetime.cpp" "src/common/CMakeFiles/common.dir/time/datetime.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/time/datetime.cpp.o.d"
+  "/root/repo/src/common/time/timeout_info.cpp" "src/common/CMakeFiles/common.dir/time/timeout_info.cpp.o" "gcc" "src/common/CMakeFiles/common.dir/time/timeout_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
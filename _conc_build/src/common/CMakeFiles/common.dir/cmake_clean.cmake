@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "../../lib/libcommon.a"
+  "../../lib/libcommon.pdb"
+  "CMakeFiles/common.dir/conf/ini.cpp.o"
+  "CMakeFiles/common.dir/conf/ini.cpp.o.d"
+  "CMakeFiles/common.dir/io/io.cpp.o"
+  "CMakeFiles/common.dir/io/io.cpp.o.d"
+  "CMakeFiles/common.dir/lang/bitmap.cpp.o"
+  "CMakeFiles/common.dir/lang/bitmap.cpp.o.d"
+  "CMakeFiles/common.dir/lang/comparator.cpp.o"
+  "CMakeFiles/common.dir/lang/comparator.cpp.o.d"
+  "CMakeFiles/common.dir/lang/mutex.cpp.o"
+  "CMakeFiles/common.dir/lang/mutex.cpp.o.d"
+  "CMakeFiles/common.dir/lang/serializer.cpp.o"
+  "CMakeFiles/common.dir/lang/serializer.cpp.o.d"
+  "CMakeFiles/common.dir/lang/string.cpp.o"
+  "CMakeFiles/common.dir/lang/string.cpp.o.d"
+  "CMakeFiles/common.dir/linereader/line_reader.cpp.o"
+  "CMakeFiles/common.dir/linereader/line_reader.cpp.o.d"
+  "CMakeFiles/common.dir/log/backtrace.cpp.o"
+  "CMakeFiles/common.dir/log/backtrace.cpp.o.d"
+  "CMakeFiles/common.dir/log/log.cpp.o"
+  "CMakeFiles/common.dir/log/log.cpp.o.d"
+  "CMakeFiles/common.dir/math/crc.cpp.o"
+  "CMakeFiles/common.dir/math/crc.cpp.o.d"
+  "CMakeFiles/common.dir/math/md5.cpp.o"
+  "CMakeFiles/common.dir/math/md5.cpp.o.d"
+  "CMakeFiles/common.dir/math/random_generator.cpp.o"
+  "CMakeFiles/common.dir/math/random_generator.cpp.o.d"
+  "CMakeFiles/common.dir/math/regex.cpp.o"
+  "CMakeFiles/common.dir/math/regex.cpp.o.d"
+  "CMakeFiles/common.dir/math/simd_util.cpp.o"
+  "CMakeFiles/common.dir/math/simd_util.cpp.o.d"
+  "CMakeFiles/common.dir/mm/mem_pool.cpp.o"
+  "CMakeFiles/common.dir/mm/mem_pool.cpp.o.d"
+  "CMakeFiles/common.dir/os/os.cpp.o"
+  "CMakeFiles/common.dir/os/os.cpp.o.d"
+  "CMakeFiles/common.dir/os/path.cpp.o"
+  "CMakeFiles/common.dir/os/path.cpp.o.d"
+  "CMakeFiles/common.dir/os/pidfile.cpp.o"
+  "CMakeFiles/common.dir/os/pidfile.cpp.o.d"
+  "CMakeFiles/common.dir/os/process.cpp.o"
+  "CMakeFiles/common.dir/os/process.cpp.o.d"
+  "CMakeFiles/common.dir/os/process_param.cpp.o"
+  "CMakeFiles/common.dir/os/process_param.cpp.o.d"
+  "CMakeFiles/common.dir/os/signal.cpp.o"
+  "CMakeFiles/common.dir/os/signal.cpp.o.d"
+  "CMakeFiles/common.dir/sys/rc.cpp.o"
+  "CMakeFiles/common.dir/sys/rc.cpp.o.d"
+  "CMakeFiles/common.dir/thread/thread_pool_executor.cpp.o"
+  "CMakeFiles/common.dir/thread/thread_pool_executor.cpp.o.d"
+  "CMakeFiles/common.dir/thread/thread_util.cpp.o"
+  "CMakeFiles/common.dir/thread/thread_util.cpp.o.d"
+  "CMakeFiles/common.dir/time/datetime.cpp.o"
+  "CMakeFiles/common.dir/time/datetime.cpp.o.d"
+  "CMakeFiles/common.dir/time/timeout_info.cpp.o"
+  "CMakeFiles/common.dir/time/timeout_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
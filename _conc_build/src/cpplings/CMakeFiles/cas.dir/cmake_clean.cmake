@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/cas"
+  "../../bin/cpplings/cas.pdb"
+  "CMakeFiles/cas.dir/cas.cpp.o"
+  "CMakeFiles/cas.dir/cas.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/condition_variable"
+  "../../bin/cpplings/condition_variable.pdb"
+  "CMakeFiles/condition_variable.dir/condition_variable.cpp.o"
+  "CMakeFiles/condition_variable.dir/condition_variable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/condition_variable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
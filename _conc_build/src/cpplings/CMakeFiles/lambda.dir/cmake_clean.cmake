@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/lambda"
+  "../../bin/cpplings/lambda.pdb"
+  "CMakeFiles/lambda.dir/lambda.cpp.o"
+  "CMakeFiles/lambda.dir/lambda.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lambda.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/lock"
+  "../../bin/cpplings/lock.pdb"
+  "CMakeFiles/lock.dir/lock.cpp.o"
+  "CMakeFiles/lock.dir/lock.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
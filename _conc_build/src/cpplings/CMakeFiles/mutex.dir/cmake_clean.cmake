@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/mutex"
+  "../../bin/cpplings/mutex.pdb"
+  "CMakeFiles/mutex.dir/mutex.cpp.o"
+  "CMakeFiles/mutex.dir/mutex.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mutex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
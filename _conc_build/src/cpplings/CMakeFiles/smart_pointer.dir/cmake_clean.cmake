@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/smart_pointer"
+  "../../bin/cpplings/smart_pointer.pdb"
+  "CMakeFiles/smart_pointer.dir/smart_pointer.cpp.o"
+  "CMakeFiles/smart_pointer.dir/smart_pointer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smart_pointer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/stl"
+  "../../bin/cpplings/stl.pdb"
+  "CMakeFiles/stl.dir/stl.cpp.o"
+  "CMakeFiles/stl.dir/stl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/cpplings/template"
+  "../../bin/cpplings/template.pdb"
+  "CMakeFiles/template.dir/template.cpp.o"
+  "CMakeFiles/template.dir/template.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/template.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
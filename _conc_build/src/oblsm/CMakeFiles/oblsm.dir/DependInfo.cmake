@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/oblsm/compaction/ob_compaction.cpp" "src/oblsm/CMakeFiles/oblsm.dir/compaction/ob_compaction.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/compaction/ob_compaction.cpp.o.d"
+  "/root/repo/src/oblsm/compaction/ob_compaction_picker.cpp" "src/oblsm/CMakeFiles/oblsm.dir/compaction/ob_compaction_picker.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/compaction/ob_compaction_picker.cpp.o.d"
+  "/root/repo/src/oblsm/memtable/ob_memtable.cpp" "src/oblsm/CMakeFiles/oblsm.dir/memtable/ob_memtable.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/memtable/ob_memtable.cpp.o.d"
+  "/root/repo/src/oblsm/ob_lsm_impl.cpp" "src/oblsm/CMakeFiles/oblsm.dir/ob_lsm_impl.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/ob_lsm_impl.cpp.o.d"
+  "/root/repo/src/oblsm/ob_lsm_transaction.cpp" "src/oblsm/CMakeFiles/oblsm.dir/ob_lsm_transaction.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/ob_lsm_transaction.cpp.o.d"
+  "/root/repo/src/oblsm/ob_manifest.cpp" "src/oblsm/CMakeFiles/oblsm.dir/ob_manifest.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/ob_manifest.cpp.o.d"
+  "/root/repo/src/oblsm/ob_user_iterator.cpp" "src/oblsm/CMakeFiles/oblsm.dir/ob_user_iterator.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/ob_user_iterator.cpp.o.d"
+  "/root/repo/src/oblsm/table/ob_block.cpp" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_block.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_block.cpp.o.d"
+  "/root/repo/src/oblsm/table/ob_block_builder.cpp" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_block_builder.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_block_builder.cpp.o.d"
+  "/root/repo/src/oblsm/table/ob_merger.cpp" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_merger.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_merger.cpp.o.d"
+  "/root/repo/src/oblsm/table/ob_sstable.cpp" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_sstable.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_sstable.cpp.o.d"
+  "/root/repo/src/oblsm/table/ob_sstable_builder.cpp" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_sstable_builder.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/table/ob_sstable_builder.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_arena.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_arena.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_arena.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_bloomfilter.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_bloomfilter.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_bloomfilter.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_comparator.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_comparator.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_comparator.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_file_reader.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_file_reader.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_file_reader.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_file_writer.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_file_writer.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_file_writer.cpp.o.d"
+  "/root/repo/src/oblsm/util/ob_lru_cache.cpp" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_lru_cache.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/util/ob_lru_cache.cpp.o.d"
+  "/root/repo/src/oblsm/wal/ob_lsm_wal.cpp" "src/oblsm/CMakeFiles/oblsm.dir/wal/ob_lsm_wal.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm.dir/wal/ob_lsm_wal.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_conc_build/src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../lib/liboblsm.a"
+  "../../lib/liboblsm.pdb"
+  "CMakeFiles/oblsm.dir/compaction/ob_compaction.cpp.o"
+  "CMakeFiles/oblsm.dir/compaction/ob_compaction.cpp.o.d"
+  "CMakeFiles/oblsm.dir/compaction/ob_compaction_picker.cpp.o"
+  "CMakeFiles/oblsm.dir/compaction/ob_compaction_picker.cpp.o.d"
+  "CMakeFiles/oblsm.dir/memtable/ob_memtable.cpp.o"
+  "CMakeFiles/oblsm.dir/memtable/ob_memtable.cpp.o.d"
+  "CMakeFiles/oblsm.dir/ob_lsm_impl.cpp.o"
+  "CMakeFiles/oblsm.dir/ob_lsm_impl.cpp.o.d"
+  "CMakeFiles/oblsm.dir/ob_lsm_transaction.cpp.o"
+  "CMakeFiles/oblsm.dir/ob_lsm_transaction.cpp.o.d"
+  "CMakeFiles/oblsm.dir/ob_manifest.cpp.o"
+  "CMakeFiles/oblsm.dir/ob_manifest.cpp.o.d"
+  "CMakeFiles/oblsm.dir/ob_user_iterator.cpp.o"
+  "CMakeFiles/oblsm.dir/ob_user_iterator.cpp.o.d"
+  "CMakeFiles/oblsm.dir/table/ob_block.cpp.o"
+  "CMakeFiles/oblsm.dir/table/ob_block.cpp.o.d"
+  "CMakeFiles/oblsm.dir/table/ob_block_builder.cpp.o"
+  "CMakeFiles/oblsm.dir/table/ob_block_builder.cpp.o.d"
+  "CMakeFiles/oblsm.dir/table/ob_merger.cpp.o"
+  "CMakeFiles/oblsm.dir/table/ob_merger.cpp.o.d"
+  "CMakeFiles/oblsm.dir/table/ob_sstable.cpp.o"
+  "CMakeFiles/oblsm.dir/table/ob_sstable.cpp.o.d"
+  "CMakeFiles/oblsm.dir/table/ob_sstable_builder.cpp.o"
+  "CMakeFiles/oblsm.dir/table/ob_sstable_builder.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_arena.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_arena.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_bloomfilter.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_bloomfilter.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_comparator.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_comparator.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_file_reader.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_file_reader.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_file_writer.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_file_writer.cpp.o.d"
+  "CMakeFiles/oblsm.dir/util/ob_lru_cache.cpp.o"
+  "CMakeFiles/oblsm.dir/util/ob_lru_cache.cpp.o.d"
+  "CMakeFiles/oblsm.dir/wal/ob_lsm_wal.cpp.o"
+  "CMakeFiles/oblsm.dir/wal/ob_lsm_wal.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oblsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/oblsm_bench"
+  "../../bin/oblsm_bench.pdb"
+  "CMakeFiles/oblsm_bench.dir/benchmarks/ob_lsm_bench.cpp.o"
+  "CMakeFiles/oblsm_bench.dir/benchmarks/ob_lsm_bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oblsm_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
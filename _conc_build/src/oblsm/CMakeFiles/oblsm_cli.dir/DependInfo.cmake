@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/oblsm/client/cliutil/parser.cpp" "src/oblsm/CMakeFiles/oblsm_cli.dir/client/cliutil/parser.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm_cli.dir/client/cliutil/parser.cpp.o.d"
+  "/root/repo/src/oblsm/client/ob_lsm_client.cpp" "src/oblsm/CMakeFiles/oblsm_cli.dir/client/ob_lsm_client.cpp.o" "gcc" "src/oblsm/CMakeFiles/oblsm_cli.dir/client/ob_lsm_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_conc_build/src/oblsm/CMakeFiles/oblsm.dir/DependInfo.cmake"
+  "/root/repo/_conc_build/src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/oblsm_cli"
+  "../../bin/oblsm_cli.pdb"
+  "CMakeFiles/oblsm_cli.dir/client/cliutil/parser.cpp.o"
+  "CMakeFiles/oblsm_cli.dir/client/cliutil/parser.cpp.o.d"
+  "CMakeFiles/oblsm_cli.dir/client/ob_lsm_client.cpp.o"
+  "CMakeFiles/oblsm_cli.dir/client/ob_lsm_client.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oblsm_cli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
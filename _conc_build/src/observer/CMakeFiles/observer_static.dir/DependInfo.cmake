@@ -0,0 +1,204 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/observer/catalog/catalog.cpp" "src/observer/CMakeFiles/observer_static.dir/catalog/catalog.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/catalog/catalog.cpp.o.d"
+  "/root/repo/src/observer/common/global_context.cpp" "src/observer/CMakeFiles/observer_static.dir/common/global_context.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/global_context.cpp.o.d"
+  "/root/repo/src/observer/common/init.cpp" "src/observer/CMakeFiles/observer_static.dir/common/init.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/init.cpp.o.d"
+  "/root/repo/src/observer/common/type/attr_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/attr_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/attr_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/boolean_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/boolean_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/boolean_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/char_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/char_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/char_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/data_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/data_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/data_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/date_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/date_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/date_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/float_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/float_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/float_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/integer_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/integer_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/integer_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/text_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/text_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/text_type.cpp.o.d"
+  "/root/repo/src/observer/common/type/vector_type.cpp" "src/observer/CMakeFiles/observer_static.dir/common/type/vector_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/type/vector_type.cpp.o.d"
+  "/root/repo/src/observer/common/utils.cpp" "src/observer/CMakeFiles/observer_static.dir/common/utils.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/utils.cpp.o.d"
+  "/root/repo/src/observer/common/value.cpp" "src/observer/CMakeFiles/observer_static.dir/common/value.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/value.cpp.o.d"
+  "/root/repo/src/observer/event/session_event.cpp" "src/observer/CMakeFiles/observer_static.dir/event/session_event.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/session_event.cpp.o.d"
+  "/root/repo/src/observer/event/sql_debug.cpp" "src/observer/CMakeFiles/observer_static.dir/event/sql_debug.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/sql_debug.cpp.o.d"
+  "/root/repo/src/observer/event/sql_event.cpp" "src/observer/CMakeFiles/observer_static.dir/event/sql_event.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/sql_event.cpp.o.d"
+  "/root/repo/src/observer/net/buffered_writer.cpp" "src/observer/CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o.d"
+  "/root/repo/src/observer/net/cli_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/communicator.cpp.o.d"
+  "/root/repo/src/observer/net/java_thread_pool_thread_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/net/java_thread_pool_thread_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/java_thread_pool_thread_handler.cpp.o.d"
+  "/root/repo/src/observer/net/mysql_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/one_thread_per_connection_thread_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/net/one_thread_per_connection_thread_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/one_thread_per_connection_thread_handler.cpp.o.d"
+  "/root/repo/src/observer/net/plain_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/ring_buffer.cpp" "src/observer/CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o.d"
+  "/root/repo/src/observer/net/server.cpp" "src/observer/CMakeFiles/observer_static.dir/net/server.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/server.cpp.o.d"
+  "/root/repo/src/observer/net/sql_task_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/net/sql_task_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/sql_task_handler.cpp.o.d"
+  "/root/repo/src/observer/net/thread_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/net/thread_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/thread_handler.cpp.o.d"
+  "/root/repo/src/observer/session/session.cpp" "src/observer/CMakeFiles/observer_static.dir/session/session.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/session.cpp.o.d"
+  "/root/repo/src/observer/session/session_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/session/session_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/session_stage.cpp.o.d"
+  "/root/repo/src/observer/session/thread_data.cpp" "src/observer/CMakeFiles/observer_static.dir/session/thread_data.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/thread_data.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/analyze_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/command_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/create_index_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/create_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/desc_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/drop_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/drop_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/drop_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/execute_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/load_data_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/set_variable_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/set_variable_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/set_variable_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/show_buffer_pool_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_buffer_pool_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_buffer_pool_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/show_index_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_index_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_index_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/sql_result.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/aggregate_hash_table.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregate_hash_table.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregate_hash_table.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/aggregate_state.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregate_state.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregate_state.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/aggregator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/aggregator.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/composite_tuple.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/composite_tuple.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/composite_tuple.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/expression.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/expression_iterator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression_iterator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression_iterator.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/subquery_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/subquery_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/subquery_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/tuple_cell.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/aggregate_vec_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_vec_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_vec_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/delete_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/delete_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/explain_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/expr_vec_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/expr_vec_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/expr_vec_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/group_by_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/group_by_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/group_by_vec_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_vec_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/group_by_vec_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/hash_group_by_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_group_by_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_group_by_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/hash_join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/index_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/insert_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/insert_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/join_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/nested_loop_join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/nested_loop_join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/nested_loop_join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/predicate_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/predicate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/project_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/project_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/project_vec_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_vec_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_vec_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/scalar_group_by_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/scalar_group_by_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/scalar_group_by_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/table_get_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/table_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/table_scan_vec_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_vec_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_vec_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/update_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/update_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/update_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/update_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/update_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/update_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/cost_model.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/cost_model.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/cost_model.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/group.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/group.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/group.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/group_expr.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/group_expr.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/group_expr.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/implementation_rules.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/implementation_rules.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/implementation_rules.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/join_cost_calculator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/join_cost_calculator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/join_cost_calculator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/memo.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/memo.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/memo.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/optimizer.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/optimizer_context.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer_context.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer_context.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/rules.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/rules.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/rules.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/apply_rule_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/apply_rule_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/apply_rule_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/cascade_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/cascade_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/cascade_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/e_group_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/e_group_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/e_group_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/o_expr_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_expr_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_expr_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/o_group_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_group_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_group_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/cascade/tasks/o_input_task.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_input_task.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_input_task.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/comparison_simplification_rule.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/conjunction_simplification_rule.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/expression_rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/logical_plan_generator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/optimize_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/optimizer_utils.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimizer_utils.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimizer_utils.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/physical_plan_generator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/predicate_pushdown_rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/predicate_rewrite.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/predicate_to_join_rule.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_to_join_rule.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_to_join_rule.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/expression_binder.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/expression_binder.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/expression_binder.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/lex_sql.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/parse.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/parse_defs.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_defs.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_defs.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/parse_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/resolve_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/yacc_sql.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o.d"
+  "/root/repo/src/observer/sql/plan_cache/plan_cache_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/query_cache/query_cache_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/analyze_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/create_index_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/create_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/delete_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/desc_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/drop_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/drop_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/drop_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/explain_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/filter_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/insert_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/load_data_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/select_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/show_index_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/show_index_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/show_index_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/update_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/buffer_pool_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_log.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/buffer_pool_stats.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_stats.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_stats.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/buffer_pool_warmer.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_warmer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_warmer.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/disk_buffer_pool.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/double_write_buffer.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/double_write_buffer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/double_write_buffer.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/frame.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/frame_arena.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame_arena.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame_arena.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/frame_replacer.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame_replacer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame_replacer.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/page_cleaner.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_cleaner.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_cleaner.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/page_read_ahead.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_read_ahead.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_read_ahead.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/page_type.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_type.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/page_type.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/disk_log_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/disk_log_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/disk_log_handler.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/integrated_log_replayer.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/integrated_log_replayer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/integrated_log_replayer.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/log_buffer.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_buffer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_buffer.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/log_entry.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_entry.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_entry.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/log_file.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_file.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_file.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/log_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/log_handler.cpp.o.d"
+  "/root/repo/src/observer/storage/common/chunk.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/chunk.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/chunk.cpp.o.d"
+  "/root/repo/src/observer/storage/common/codec.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/codec.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/codec.cpp.o.d"
+  "/root/repo/src/observer/storage/common/column.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/column.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/column.cpp.o.d"
+  "/root/repo/src/observer/storage/common/condition_filter.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o.d"
+  "/root/repo/src/observer/storage/common/meta_util.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o.d"
+  "/root/repo/src/observer/storage/db/db.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/db/db.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/db/db.cpp.o.d"
+  "/root/repo/src/observer/storage/default/default_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o.d"
+  "/root/repo/src/observer/storage/field/field.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/field/field.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/field/field.cpp.o.d"
+  "/root/repo/src/observer/storage/field/field_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree_index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_log.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree_log_entry.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_log_entry.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_log_entry.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/index/latch_memo.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/latch_memo.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/latch_memo.cpp.o.d"
+  "/root/repo/src/observer/storage/persist/persist.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o.d"
+  "/root/repo/src/observer/storage/record/heap_record_scanner.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/heap_record_scanner.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/heap_record_scanner.cpp.o.d"
+  "/root/repo/src/observer/storage/record/lsm_record_scanner.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/lsm_record_scanner.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/lsm_record_scanner.cpp.o.d"
+  "/root/repo/src/observer/storage/record/record_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_log.cpp.o.d"
+  "/root/repo/src/observer/storage/record/record_manager.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o.d"
+  "/root/repo/src/observer/storage/record/record_scanner.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_scanner.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_scanner.cpp.o.d"
+  "/root/repo/src/observer/storage/table/heap_table_engine.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/heap_table_engine.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/heap_table_engine.cpp.o.d"
+  "/root/repo/src/observer/storage/table/lsm_table_engine.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/lsm_table_engine.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/lsm_table_engine.cpp.o.d"
+  "/root/repo/src/observer/storage/table/table.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/table.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/table.cpp.o.d"
+  "/root/repo/src/observer/storage/table/table_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/lsm_mvcc_trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/lsm_mvcc_trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/lsm_mvcc_trx.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/mvcc_trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/mvcc_trx_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx_log.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/vacuous_trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/src/observer/sql/parser/lex_sql.h" "/root/repo/src/observer/sql/parser/lex_sql.cpp"
+  "/root/repo/src/observer/sql/parser/yacc_sql.hpp" "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_conc_build/src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_conc_build/src/oblsm/CMakeFiles/oblsm.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,367 @@
+file(REMOVE_RECURSE
+  "../../lib/libobserver.a"
+  "../../lib/libobserver.pdb"
+  "/root/repo/src/observer/sql/parser/lex_sql.cpp"
+  "/root/repo/src/observer/sql/parser/lex_sql.h"
+  "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
+  "/root/repo/src/observer/sql/parser/yacc_sql.hpp"
+  "CMakeFiles/observer_static.dir/catalog/catalog.cpp.o"
+  "CMakeFiles/observer_static.dir/catalog/catalog.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/global_context.cpp.o"
+  "CMakeFiles/observer_static.dir/common/global_context.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/init.cpp.o"
+  "CMakeFiles/observer_static.dir/common/init.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/attr_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/attr_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/boolean_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/boolean_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/char_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/char_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/data_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/data_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/date_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/date_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/float_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/float_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/integer_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/integer_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/text_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/text_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/type/vector_type.cpp.o"
+  "CMakeFiles/observer_static.dir/common/type/vector_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/utils.cpp.o"
+  "CMakeFiles/observer_static.dir/common/utils.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/value.cpp.o"
+  "CMakeFiles/observer_static.dir/common/value.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/session_event.cpp.o"
+  "CMakeFiles/observer_static.dir/event/session_event.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/sql_debug.cpp.o"
+  "CMakeFiles/observer_static.dir/event/sql_debug.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/sql_event.cpp.o"
+  "CMakeFiles/observer_static.dir/event/sql_event.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o"
+  "CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/java_thread_pool_thread_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/net/java_thread_pool_thread_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/one_thread_per_connection_thread_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/net/one_thread_per_connection_thread_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o"
+  "CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/server.cpp.o"
+  "CMakeFiles/observer_static.dir/net/server.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/sql_task_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/net/sql_task_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/thread_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/net/thread_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/session.cpp.o"
+  "CMakeFiles/observer_static.dir/session/session.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/session_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/session/session_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/thread_data.cpp.o"
+  "CMakeFiles/observer_static.dir/session/thread_data.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/drop_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/drop_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/set_variable_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/set_variable_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/show_buffer_pool_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/show_buffer_pool_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/show_index_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/show_index_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregate_hash_table.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregate_hash_table.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregate_state.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregate_state.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/aggregator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/composite_tuple.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/composite_tuple.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/expression_iterator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/expression_iterator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/subquery_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/subquery_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_vec_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_vec_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/expr_vec_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/expr_vec_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_vec_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/group_by_vec_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_group_by_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_group_by_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/join_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/join_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/nested_loop_join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/nested_loop_join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/project_vec_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/project_vec_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/scalar_group_by_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/scalar_group_by_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_vec_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_vec_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/update_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/update_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/update_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/update_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/cost_model.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/cost_model.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/group.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/group.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/group_expr.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/group_expr.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/implementation_rules.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/implementation_rules.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/join_cost_calculator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/join_cost_calculator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/memo.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/memo.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer_context.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/optimizer_context.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/rules.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/rules.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/apply_rule_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/apply_rule_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/cascade_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/cascade_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/e_group_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/e_group_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_expr_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_expr_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_group_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_group_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_input_task.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/cascade/tasks/o_input_task.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimizer_utils.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimizer_utils.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_to_join_rule.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_to_join_rule.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/expression_binder.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/expression_binder.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_defs.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_defs.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/drop_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/drop_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/show_index_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/show_index_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_stats.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_stats.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_warmer.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/buffer_pool_warmer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/double_write_buffer.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/double_write_buffer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame_arena.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame_arena.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame_replacer.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame_replacer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_cleaner.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_cleaner.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_read_ahead.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_read_ahead.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_type.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/page_type.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/disk_log_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/disk_log_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/integrated_log_replayer.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/integrated_log_replayer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/log_buffer.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/log_buffer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/log_entry.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/log_entry.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/log_file.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/log_file.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/log_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/log_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/chunk.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/chunk.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/codec.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/codec.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/column.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/column.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/db/db.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/db/db.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/field/field.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/field/field.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_log_entry.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_log_entry.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/latch_memo.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/latch_memo.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/heap_record_scanner.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/heap_record_scanner.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/lsm_record_scanner.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/lsm_record_scanner.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/record_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/record_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/record_scanner.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/record_scanner.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/heap_table_engine.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/heap_table_engine.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/lsm_table_engine.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/lsm_table_engine.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/table.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/table.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/lsm_mvcc_trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/lsm_mvcc_trx.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/observer_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/clog_dump"
+  "../bin/clog_dump.pdb"
+  "CMakeFiles/clog_dump.dir/clog_dump.cpp.o"
+  "CMakeFiles/clog_dump.dir/clog_dump.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clog_dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
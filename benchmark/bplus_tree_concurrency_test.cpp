@@ -36,6 +36,10 @@ struct Stat
   int64_t not_exist_count      = 0;
   int64_t delete_other_count   = 0;
 
+  int64_t lookup_success_count = 0;
+  int64_t lookup_miss_count    = 0;
+  int64_t lookup_other_count   = 0;
+
   int64_t scan_success_count     = 0;
   int64_t scan_open_failed_count = 0;
   int64_t mismatch_count         = 0;
@@ -150,6 +154,21 @@ public:
     }
   }
 
+  void Lookup(uint32_t value, Stat &stat)
+  {
+    const char *key = reinterpret_cast<const char *>(&value);
+
+    list<RID> rids;
+    RC        rc = handler_.get_entry(key, sizeof(value), rids);
+    if (rc != RC::SUCCESS) {
+      stat.lookup_other_count++;
+    } else if (rids.size() != 1) {
+      stat.lookup_miss_count++;
+    } else {
+      stat.lookup_success_count++;
+    }
+  }
+
   void Scan(uint32_t begin, uint32_t end, Stat &stat)
   {
     const char *begin_key = reinterpret_cast<const char *>(&begin);
@@ -290,7 +309,84 @@ BENCHMARK_DEFINE_F(ScanBenchmark, Scan)(State &state)
   state.counters["other"]                 = Counter(stat.scan_other_count, Counter::kIsRate);
 }
 
-BENCHMARK_REGISTER_F(ScanBenchmark, Scan)->Threads(10)->Arg(4 * 10000);
+BENCHMARK_REGISTER_F(ScanBenchmark, Scan)->ThreadRange(1, 64)->Arg(4 * 10000)->UseRealTime();
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 只读的点查询
+ * @details 读者使用乐观读，不加任何latch，线程数增加时吞吐量应该接近线性增长
+ */
+class LookupBenchmark : public BenchmarkBase
+{
+public:
+  string Name() const override { return "lookup"; }
+
+  void SetUp(const State &state) override
+  {
+    if (0 != state.thread_index()) {
+      return;
+    }
+
+    BenchmarkBase::SetUp(state);
+
+    uint32_t max = GetRangeMax(state);
+    ASSERT(max > 0, "invalid argument count. %ld", state.range(0));
+    FillUp(0, max);
+  }
+};
+
+BENCHMARK_DEFINE_F(LookupBenchmark, Lookup)(State &state)
+{
+  IntegerGenerator generator(0, GetRangeMax(state) - 1);
+  Stat             stat;
+
+  for (auto _ : state) {
+    uint32_t value = static_cast<uint32_t>(generator.next());
+    Lookup(value, stat);
+  }
+
+  state.counters["success"] = Counter(stat.lookup_success_count, Counter::kIsRate);
+  state.counters["miss"]    = Counter(stat.lookup_miss_count, Counter::kIsRate);
+  state.counters["other"]   = Counter(stat.lookup_other_count, Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(LookupBenchmark, Lookup)->ThreadRange(1, 64)->Arg(4 * 10000)->UseRealTime();
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 读多写少的混合负载
+ * @details 每个线程90%的操作是点查询，其余是插入和删除，写者依然使用crabbing协议加锁
+ */
+struct ReadMostlyBenchmark : public LookupBenchmark
+{
+  string Name() const override { return "read_mostly"; }
+};
+
+BENCHMARK_DEFINE_F(ReadMostlyBenchmark, ReadMostly)(State &state)
+{
+  const uint32_t   max = GetRangeMax(state);
+  IntegerGenerator data_generator(0, max - 1);
+  IntegerGenerator operation_generator(0, 9);
+  Stat             stat;
+
+  for (auto _ : state) {
+    uint32_t value = static_cast<uint32_t>(data_generator.next());
+    switch (operation_generator.next()) {
+      case 0: Insert(value + max, stat); break;
+      case 1: Delete(value + max, stat); break;
+      default: Lookup(value, stat); break;
+    }
+  }
+
+  state.counters["lookup_success"] = Counter(stat.lookup_success_count, Counter::kIsRate);
+  state.counters["lookup_miss"]    = Counter(stat.lookup_miss_count, Counter::kIsRate);
+  state.counters["insert_success"] = Counter(stat.insert_success_count, Counter::kIsRate);
+  state.counters["delete_success"] = Counter(stat.delete_success_count, Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(ReadMostlyBenchmark, ReadMostly)->ThreadRange(1, 64)->Arg(4 * 10000)->UseRealTime();
 
 ////////////////////////////////////////////////////////////////////////////////
 
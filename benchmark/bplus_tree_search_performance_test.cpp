@@ -0,0 +1,112 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <benchmark/benchmark.h>
+
+#include "common/lang/lower_bound.h"
+#include "common/lang/vector.h"
+#include "storage/index/bplus_tree.h"
+
+/**
+ * @brief 节点内查找的性能测试
+ * @details 按照叶子节点的格式(键值、RID、RID)生成有序的数据，对比逐个使用通用比较器的二分查找
+ * 和按照键值类型选择的查找方式。参数是节点中的元素个数和键值类型。
+ */
+class BplusTreeSearchBenchmark : public benchmark::Fixture
+{
+public:
+  void SetUp(const ::benchmark::State &state) override
+  {
+    const int      size = state.range(0);
+    const AttrType type = static_cast<AttrType>(state.range(1));
+    comparator_.init(type, sizeof(int32_t));
+
+    items_.resize(static_cast<size_t>(size) * ITEM_SIZE);
+    for (int i = 0; i < size; i++) {
+      char *item = items_.data() + static_cast<size_t>(i) * ITEM_SIZE;
+      fill_key(item, type, i * 2);
+    }
+
+    // 一半查找存在的键值，一半查找不存在的键值
+    keys_.resize(static_cast<size_t>(KEY_NUM) * ITEM_SIZE);
+    for (int i = 0; i < KEY_NUM; i++) {
+      char *key = keys_.data() + static_cast<size_t>(i) * ITEM_SIZE;
+      fill_key(key, type, static_cast<int>((i * 7919L) % (size * 2 + 1)));
+    }
+  }
+
+  void TearDown(const ::benchmark::State &state) override
+  {
+    items_.clear();
+    keys_.clear();
+  }
+
+protected:
+  static void fill_key(char *item, AttrType type, int value)
+  {
+    RID rid(value, value);
+    if (type == AttrType::FLOATS) {
+      float float_value = static_cast<float>(value);
+      memcpy(item, &float_value, sizeof(float_value));
+    } else {
+      memcpy(item, &value, sizeof(value));
+    }
+    memcpy(item + sizeof(int32_t), &rid, sizeof(rid));
+    memcpy(item + sizeof(int32_t) + sizeof(RID), &rid, sizeof(rid));
+  }
+
+  const char *key_at(int i) const { return keys_.data() + static_cast<size_t>(i % KEY_NUM) * ITEM_SIZE; }
+
+protected:
+  static constexpr int ITEM_SIZE = sizeof(int32_t) + 2 * sizeof(RID);
+  static constexpr int KEY_NUM   = 1024;
+
+  KeyComparator comparator_;
+  vector<char>  items_;
+  vector<char>  keys_;
+};
+
+BENCHMARK_DEFINE_F(BplusTreeSearchBenchmark, Generic)(benchmark::State &state)
+{
+  const int                    size = state.range(0);
+  common::BinaryIterator<char> iter_begin(ITEM_SIZE, items_.data());
+  common::BinaryIterator<char> iter_end(ITEM_SIZE, items_.data() + static_cast<size_t>(size) * ITEM_SIZE);
+
+  int i = 0;
+  for (auto _ : state) {
+    auto iter = common::lower_bound(iter_begin, iter_end, key_at(i++), comparator_);
+    benchmark::DoNotOptimize(iter);
+  }
+}
+
+BENCHMARK_DEFINE_F(BplusTreeSearchBenchmark, Specialized)(benchmark::State &state)
+{
+  const int size = state.range(0);
+
+  int i = 0;
+  for (auto _ : state) {
+    int index = comparator_.lower_bound(items_.data(), ITEM_SIZE, size, key_at(i++));
+    benchmark::DoNotOptimize(index);
+  }
+}
+
+static void search_arguments(benchmark::internal::Benchmark *b)
+{
+  for (AttrType type : {AttrType::INTS, AttrType::FLOATS}) {
+    for (int size : {16, 64, 400}) {
+      b->Args({size, static_cast<int64_t>(type)});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(BplusTreeSearchBenchmark, Generic)->Apply(search_arguments);
+BENCHMARK_REGISTER_F(BplusTreeSearchBenchmark, Specialized)->Apply(search_arguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,151 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <benchmark/benchmark.h>
+#include <inttypes.h>
+
+#include "common/lang/stdexcept.h"
+#include "common/log/log.h"
+#include "common/math/integer_generator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/buffer/double_write_buffer.h"
+#include "storage/clog/vacuous_log_handler.h"
+
+using namespace std;
+using namespace common;
+using namespace benchmark;
+
+/**
+ * @brief 测试多线程并发访问buffer pool页面时的性能
+ * @details 参数0是页帧管理器的分片个数，参数1是文件中的页面个数。
+ * 内存中可以放下 FRAME_NUM 个页面，页面个数超过这个值时，访问时就会有页面淘汰。
+ */
+class BufferPoolBenchmark : public Fixture
+{
+public:
+  static constexpr int FRAME_NUM = 4096;
+
+  string Name() const { return "buffer_pool_concurrency"; }
+
+  string filename() const { return this->Name() + ".bp"; }
+
+  void SetUp(const State &state) override
+  {
+    if (0 != state.thread_index()) {
+      return;
+    }
+
+    string log_name = this->Name() + ".log";
+    LoggerFactory::init_default(log_name.c_str(), LOG_LEVEL_INFO);
+
+    const int shard_num = static_cast<int>(state.range(0));
+    page_num_           = static_cast<int>(state.range(1));
+
+    bpm_ = make_unique<BufferPoolManager>(FRAME_NUM * BP_PAGE_SIZE, shard_num);
+    bpm_->init(make_unique<VacuousDoubleWriteBuffer>());
+
+    ::remove(filename().c_str());
+    RC rc = bpm_->create_file(filename().c_str());
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to create buffer pool file");
+    }
+
+    rc = bpm_->open_file(log_handler_, filename().c_str(), buffer_pool_);
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to open buffer pool file");
+    }
+
+    for (int i = 0; i < page_num_; i++) {
+      Frame *frame = nullptr;
+      rc           = buffer_pool_->allocate_page(&frame);
+      if (OB_FAIL(rc)) {
+        throw runtime_error("failed to allocate page");
+      }
+      frame->mark_dirty();
+      buffer_pool_->unpin_page(frame);
+    }
+    LOG_INFO("test %s setup done. threads=%d, shard num=%d, page num=%d",
+             this->Name().c_str(), state.threads(), shard_num, page_num_);
+  }
+
+  void TearDown(const State &state) override
+  {
+    if (0 != state.thread_index()) {
+      return;
+    }
+
+    buffer_pool_->close_file();
+    bpm_->close_file(filename().c_str());
+    buffer_pool_ = nullptr;
+    bpm_.reset();
+    ::remove(filename().c_str());
+  }
+
+  /**
+   * @brief 访问一个页面，返回是否成功
+   */
+  bool Access(PageNum page_num)
+  {
+    Frame *frame = nullptr;
+    RC     rc    = buffer_pool_->get_this_page(page_num, &frame);
+    if (OB_FAIL(rc)) {
+      return false;
+    }
+
+    frame->read_latch();
+    benchmark::DoNotOptimize(frame->data()[0]);
+    frame->read_unlatch();
+    buffer_pool_->unpin_page(frame);
+    return true;
+  }
+
+protected:
+  unique_ptr<BufferPoolManager> bpm_;
+  DiskBufferPool               *buffer_pool_ = nullptr;
+  VacuousLogHandler             log_handler_;
+  int                           page_num_ = 0;
+};
+
+BENCHMARK_DEFINE_F(BufferPoolBenchmark, GetPage)(State &state)
+{
+  // 第0个页面是文件头，不参与测试
+  IntegerGenerator generator(1, page_num_);
+
+  int64_t success_count = 0;
+  int64_t failed_count  = 0;
+  for (auto _ : state) {
+    if (Access(static_cast<PageNum>(generator.next()))) {
+      success_count++;
+    } else {
+      failed_count++;
+    }
+  }
+
+  state.counters["success"] = Counter(success_count, Counter::kIsRate);
+  state.counters["failed"]  = Counter(failed_count, Counter::kIsRate);
+}
+
+// 所有页面都在内存中，只测试页帧管理器的锁竞争
+BENCHMARK_REGISTER_F(BufferPoolBenchmark, GetPage)
+    ->ArgNames({"shards", "pages"})
+    ->ArgsProduct({{1, 16}, {BufferPoolBenchmark::FRAME_NUM / 2}})
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+// 页面个数超过页帧个数，访问时会淘汰页面
+BENCHMARK_REGISTER_F(BufferPoolBenchmark, GetPage)
+    ->ArgNames({"shards", "pages"})
+    ->ArgsProduct({{1, 16}, {BufferPoolBenchmark::FRAME_NUM * 2}})
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_MAIN();
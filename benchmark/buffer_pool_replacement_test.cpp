@@ -0,0 +1,174 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <benchmark/benchmark.h>
+#include <inttypes.h>
+
+#include "common/lang/stdexcept.h"
+#include "common/log/log.h"
+#include "common/math/integer_generator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/buffer/double_write_buffer.h"
+#include "storage/clog/vacuous_log_handler.h"
+#include "storage/index/bplus_tree.h"
+
+using namespace std;
+using namespace common;
+using namespace benchmark;
+
+/**
+ * @brief 测试不同页帧置换策略在全表扫描和索引查询混合负载下的命中率
+ * @details 参数0是置换策略(0: lru, 1: 2q, 2: clock)。
+ * 一棵B+树的所有页面可以放在内存中，另外有一个远大于内存的数据文件。
+ * 每轮测试先做若干次索引等值查询，然后顺序扫描一部分数据文件。
+ * 扫描的页面只访问一次，好的置换策略不应该因为扫描把索引页面淘汰掉。
+ */
+class BufferPoolReplacementBenchmark : public Fixture
+{
+public:
+  static constexpr int FRAME_NUM      = 1024;
+  static constexpr int KEY_NUM        = 20000;
+  static constexpr int DATA_PAGE_NUM  = FRAME_NUM * 4;
+  static constexpr int LOOKUP_PER_RUN = 100;
+  static constexpr int SCAN_PER_RUN   = 100;
+
+  string Name() const { return "buffer_pool_replacement"; }
+
+  string btree_filename() const { return this->Name() + ".btree"; }
+  string data_filename() const { return this->Name() + ".data"; }
+
+  static const char *replacer_name(int64_t index)
+  {
+    static const char *names[] = {"lru", "2q", "clock"};
+    return names[index];
+  }
+
+  void SetUp(const State &state) override
+  {
+    string log_name = this->Name() + ".log";
+    LoggerFactory::init_default(log_name.c_str(), LOG_LEVEL_INFO);
+
+    bpm_ = make_unique<BufferPoolManager>(FRAME_NUM * BP_PAGE_SIZE, 1 /*frame_shard_num*/, replacer_name(state.range(0)));
+    bpm_->init(make_unique<VacuousDoubleWriteBuffer>());
+
+    ::remove(btree_filename().c_str());
+    ::remove(data_filename().c_str());
+
+    RC rc = btree_handler_.create(log_handler_, *bpm_, btree_filename().c_str(), AttrType::INTS,
+        sizeof(int32_t) /*attr_len*/, 64 /*internal_max_size*/, 64 /*leaf_max_size*/);
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to create btree handler");
+    }
+
+    for (int32_t value = 0; value < KEY_NUM; value++) {
+      RID rid(value, value);
+      rc = btree_handler_.insert_entry(reinterpret_cast<const char *>(&value), &rid);
+      if (OB_FAIL(rc)) {
+        throw runtime_error("failed to insert entry into btree");
+      }
+    }
+
+    rc = bpm_->create_file(data_filename().c_str());
+    if (OB_SUCC(rc)) {
+      rc = bpm_->open_file(log_handler_, data_filename().c_str(), data_buffer_pool_);
+    }
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to create data file");
+    }
+
+    for (int i = 0; i < DATA_PAGE_NUM; i++) {
+      Frame *frame = nullptr;
+      rc           = data_buffer_pool_->allocate_page(&frame);
+      if (OB_FAIL(rc)) {
+        throw runtime_error("failed to allocate page");
+      }
+      frame->mark_dirty();
+      data_buffer_pool_->unpin_page(frame);
+    }
+    LOG_INFO("test %s setup done. replacer=%s", this->Name().c_str(), replacer_name(state.range(0)));
+  }
+
+  void TearDown(const State &state) override
+  {
+    btree_handler_.close();
+    data_buffer_pool_->close_file();
+    bpm_->close_file(data_filename().c_str());
+    data_buffer_pool_ = nullptr;
+    bpm_.reset();
+    ::remove(btree_filename().c_str());
+    ::remove(data_filename().c_str());
+  }
+
+  void Lookup(int32_t value)
+  {
+    list<RID> rids;
+    RC        rc = btree_handler_.get_entry(reinterpret_cast<const char *>(&value), sizeof(value), rids);
+    ASSERT(OB_SUCC(rc) && rids.size() == 1, "failed to lookup btree. key=%d, rc=%s", value, strrc(rc));
+  }
+
+  void Scan(PageNum page_num)
+  {
+    Frame *frame = nullptr;
+    RC     rc    = data_buffer_pool_->get_this_page(page_num, &frame);
+    ASSERT(OB_SUCC(rc), "failed to get page. page_num=%d, rc=%s", page_num, strrc(rc));
+
+    frame->read_latch();
+    benchmark::DoNotOptimize(frame->data()[0]);
+    frame->read_unlatch();
+    data_buffer_pool_->unpin_page(frame);
+  }
+
+protected:
+  unique_ptr<BufferPoolManager> bpm_;
+  BplusTreeHandler              btree_handler_;
+  DiskBufferPool               *data_buffer_pool_ = nullptr;
+  VacuousLogHandler             log_handler_;
+};
+
+BENCHMARK_DEFINE_F(BufferPoolReplacementBenchmark, ScanWithLookup)(State &state)
+{
+  BPFrameManager  &frame_manager = bpm_->get_frame_manager();
+  IntegerGenerator key_generator(0, KEY_NUM - 1);
+
+  int64_t lookup_hit  = 0;
+  int64_t lookup_miss = 0;
+  PageNum scan_page   = 1;  // 第0个页面是文件头
+  for (auto _ : state) {
+    const int64_t hit_before  = frame_manager.hit_count();
+    const int64_t miss_before = frame_manager.miss_count();
+    for (int i = 0; i < LOOKUP_PER_RUN; i++) {
+      Lookup(static_cast<int32_t>(key_generator.next()));
+    }
+    lookup_hit += frame_manager.hit_count() - hit_before;
+    lookup_miss += frame_manager.miss_count() - miss_before;
+
+    for (int i = 0; i < SCAN_PER_RUN; i++) {
+      Scan(scan_page);
+      scan_page = scan_page % DATA_PAGE_NUM + 1;
+    }
+  }
+
+  const int64_t total_hit  = frame_manager.hit_count();
+  const int64_t total_miss = frame_manager.miss_count();
+
+  state.counters["lookup_hit_ratio"] =
+      Counter(lookup_hit + lookup_miss == 0 ? 0 : double(lookup_hit) / (lookup_hit + lookup_miss));
+  state.counters["total_hit_ratio"] =
+      Counter(total_hit + total_miss == 0 ? 0 : double(total_hit) / (total_hit + total_miss));
+}
+
+BENCHMARK_REGISTER_F(BufferPoolReplacementBenchmark, ScanWithLookup)
+    ->ArgName("replacer")
+    ->DenseRange(0, 2)
+    ->Iterations(2000);
+
+////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_MAIN();
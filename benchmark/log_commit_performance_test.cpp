@@ -0,0 +1,118 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <benchmark/benchmark.h>
+
+#include "common/lang/filesystem.h"
+#include "common/lang/stdexcept.h"
+#include "common/log/log.h"
+#include "storage/clog/disk_log_handler.h"
+
+using namespace std;
+using namespace common;
+using namespace benchmark;
+
+/**
+ * @brief 测试事务提交时等待日志落盘的延迟
+ * @details 每次迭代模拟一次提交：追加一条日志，然后等待这条日志sync到磁盘。
+ * 参数0是日志的大小。多个线程同时提交时，刷盘线程会把它们合并到一次sync中(组提交)，
+ * 所以线程数增加时，每秒提交次数应该随之增加，而单次提交的延迟基本不变。
+ */
+class LogCommitBenchmark : public Fixture
+{
+public:
+  string Name() const { return "log_commit_performance"; }
+
+  filesystem::path directory() const { return filesystem::path(this->Name() + "_dir"); }
+
+  void SetUp(const State &state) override
+  {
+    if (0 != state.thread_index()) {
+      return;
+    }
+
+    string log_name = this->Name() + ".log";
+    LoggerFactory::init_default(log_name.c_str(), LOG_LEVEL_INFO);
+
+    filesystem::remove_all(directory());
+    filesystem::create_directories(directory());
+
+    log_handler_ = make_unique<DiskLogHandler>();
+    RC rc        = log_handler_->init(directory().c_str());
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to init log handler");
+    }
+
+    rc = log_handler_->start();
+    if (OB_FAIL(rc)) {
+      throw runtime_error("failed to start log handler");
+    }
+    LOG_INFO("test %s setup done. threads=%d, entry size=%ld", this->Name().c_str(), state.threads(), state.range(0));
+  }
+
+  void TearDown(const State &state) override
+  {
+    if (0 != state.thread_index()) {
+      return;
+    }
+
+    log_handler_->stop();
+    log_handler_->await_termination();
+    log_handler_.reset();
+    filesystem::remove_all(directory());
+  }
+
+  /**
+   * @brief 提交一次，返回是否成功
+   */
+  bool Commit(const vector<char> &data)
+  {
+    LSN lsn = 0;
+    RC  rc  = log_handler_->append(lsn, LogModule::Id::TRANSACTION, span<const char>(data));
+    if (OB_FAIL(rc)) {
+      return false;
+    }
+
+    rc = log_handler_->wait_lsn(lsn);
+    return OB_SUCC(rc);
+  }
+
+protected:
+  unique_ptr<DiskLogHandler> log_handler_;
+};
+
+BENCHMARK_DEFINE_F(LogCommitBenchmark, Commit)(State &state)
+{
+  vector<char> data(state.range(0), 'a');
+
+  int64_t success_count = 0;
+  int64_t failed_count  = 0;
+  for (auto _ : state) {
+    if (Commit(data)) {
+      success_count++;
+    } else {
+      failed_count++;
+    }
+  }
+
+  state.counters["commits"] = Counter(success_count, Counter::kIsRate);
+  state.counters["failed"]  = Counter(failed_count, Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(LogCommitBenchmark, Commit)
+    ->ArgNames({"size"})
+    ->Arg(64)
+    ->Arg(4096)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_MAIN();
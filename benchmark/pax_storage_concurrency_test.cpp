@@ -220,7 +220,7 @@ public:
     VacuousTrx          trx;
     Table               table;
     table.table_meta_.storage_format_ = StorageFormat::PAX_FORMAT;
-    HeapRecordScanner scanner(&table, *buffer_pool_, &trx, log_handler_, ReadWriteMode::READ_ONLY, &condition_filter);
+    HeapRecordScanner scanner(&table, *buffer_pool_, handler_, &trx, log_handler_, ReadWriteMode::READ_ONLY, &condition_filter);
     RC                rc = scanner.open_scan();
     if (rc != RC::SUCCESS) {
       stat.scan_open_failed_count++;
@@ -16,6 +16,7 @@ See the Mulan PSL v2 for more details. */
 #include <inttypes.h>
 #include <random>
 
+#include "common/lang/chrono.h"
 #include "common/lang/stdexcept.h"
 #include "common/log/log.h"
 #include "common/math/integer_generator.h"
@@ -78,6 +79,7 @@ public:
   virtual string Name() const = 0;
 
   string record_filename() const { return this->Name() + ".record"; }
+  string dblwr_filename() const { return this->Name() + ".dblwr"; }
 
   virtual void SetUp(const State &state)
   {
@@ -85,15 +87,23 @@ public:
       return;
     }
 
-    bpm_.init(make_unique<VacuousDoubleWriteBuffer>());
-
     string log_name        = this->Name() + ".log";
     string record_filename = this->record_filename();
     LoggerFactory::init_default(log_name.c_str(), LOG_LEVEL_INFO);
 
     ::remove(record_filename.c_str());
+    ::remove(dblwr_filename().c_str());
+
+    // 使用真实的double write buffer，这样淘汰脏页的开销会体现在插入的延迟上
+    auto dblwr_buffer = make_unique<DiskDoubleWriteBuffer>(bpm_);
+    RC   rc           = dblwr_buffer->open_file(dblwr_filename().c_str());
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to open double write buffer file. filename=%s, rc=%s", dblwr_filename().c_str(), strrc(rc));
+      throw runtime_error("failed to open double write buffer file.");
+    }
+    bpm_.init(std::move(dblwr_buffer));
 
-    RC rc = bpm_.create_file(record_filename.c_str());
+    rc = bpm_.create_file(record_filename.c_str());
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create record buffer pool file. filename=%s, rc=%s", record_filename.c_str(), strrc(rc));
       throw runtime_error("failed to create record buffer pool file.");
@@ -129,6 +139,7 @@ public:
     buffer_pool_->close_file();
     bpm_.close_file(this->record_filename().c_str());
     buffer_pool_ = nullptr;
+    ::remove(this->record_filename().c_str());
     LOG_INFO("test %s teardown done. threads=%d, thread index=%d",
         this->Name().c_str(),
         state.threads(),
@@ -206,7 +217,7 @@ public:
     TestConditionFilter condition_filter(begin, end);
     VacuousTrx          trx;
     HeapRecordScanner   scanner(
-        nullptr /*table*/, *buffer_pool_, &trx, log_handler_, ReadWriteMode::READ_ONLY, &condition_filter);
+        nullptr /*table*/, *buffer_pool_, handler_, &trx, log_handler_, ReadWriteMode::READ_ONLY, &condition_filter);
     RC rc = scanner.open_scan();
     if (rc != RC::SUCCESS) {
       stat.scan_open_failed_count++;
@@ -248,16 +259,29 @@ BENCHMARK_DEFINE_F(InsertionBenchmark, Insertion)(State &state)
   IntegerGenerator generator(1, 1 << 31);
   Stat             stat;
 
+  // 记录每次插入的耗时，淘汰页面时写double write buffer可能会让个别插入卡住很久
+  vector<int64_t> latencies;
+  latencies.reserve(state.max_iterations);
+
   RID rid;
   for (auto _ : state) {
+    auto begin = chrono::steady_clock::now();
     Insert(generator.next(), stat, rid);
+    latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin).count());
   }
 
+  sort(latencies.begin(), latencies.end());
+  auto percentile_us = [&latencies](int per_mille) {
+    return latencies.empty() ? 0 : latencies[latencies.size() * per_mille / 1000] / 1000.0;
+  };
+
   state.counters["success"] = Counter(stat.insert_success_count, Counter::kIsRate);
   state.counters["other"]   = Counter(stat.insert_other_count, Counter::kIsRate);
+  state.counters["p99_us"]  = Counter(percentile_us(990), Counter::kAvgThreads);
+  state.counters["p999_us"] = Counter(percentile_us(999), Counter::kAvgThreads);
 }
 
-BENCHMARK_REGISTER_F(InsertionBenchmark, Insertion)->Threads(10);
+BENCHMARK_REGISTER_F(InsertionBenchmark, Insertion)->Threads(1)->Threads(10);
 
 ////////////////////////////////////////////////////////////////////////////////
 
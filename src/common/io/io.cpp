@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <iostream>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -386,4 +387,68 @@ int readn(int fd, void *buf, int size)
   }
   return 0;
 }
+
+int pwriten(int fd, const void *buf, int size, int64_t offset)
+{
+  const char *tmp = (const char *)buf;
+  while (size > 0) {
+    const ssize_t ret = ::pwrite(fd, tmp, size, offset);
+    if (ret >= 0) {
+      tmp += ret;
+      size -= ret;
+      offset += ret;
+      continue;
+    }
+    const int err = errno;
+    if (EAGAIN != err && EINTR != err)
+      return err;
+  }
+  return 0;
+}
+
+int preadn(int fd, void *buf, int size, int64_t offset)
+{
+  char *tmp = (char *)buf;
+  while (size > 0) {
+    const ssize_t ret = ::pread(fd, tmp, size, offset);
+    if (ret > 0) {
+      tmp += ret;
+      size -= ret;
+      offset += ret;
+      continue;
+    }
+    if (0 == ret)
+      return -1;  // end of file
+
+    const int err = errno;
+    if (EAGAIN != err && EINTR != err)
+      return err;
+  }
+  return 0;
+}
+
+int open_file(const char *path, int flags, int mode, bool direct_io)
+{
+  if (!direct_io) {
+    return ::open(path, flags, mode);
+  }
+
+#if defined(O_DIRECT)
+  int fd = ::open(path, flags | O_DIRECT, mode);
+  if (fd >= 0 || errno != EINVAL) {
+    return fd;
+  }
+  LOG_WARN("file system does not support direct io, fall back to buffered io. path=%s", path);
+  return ::open(path, flags, mode);
+#elif defined(F_NOCACHE)
+  int fd = ::open(path, flags, mode);
+  if (fd >= 0 && fcntl(fd, F_NOCACHE, 1) != 0) {
+    LOG_WARN("failed to disable page cache, fall back to buffered io. path=%s, error=%s", path, strerror(errno));
+  }
+  return fd;
+#else
+  LOG_WARN("direct io is not supported, use buffered io. path=%s", path);
+  return ::open(path, flags, mode);
+#endif
+}
 }  // namespace common
@@ -77,4 +77,41 @@ int writen(int fd, const void *buf, int size);
  */
 int readn(int fd, void *buf, int size);
 
+/**
+ * @brief 在指定的位置一次性写入所有指定数据
+ * @details 不会修改文件的读写位置，多个线程可以同时使用同一个描述符
+ *
+ * @param fd  写入的描述符
+ * @param buf 写入的数据
+ * @param size 写入多少数据
+ * @param offset 写入的位置
+ * @return int 0 表示成功，否则返回errno
+ */
+int pwriten(int fd, const void *buf, int size, int64_t offset);
+
+/**
+ * @brief 从指定的位置一次性读取指定长度的数据
+ * @details 不会修改文件的读写位置，多个线程可以同时使用同一个描述符
+ *
+ * @param fd  读取的描述符
+ * @param buf 读取到这里
+ * @param size 读取的数据长度
+ * @param offset 读取的位置
+ * @return int 返回0表示成功。-1 表示读取到文件尾，并且没有读到size大小数据，其它表示errno
+ */
+int preadn(int fd, void *buf, int size, int64_t offset);
+
+/**
+ * @brief 打开文件，可以选择绕过操作系统的页缓存(direct IO)
+ * @details Linux 上使用 O_DIRECT，macOS 上使用 F_NOCACHE。文件系统不支持 direct IO 时，使用普通的方式打开
+ * @note 使用 direct IO 时，读写的内存地址、文件偏移和数据长度都需要按照块大小对齐
+ *
+ * @param path 文件路径
+ * @param flags open 的标识
+ * @param mode 创建文件时使用的权限
+ * @param direct_io 是否使用 direct IO
+ * @return int 文件描述符，失败返回-1
+ */
+int open_file(const char *path, int flags, int mode, bool direct_io);
+
 }  // namespace common
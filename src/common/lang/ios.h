@@ -16,3 +16,4 @@ using std::ios;
 using std::ios_base;
 using std::streamoff;
 using std::streampos;
+using std::streamsize;
@@ -47,6 +47,9 @@ public:
   BufferType       &data() { return buffer_; }
   const BufferType &data() const { return buffer_; }
 
+  /// @brief 清空已经写入的数据，保留已经分配的内存以便复用
+  void clear() { buffer_.clear(); }
+
   /// @brief 写入一个int32整数
   int write_int32(int32_t value);
   /// @brief 写入一个int64整数
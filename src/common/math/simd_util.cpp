@@ -9,6 +9,7 @@ MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
 See the Mulan PSL v2 for more details. */
 
 #include <stdint.h>
+#include <string.h>
 #include "common/math/simd_util.h"
 
 #if defined(USE_SIMD)
@@ -54,4 +55,79 @@ template void selective_load<uint32_t>(uint32_t *memory, int offset, uint32_t *v
 template void selective_load<int>(int *memory, int offset, int *vec, __m256i &inv);
 template void selective_load<float>(float *memory, int offset, float *vec, __m256i &inv);
 
+/// @brief 把表示 NULL 的值(所有位都是1)换成0
+static inline __m256i mm256_null_as_zero(__m256i vec)
+{
+  return _mm256_andnot_si256(_mm256_cmpeq_epi32(vec, _mm256_set1_epi32(-1)), vec);
+}
+
+template <typename T>
+static inline T load_null_as_zero(const char *data)
+{
+  uint32_t bits = 0;
+  memcpy(&bits, data, sizeof(bits));
+  if (bits == UINT32_MAX) {
+    bits = 0;
+  }
+  T value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+int mm256_partition_point_epi32(const char *values, int stride, int size, int key, bool upper)
+{
+  const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+  const __m256i keys    = _mm256_set1_epi32(key);
+
+  int i = 0;
+  for (; i + SIMD_WIDTH <= size; i += SIMD_WIDTH) {
+    const __m256i vec =
+        mm256_null_as_zero(_mm256_i32gather_epi32(reinterpret_cast<const int *>(values + i * stride), offsets, 1));
+    // less: key > value, not greater: !(value > key)
+    const __m256i cmp  = upper ? _mm256_cmpgt_epi32(vec, keys) : _mm256_cmpgt_epi32(keys, vec);
+    int           mask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+    mask               = upper ? mask : (~mask & 0xFF);
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  for (; i < size; i++) {
+    const int value = load_null_as_zero<int>(values + i * stride);
+    if (upper ? value > key : value >= key) {
+      break;
+    }
+  }
+  return i;
+}
+
+int mm256_partition_point_ps(const char *values, int stride, int size, float key, float epsilon, bool upper)
+{
+  const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+  const __m256  keys    = _mm256_set1_ps(key);
+  const __m256  bound   = _mm256_set1_ps(upper ? epsilon : -epsilon);
+
+  int i = 0;
+  for (; i + SIMD_WIDTH <= size; i += SIMD_WIDTH) {
+    const __m256 vec  = _mm256_castsi256_ps(
+        mm256_null_as_zero(_mm256_i32gather_epi32(reinterpret_cast<const int *>(values + i * stride), offsets, 1)));
+    const __m256 diff = _mm256_sub_ps(vec, keys);
+    // 找到第一个不满足条件的值。less: diff < -epsilon, not greater: !(diff > epsilon)
+    const __m256 cmp  = upper ? _mm256_cmp_ps(diff, bound, _CMP_GT_OQ) : _mm256_cmp_ps(diff, bound, _CMP_NLT_UQ);
+    const int    mask = _mm256_movemask_ps(cmp);
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+  for (; i < size; i++) {
+    const float value = load_null_as_zero<float>(values + i * stride);
+    const float diff = value - key;
+    if (upper ? diff > epsilon : !(diff < -epsilon)) {
+      break;
+    }
+  }
+  return i;
+}
+
 #endif
\ No newline at end of file
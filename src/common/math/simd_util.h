@@ -25,4 +25,19 @@ float mm256_sum_ps(const float *values, int size);
 /// @brief selective load 的标量实现
 template <typename V>
 void selective_load(V *memory, int offset, V *vec, __m256i &inv);
+
+/**
+ * @brief 在间隔存放的有序 int 中查找
+ * @details 第 i 个值存放在 values + i * stride 的位置，每次用 gather 取出8个值一起比较。
+ * 适合在已经缩小到几十个元素的范围内使用。
+ * 所有位都是1的值表示NULL，与 Value 的比较方式一致，按照0比较。
+ * @param upper false 时返回第一个不小于 key 的位置，true 时返回第一个大于 key 的位置
+ */
+int mm256_partition_point_epi32(const char *values, int stride, int size, int key, bool upper);
+/**
+ * @brief 在间隔存放的有序 float 中查找
+ * @details 与 compare_float 一样，两个值相差不超过 epsilon 时认为相等。NULL 的处理与整数一样
+ * @param upper false 时返回第一个不小于 key 的位置，true 时返回第一个大于 key 的位置
+ */
+int mm256_partition_point_ps(const char *values, int stride, int size, float key, float epsilon, bool upper);
 #endif
\ No newline at end of file
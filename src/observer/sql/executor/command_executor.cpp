@@ -23,6 +23,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/executor/help_executor.h"
 #include "sql/executor/load_data_executor.h"
 #include "sql/executor/set_variable_executor.h"
+#include "sql/executor/show_buffer_pool_executor.h"
 #include "sql/executor/show_tables_executor.h"
 #include "sql/executor/trx_begin_executor.h"
 #include "sql/executor/show_index_executor.h"
@@ -69,6 +70,10 @@ RC CommandExecutor::execute(SQLStageEvent *sql_event)
       ShowTablesExecutor executor;
       rc = executor.execute(sql_event);
     } break;
+    case StmtType::SHOW_BUFFER_POOL: {
+      ShowBufferPoolExecutor executor;
+      rc = executor.execute(sql_event);
+    } break;
     case StmtType::SHOW_INDEX: {
       ShowIndexExecutor executor;
       rc = executor.execute(sql_event);
@@ -0,0 +1,91 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <stdio.h>
+
+#include "sql/executor/show_buffer_pool_executor.h"
+#include "common/lang/filesystem.h"
+#include "common/log/log.h"
+#include "event/session_event.h"
+#include "event/sql_event.h"
+#include "session/session.h"
+#include "sql/operator/string_list_physical_operator.h"
+#include "sql/stmt/stmt.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/db/db.h"
+
+using namespace common;
+
+/**
+ * @brief 保留两位小数
+ */
+static string format_double(double value)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.2f", value);
+  return buf;
+}
+
+static vector<string> status_row(const string &name, const BufferPoolStatus &status)
+{
+  const int64_t access_num = status.hits + status.misses;
+  const double  hit_ratio  = access_num == 0 ? 0 : status.hits * 100.0 / access_num;
+  const double  read_avg   = status.reads == 0 ? 0 : status.read_time_ns / 1000.0 / status.reads;
+  const double  write_avg  = status.writes == 0 ? 0 : status.write_time_ns / 1000.0 / status.writes;
+
+  return {name,
+      to_string(status.resident_pages),
+      to_string(status.dirty_pages),
+      to_string(status.hits),
+      to_string(status.misses),
+      format_double(hit_ratio),
+      to_string(status.evictions),
+      to_string(status.pin_waits),
+      to_string(status.reads),
+      format_double(read_avg),
+      to_string(status.writes),
+      format_double(write_avg)};
+}
+
+RC ShowBufferPoolExecutor::execute(SQLStageEvent *sql_event)
+{
+  Stmt *stmt = sql_event->stmt();
+  ASSERT(stmt->type() == StmtType::SHOW_BUFFER_POOL,
+         "show buffer pool executor can not run this command: %d", static_cast<int>(stmt->type()));
+
+  SqlResult *sql_result = sql_event->session_event()->sql_result();
+  Db        *db         = sql_event->session_event()->session()->get_current_db();
+
+  TupleSchema tuple_schema;
+  for (const char *name : {"Buffer_pool", "Pages", "Dirty_pages", "Hits", "Misses", "Hit_ratio", "Evictions",
+           "Pin_waits", "Reads", "Read_avg_us", "Writes", "Write_avg_us"}) {
+    tuple_schema.append_cell(TupleCellSpec("", name, name));
+  }
+  sql_result->set_tuple_schema(tuple_schema);
+
+  BufferPoolManager       &bp_manager = db->buffer_pool_manager();
+  vector<BufferPoolStatus> status_list;
+  bp_manager.collect_status(status_list);
+
+  auto             oper = new StringListPhysicalOperator;
+  BufferPoolStatus total;
+  for (const BufferPoolStatus &status : status_list) {
+    vector<string> row = status_row(filesystem::path(status.file_name).filename().string(), status);
+    oper->append(row.begin(), row.end());
+    total.merge(status);
+  }
+
+  // 汇总行的名字中带上页帧总数，方便评估buffer pool的大小
+  vector<string> row = status_row("total(" + to_string(bp_manager.get_frame_manager().total_frame_num()) + " frames)", total);
+  oper->append(row.begin(), row.end());
+
+  sql_result->set_operator(unique_ptr<PhysicalOperator>(oper));
+  return RC::SUCCESS;
+}
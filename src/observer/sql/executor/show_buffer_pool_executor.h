@@ -0,0 +1,29 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/sys/rc.h"
+
+class SQLStageEvent;
+
+/**
+ * @brief 显示buffer pool统计信息的执行器
+ * @ingroup Executor
+ * @details 每个打开的buffer pool文件一行，最后一行是所有buffer pool的汇总
+ */
+class ShowBufferPoolExecutor
+{
+public:
+  ShowBufferPoolExecutor()  = default;
+  ~ShowBufferPoolExecutor() = default;
+
+  RC execute(SQLStageEvent *sql_event);
+};
@@ -76,7 +76,8 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
       }
     }
 
-    index_scanner = index_->create_scanner(left_key, left_len, left_inclusive_, right_key, right_len, right_inclusive_);
+    index_scanner = index_->create_scanner(
+        left_key, left_len, left_inclusive_, right_key, right_len, right_inclusive_, covering_);
 
     delete[] left_key;
     delete[] right_key;
@@ -86,7 +87,8 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
         left_inclusive_,
         right_value_.data(),
         right_value_.length(),
-        right_inclusive_);
+        right_inclusive_,
+        covering_);
   }
 
   if (nullptr == index_scanner) {
@@ -97,6 +99,23 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
 
   tuple_.set_schema(table_, table_->table_meta().field_metas());
 
+  if (covering_) {
+    const TableMeta &table_meta = table_->table_meta();
+    key_fields_.clear();
+    for (const string &field_name : index_->index_meta().fields()) {
+      key_fields_.push_back(table_meta.field(field_name.c_str()));
+    }
+
+    // 不在索引中的字段不会被用到，保持为0即可
+    RC rc = current_record_.new_record(table_meta.record_size());
+    if (OB_FAIL(rc)) {
+      index_scanner_->destroy();
+      index_scanner_ = nullptr;
+      return rc;
+    }
+    memset(current_record_.data(), 0, table_meta.record_size());
+  }
+
   trx_ = trx;
   return RC::SUCCESS;
 }
@@ -104,15 +123,20 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
 RC IndexScanPhysicalOperator::next()
 {
   // TODO: 需要适配 lsm-tree 引擎
-  RID rid;
-  RC  rc = RC::SUCCESS;
+  RID         rid;
+  const char *key = nullptr;
+  RC          rc  = RC::SUCCESS;
 
   bool filter_result = false;
-  while (RC::SUCCESS == (rc = index_scanner_->next_entry(&rid))) {
-    rc = table_->get_record(rid, current_record_);
-    if (OB_FAIL(rc)) {
-      LOG_TRACE("failed to get record. rid=%s, rc=%s", rid.to_string().c_str(), strrc(rc));
-      return rc;
+  while (RC::SUCCESS == (rc = covering_ ? index_scanner_->next_entry(&rid, key) : index_scanner_->next_entry(&rid))) {
+    if (covering_) {
+      fill_record(rid, key);
+    } else {
+      rc = table_->get_record(rid, current_record_);
+      if (OB_FAIL(rc)) {
+        LOG_TRACE("failed to get record. rid=%s, rc=%s", rid.to_string().c_str(), strrc(rc));
+        return rc;
+      }
     }
 
     LOG_TRACE("got a record. rid=%s", rid.to_string().c_str());
@@ -158,6 +182,17 @@ Tuple *IndexScanPhysicalOperator::current_tuple()
   return &tuple_;
 }
 
+void IndexScanPhysicalOperator::fill_record(const RID &rid, const char *key)
+{
+  char *data   = current_record_.data();
+  int   offset = 0;
+  for (const FieldMeta *field : key_fields_) {
+    memcpy(data + field->offset(), key + offset, field->len());
+    offset += field->len();
+  }
+  current_record_.set_rid(rid);
+}
+
 void IndexScanPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs)
 {
   predicates_ = std::move(exprs);
@@ -232,5 +267,9 @@ RC IndexScanPhysicalOperator::build_composite_key(
 
 string IndexScanPhysicalOperator::param() const
 {
-  return string(index_->index_meta().name()) + " ON " + table_->name();
+  string result = string(index_->index_meta().name()) + " ON " + table_->name();
+  if (covering_) {
+    result += " COVERING";
+  }
+  return result;
 }
@@ -45,8 +45,18 @@ public:
 
   void set_predicates(vector<unique_ptr<Expression>> &&exprs);
 
+  /**
+   * @brief 设置为覆盖索引扫描
+   * @details 查询用到的字段都在索引中时，直接使用索引中的键值构造记录，不再根据RID读取记录。
+   * 只有只读并且判断可见性不需要读取记录时才能使用，由物理计划生成器判断。
+   */
+  void set_covering(bool covering) { covering_ = covering; }
+  bool covering() const { return covering_; }
+
 private:
   RC filter(RowTuple &tuple, bool &result);
+  /// @brief 把索引键值中的字段放到记录中对应的位置
+  void fill_record(const RID &rid, const char *key);
   RC build_composite_key(const vector<Value> &values, char *&key, int &key_len, bool is_left_key);
 
 private:
@@ -68,4 +78,7 @@ private:
   bool          right_inclusive_ = false;
 
   vector<unique_ptr<Expression>> predicates_;
+
+  bool                      covering_ = false;
+  vector<const FieldMeta *> key_fields_;  ///< 索引键值中的字段，按照在键值中的顺序
 };
@@ -22,6 +22,12 @@ TableGetLogicalOperator::TableGetLogicalOperator(Table *table, ReadWriteMode mod
 
 void TableGetLogicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs) { predicates_ = std::move(exprs); }
 
+void TableGetLogicalOperator::set_referenced_fields(unordered_set<string> &&fields)
+{
+  referenced_fields_       = std::move(fields);
+  referenced_fields_known_ = true;
+}
+
 unique_ptr<LogicalProperty> TableGetLogicalOperator::find_log_prop(const vector<LogicalProperty *> &log_props)
 {
   int card = Catalog::get_instance().get_table_stats(table_->table_id()).row_nums;
@@ -57,6 +57,17 @@ public:
   void set_predicates(vector<unique_ptr<Expression>> &&exprs);
   auto predicates() -> vector<unique_ptr<Expression>> & { return predicates_; }
 
+  /**
+   * @brief 设置查询中用到的当前表的所有字段
+   * @details 物理计划生成器根据这些字段判断索引是否覆盖了查询，覆盖时可以只扫描索引不读取记录
+   */
+  void set_referenced_fields(unordered_set<string> &&fields);
+  /// @brief 查询中用到的当前表的字段。返回空指针表示无法确定，比如包含了无法分析的表达式
+  const unordered_set<string> *referenced_fields() const
+  {
+    return referenced_fields_known_ ? &referenced_fields_ : nullptr;
+  }
+
   // 重写：返回该算子涉及的表
   std::unordered_set<std::string> get_involved_tables() const override
   {
@@ -76,4 +87,7 @@ private:
   // 不包含复杂的表达式运算，比如加减乘除、或者conjunction expression
   // 如果有多个表达式，他们的关系都是 AND
   vector<unique_ptr<Expression>> predicates_;
+
+  unordered_set<string> referenced_fields_;
+  bool                  referenced_fields_known_ = false;
 };
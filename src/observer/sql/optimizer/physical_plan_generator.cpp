@@ -12,8 +12,10 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/12/14.
 //
 
+#include "common/lang/algorithm.h"
 #include "common/log/log.h"
 #include "sql/expr/expression.h"
+#include "sql/expr/expression_iterator.h"
 #include "session/session.h"
 #include "sql/operator/aggregate_vec_physical_operator.h"
 #include "sql/operator/calc_logical_operator.h"
@@ -45,11 +47,23 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/scalar_group_by_physical_operator.h"
 #include "sql/operator/table_scan_vec_physical_operator.h"
 #include "sql/optimizer/physical_plan_generator.h"
+#include "storage/db/db.h"
+#include "storage/trx/trx.h"
 
 using namespace std;
 
 RC PhysicalPlanGenerator::create(
     LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper, Session *session)
+{
+  ReferencedFields referenced_fields;
+  if (collect_referenced_fields(logical_operator, referenced_fields)) {
+    set_referenced_fields(logical_operator, referenced_fields);
+  }
+  return create_oper(logical_operator, oper, session);
+}
+
+RC PhysicalPlanGenerator::create_oper(
+    LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper, Session *session)
 {
   RC rc = RC::SUCCESS;
 
@@ -127,6 +141,129 @@ RC PhysicalPlanGenerator::create_vec(
   return rc;
 }
 
+bool PhysicalPlanGenerator::collect_referenced_fields(LogicalOperator &logical_operator, ReferencedFields &fields)
+{
+  for (unique_ptr<Expression> &expr : logical_operator.expressions()) {
+    if (!collect_referenced_fields(expr.get(), fields)) {
+      return false;
+    }
+  }
+
+  switch (logical_operator.type()) {
+    case LogicalOperatorType::TABLE_GET: {
+      auto &table_get_oper = static_cast<TableGetLogicalOperator &>(logical_operator);
+      for (unique_ptr<Expression> &expr : table_get_oper.predicates()) {
+        if (!collect_referenced_fields(expr.get(), fields)) {
+          return false;
+        }
+      }
+    } break;
+
+    case LogicalOperatorType::JOIN: {
+      auto &join_oper = static_cast<JoinLogicalOperator &>(logical_operator);
+      if (!collect_referenced_fields(join_oper.condition(), fields)) {
+        return false;
+      }
+    } break;
+
+    case LogicalOperatorType::GROUP_BY: {
+      auto &group_by_oper = static_cast<GroupByLogicalOperator &>(logical_operator);
+      // HAVING 中的条件使用 FilterStmt 描述，不做分析
+      if (group_by_oper.having_filter_stmt() != nullptr) {
+        return false;
+      }
+      for (unique_ptr<Expression> &expr : group_by_oper.group_by_expressions()) {
+        if (!collect_referenced_fields(expr.get(), fields)) {
+          return false;
+        }
+      }
+      for (Expression *expr : group_by_oper.aggregate_expressions()) {
+        if (!collect_referenced_fields(expr, fields)) {
+          return false;
+        }
+      }
+    } break;
+
+    case LogicalOperatorType::UPDATE:
+    case LogicalOperatorType::DELETE: {
+      // 修改数据时需要完整的记录，不会使用覆盖索引扫描
+      return false;
+    } break;
+
+    default: {
+    } break;
+  }
+
+  for (unique_ptr<LogicalOperator> &child : logical_operator.children()) {
+    if (!collect_referenced_fields(*child, fields)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PhysicalPlanGenerator::collect_referenced_fields(Expression *expr, ReferencedFields &fields)
+{
+  if (nullptr == expr) {
+    return true;
+  }
+
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      const Field &field = static_cast<FieldExpr *>(expr)->field();
+      fields[field.table()].insert(field.field_name());
+      return true;
+    } break;
+
+    case ExprType::VALUE: {
+      return true;
+    } break;
+
+    case ExprType::COMPARISON: {
+      // IN/EXISTS 也使用 COMPARISON 类型，带子查询或值列表的比较没有右边的表达式，这些都不做分析
+      auto *comparison_expr = dynamic_cast<ComparisonExpr *>(expr);
+      if (nullptr == comparison_expr || nullptr == comparison_expr->right()) {
+        return false;
+      }
+    } break;
+
+    case ExprType::CAST:
+    case ExprType::CONJUNCTION:
+    case ExprType::ARITHMETIC:
+    case ExprType::AGGREGATION:
+    case ExprType::FUNCTION: {
+    } break;
+
+    default: {
+      return false;
+    }
+  }
+
+  bool known = true;
+  ExpressionIterator::iterate_child_expr(*expr, [&known, &fields](unique_ptr<Expression> &child) {
+    known = known && collect_referenced_fields(child.get(), fields);
+    return RC::SUCCESS;
+  });
+  return known;
+}
+
+void PhysicalPlanGenerator::set_referenced_fields(LogicalOperator &logical_operator, const ReferencedFields &fields)
+{
+  if (logical_operator.type() == LogicalOperatorType::TABLE_GET) {
+    auto &table_get_oper = static_cast<TableGetLogicalOperator &>(logical_operator);
+    auto  iter           = fields.find(table_get_oper.table());
+    unordered_set<string> table_fields;
+    if (iter != fields.end()) {
+      table_fields = iter->second;
+    }
+    table_get_oper.set_referenced_fields(std::move(table_fields));
+  }
+
+  for (unique_ptr<LogicalOperator> &child : logical_operator.children()) {
+    set_referenced_fields(*child, fields);
+  }
+}
+
 RC PhysicalPlanGenerator::create_plan(
     TableGetLogicalOperator &table_get_oper, unique_ptr<PhysicalOperator> &oper, Session *session)
 {
@@ -241,6 +378,17 @@ RC PhysicalPlanGenerator::create_plan(
   Index                     *index           = table->find_index(best_index_meta->name());
   IndexScanPhysicalOperator *index_scan_oper = nullptr;
 
+  // 只读查询用到的字段都在索引中，并且判断可见性不需要读取记录时，可以直接使用索引中的键值
+  bool                         covering          = false;
+  const unordered_set<string> *referenced_fields = table_get_oper.referenced_fields();
+  if (referenced_fields != nullptr && table_get_oper.read_write_mode() == ReadWriteMode::READ_ONLY &&
+      session != nullptr && session->get_current_db() != nullptr &&
+      !session->get_current_db()->trx_kit().visibility_needs_record()) {
+    covering = all_of(referenced_fields->begin(), referenced_fields->end(), [&index_fields](const string &field) {
+      return find(index_fields.begin(), index_fields.end(), field) != index_fields.end();
+    });
+  }
+
   if (best_index_meta->field_count() > 1) {
     index_scan_oper = new IndexScanPhysicalOperator(
         table, index, table_get_oper.read_write_mode(), key_values, true, key_values, true);
@@ -253,6 +401,10 @@ RC PhysicalPlanGenerator::create_plan(
   }
 
   index_scan_oper->set_predicates(std::move(other_predicates));
+  if (covering) {
+    index_scan_oper->set_covering(true);
+    LOG_TRACE("use covering index scan. index=%s", best_index_meta->name());
+  }
   oper = unique_ptr<PhysicalOperator>(index_scan_oper);
 
   return RC::SUCCESS;
@@ -267,7 +419,7 @@ RC PhysicalPlanGenerator::create_plan(
   LogicalOperator &child_oper = *children_opers.front();
 
   unique_ptr<PhysicalOperator> child_phy_oper;
-  RC                           rc = create(child_oper, child_phy_oper, session);
+  RC                           rc = create_oper(child_oper, child_phy_oper, session);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to create child operator of predicate operator. rc=%s", strrc(rc));
     return rc;
@@ -293,7 +445,7 @@ RC PhysicalPlanGenerator::create_plan(
   if (!child_opers.empty()) {
     LogicalOperator *child_oper = child_opers.front().get();
 
-    rc = create(*child_oper, child_phy_oper, session);
+    rc = create_oper(*child_oper, child_phy_oper, session);
     if (OB_FAIL(rc)) {
       LOG_WARN("failed to create project logical operator's child physical operator. rc=%s", strrc(rc));
       return rc;
@@ -332,7 +484,7 @@ RC PhysicalPlanGenerator::create_plan(
   if (!child_opers.empty()) {
     LogicalOperator *child_oper = child_opers.front().get();
 
-    rc = create(*child_oper, child_physical_oper, session);
+    rc = create_oper(*child_oper, child_physical_oper, session);
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create physical operator. rc=%s", strrc(rc));
       return rc;
@@ -358,7 +510,7 @@ RC PhysicalPlanGenerator::create_plan(
   if (!child_opers.empty()) {
     LogicalOperator *child_oper = child_opers.front().get();
 
-    rc = create(*child_oper, child_physical_oper, session);
+    rc = create_oper(*child_oper, child_physical_oper, session);
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create physical operator. rc=%s", strrc(rc));
       return rc;
@@ -384,7 +536,7 @@ RC PhysicalPlanGenerator::create_plan(
   unique_ptr<PhysicalOperator> explain_physical_oper(new ExplainPhysicalOperator);
   for (unique_ptr<LogicalOperator> &child_oper : child_opers) {
     unique_ptr<PhysicalOperator> child_physical_oper;
-    rc = create(*child_oper, child_physical_oper, session);
+    rc = create_oper(*child_oper, child_physical_oper, session);
     if (rc != RC::SUCCESS) {
       LOG_WARN("failed to create child physical operator. rc=%s", strrc(rc));
       return rc;
@@ -417,7 +569,7 @@ RC PhysicalPlanGenerator::create_plan(
     unique_ptr<PhysicalOperator> join_physical_oper(new HashJoinPhysicalOperator(condition_copy));
     for (auto &child_oper : child_opers) {
       unique_ptr<PhysicalOperator> child_physical_oper;
-      rc = create(*child_oper, child_physical_oper, session);
+      rc = create_oper(*child_oper, child_physical_oper, session);
       if (rc != RC::SUCCESS) {
         LOG_WARN("failed to create physical child oper. rc=%s", strrc(rc));
         return rc;
@@ -438,7 +590,7 @@ RC PhysicalPlanGenerator::create_plan(
     unique_ptr<PhysicalOperator> join_physical_oper(new NestedLoopJoinPhysicalOperator(condition_copy));
     for (auto &child_oper : child_opers) {
       unique_ptr<PhysicalOperator> child_physical_oper;
-      rc = create(*child_oper, child_physical_oper, session);
+      rc = create_oper(*child_oper, child_physical_oper, session);
       if (rc != RC::SUCCESS) {
         LOG_WARN("failed to create physical child oper. rc=%s", strrc(rc));
         return rc;
@@ -509,7 +661,7 @@ RC PhysicalPlanGenerator::create_plan(
   if (logical_oper.children().size() == 1) {
     // 正常情况：有1个子操作符
     LogicalOperator &child_oper = *logical_oper.children().front();
-    rc                          = create(child_oper, child_physical_oper, session);
+    rc                          = create_oper(child_oper, child_physical_oper, session);
     if (OB_FAIL(rc)) {
       LOG_WARN("failed to create group by logical operator's child physical operator. rc=%s", strrc(rc));
       return rc;
@@ -15,6 +15,9 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "common/sys/rc.h"
+#include "common/lang/string.h"
+#include "common/lang/unordered_map.h"
+#include "common/lang/unordered_set.h"
 #include "sql/operator/logical_operator.h"
 #include "sql/operator/physical_operator.h"
 
@@ -29,6 +32,7 @@ class ExplainLogicalOperator;
 class JoinLogicalOperator;
 class CalcLogicalOperator;
 class GroupByLogicalOperator;
+class Table;
 
 /**
  * @brief 物理计划生成器
@@ -46,6 +50,20 @@ public:
   RC create_vec(LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper, Session *session);
 
 private:
+  /// 每张表在查询中用到的字段
+  using ReferencedFields = unordered_map<const Table *, unordered_set<string>>;
+
+  /**
+   * @brief 收集查询中用到的每张表的字段
+   * @details 用来判断索引是否覆盖了查询需要的所有字段。遇到无法分析的表达式时返回false，比如子查询
+   */
+  static bool collect_referenced_fields(LogicalOperator &logical_operator, ReferencedFields &fields);
+  static bool collect_referenced_fields(Expression *expr, ReferencedFields &fields);
+  /// @brief 把收集到的字段设置到每个 TableGetLogicalOperator 中
+  static void set_referenced_fields(LogicalOperator &logical_operator, const ReferencedFields &fields);
+
+  RC create_oper(LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper, Session *session);
+
   RC create_plan(TableGetLogicalOperator &logical_oper, unique_ptr<PhysicalOperator> &oper, Session *session);
   RC create_plan(PredicateLogicalOperator &logical_oper, unique_ptr<PhysicalOperator> &oper, Session *session);
   RC create_plan(ProjectLogicalOperator &logical_oper, unique_ptr<PhysicalOperator> &oper, Session *session);
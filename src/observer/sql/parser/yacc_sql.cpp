@@ -67,7 +67,7 @@
 
 
 /* First part of user prologue.  */
-#line 2 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 2 "/root/repo/src/observer/sql/parser/yacc_sql.y"
 
 
 #include <stdio.h>
@@ -159,7 +159,7 @@ ComparisonExpr *create_comparison_expression(CompOp comp_op,
 }
 
 
-#line 163 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 163 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -287,45 +287,46 @@ enum yysymbol_kind_t
   YYSYMBOL_drop_table_stmt = 97,           /* drop_table_stmt  */
   YYSYMBOL_analyze_table_stmt = 98,        /* analyze_table_stmt  */
   YYSYMBOL_show_tables_stmt = 99,          /* show_tables_stmt  */
-  YYSYMBOL_desc_table_stmt = 100,          /* desc_table_stmt  */
-  YYSYMBOL_create_index_stmt = 101,        /* create_index_stmt  */
-  YYSYMBOL_attribute_name_list = 102,      /* attribute_name_list  */
-  YYSYMBOL_drop_index_stmt = 103,          /* drop_index_stmt  */
-  YYSYMBOL_show_index_stmt = 104,          /* show_index_stmt  */
-  YYSYMBOL_create_table_stmt = 105,        /* create_table_stmt  */
-  YYSYMBOL_attr_def_list = 106,            /* attr_def_list  */
-  YYSYMBOL_attr_def = 107,                 /* attr_def  */
-  YYSYMBOL_nullable_spec = 108,            /* nullable_spec  */
-  YYSYMBOL_number = 109,                   /* number  */
-  YYSYMBOL_type = 110,                     /* type  */
-  YYSYMBOL_primary_key = 111,              /* primary_key  */
-  YYSYMBOL_attr_list = 112,                /* attr_list  */
-  YYSYMBOL_insert_stmt = 113,              /* insert_stmt  */
-  YYSYMBOL_value_list = 114,               /* value_list  */
-  YYSYMBOL_value = 115,                    /* value  */
-  YYSYMBOL_storage_format = 116,           /* storage_format  */
-  YYSYMBOL_delete_stmt = 117,              /* delete_stmt  */
-  YYSYMBOL_update_stmt = 118,              /* update_stmt  */
-  YYSYMBOL_update_list = 119,              /* update_list  */
-  YYSYMBOL_select_stmt = 120,              /* select_stmt  */
-  YYSYMBOL_calc_stmt = 121,                /* calc_stmt  */
-  YYSYMBOL_expression_list = 122,          /* expression_list  */
-  YYSYMBOL_expression = 123,               /* expression  */
-  YYSYMBOL_rel_attr = 124,                 /* rel_attr  */
-  YYSYMBOL_relation = 125,                 /* relation  */
-  YYSYMBOL_rel_list = 126,                 /* rel_list  */
-  YYSYMBOL_where = 127,                    /* where  */
-  YYSYMBOL_having = 128,                   /* having  */
-  YYSYMBOL_condition_list = 129,           /* condition_list  */
-  YYSYMBOL_condition = 130,                /* condition  */
-  YYSYMBOL_comp_op = 131,                  /* comp_op  */
-  YYSYMBOL_on_conditions = 132,            /* on_conditions  */
-  YYSYMBOL_join_list = 133,                /* join_list  */
-  YYSYMBOL_group_by = 134,                 /* group_by  */
-  YYSYMBOL_load_data_stmt = 135,           /* load_data_stmt  */
-  YYSYMBOL_explain_stmt = 136,             /* explain_stmt  */
-  YYSYMBOL_set_variable_stmt = 137,        /* set_variable_stmt  */
-  YYSYMBOL_opt_semicolon = 138             /* opt_semicolon  */
+  YYSYMBOL_show_buffer_pool_stmt = 100,    /* show_buffer_pool_stmt  */
+  YYSYMBOL_desc_table_stmt = 101,          /* desc_table_stmt  */
+  YYSYMBOL_create_index_stmt = 102,        /* create_index_stmt  */
+  YYSYMBOL_attribute_name_list = 103,      /* attribute_name_list  */
+  YYSYMBOL_drop_index_stmt = 104,          /* drop_index_stmt  */
+  YYSYMBOL_show_index_stmt = 105,          /* show_index_stmt  */
+  YYSYMBOL_create_table_stmt = 106,        /* create_table_stmt  */
+  YYSYMBOL_attr_def_list = 107,            /* attr_def_list  */
+  YYSYMBOL_attr_def = 108,                 /* attr_def  */
+  YYSYMBOL_nullable_spec = 109,            /* nullable_spec  */
+  YYSYMBOL_number = 110,                   /* number  */
+  YYSYMBOL_type = 111,                     /* type  */
+  YYSYMBOL_primary_key = 112,              /* primary_key  */
+  YYSYMBOL_attr_list = 113,                /* attr_list  */
+  YYSYMBOL_insert_stmt = 114,              /* insert_stmt  */
+  YYSYMBOL_value_list = 115,               /* value_list  */
+  YYSYMBOL_value = 116,                    /* value  */
+  YYSYMBOL_storage_format = 117,           /* storage_format  */
+  YYSYMBOL_delete_stmt = 118,              /* delete_stmt  */
+  YYSYMBOL_update_stmt = 119,              /* update_stmt  */
+  YYSYMBOL_update_list = 120,              /* update_list  */
+  YYSYMBOL_select_stmt = 121,              /* select_stmt  */
+  YYSYMBOL_calc_stmt = 122,                /* calc_stmt  */
+  YYSYMBOL_expression_list = 123,          /* expression_list  */
+  YYSYMBOL_expression = 124,               /* expression  */
+  YYSYMBOL_rel_attr = 125,                 /* rel_attr  */
+  YYSYMBOL_relation = 126,                 /* relation  */
+  YYSYMBOL_rel_list = 127,                 /* rel_list  */
+  YYSYMBOL_where = 128,                    /* where  */
+  YYSYMBOL_having = 129,                   /* having  */
+  YYSYMBOL_condition_list = 130,           /* condition_list  */
+  YYSYMBOL_condition = 131,                /* condition  */
+  YYSYMBOL_comp_op = 132,                  /* comp_op  */
+  YYSYMBOL_on_conditions = 133,            /* on_conditions  */
+  YYSYMBOL_join_list = 134,                /* join_list  */
+  YYSYMBOL_group_by = 135,                 /* group_by  */
+  YYSYMBOL_load_data_stmt = 136,           /* load_data_stmt  */
+  YYSYMBOL_explain_stmt = 137,             /* explain_stmt  */
+  YYSYMBOL_set_variable_stmt = 138,        /* set_variable_stmt  */
+  YYSYMBOL_opt_semicolon = 139             /* opt_semicolon  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -654,18 +655,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  83
+#define YYFINAL  85
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   431
+#define YYLAST   452
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  88
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  51
+#define YYNNTS  52
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  141
+#define YYNRULES  143
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  295
+#define YYNSTATES  299
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   338
@@ -722,21 +723,21 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   283,   283,   291,   292,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     308,   309,   310,   311,   312,   316,   322,   327,   333,   339,
-     345,   351,   357,   364,   370,   377,   387,   399,   404,   411,
-     419,   426,   447,   453,   462,   474,   486,   498,   513,   514,
-     518,   521,   522,   523,   524,   525,   526,   530,   533,   540,
-     544,   556,   566,   572,   579,   583,   587,   597,   603,   617,
-     620,   627,   638,   654,   661,   671,   704,   718,   729,   738,
-     743,   754,   757,   760,   763,   767,   771,   774,   779,   785,
-     788,   791,   794,   797,   800,   803,   806,   812,   822,   832,
-     839,   846,   853,   860,   863,   866,   872,   876,   884,   889,
-     893,   906,   909,   915,   918,   924,   927,   932,   943,   956,
-     969,   982,   998,   999,  1000,  1001,  1002,  1003,  1004,  1005,
-    1010,  1022,  1042,  1045,  1060,  1084,  1087,  1093,  1105,  1113,
-    1122,  1123
+       0,   284,   284,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   318,   324,   329,   335,
+     341,   347,   353,   359,   366,   373,   384,   391,   401,   413,
+     418,   425,   433,   440,   461,   467,   476,   488,   500,   512,
+     527,   528,   532,   535,   536,   537,   538,   539,   540,   544,
+     547,   554,   558,   570,   580,   586,   593,   597,   601,   611,
+     617,   631,   634,   641,   652,   668,   675,   685,   718,   732,
+     743,   752,   757,   768,   771,   774,   777,   781,   785,   788,
+     793,   799,   802,   805,   808,   811,   814,   817,   820,   826,
+     836,   846,   853,   860,   867,   874,   877,   880,   886,   890,
+     898,   903,   907,   920,   923,   929,   932,   938,   941,   946,
+     957,   970,   983,   996,  1012,  1013,  1014,  1015,  1016,  1017,
+    1018,  1019,  1024,  1036,  1056,  1059,  1074,  1098,  1101,  1107,
+    1119,  1127,  1136,  1137
 };
 #endif
 
@@ -766,15 +767,15 @@ static const char *const yytname[] =
   "VECTOR_LITERAL", "'+'", "'-'", "'*'", "'/'", "UMINUS", "$accept",
   "commands", "command_wrapper", "exit_stmt", "help_stmt", "sync_stmt",
   "begin_stmt", "commit_stmt", "rollback_stmt", "drop_table_stmt",
-  "analyze_table_stmt", "show_tables_stmt", "desc_table_stmt",
-  "create_index_stmt", "attribute_name_list", "drop_index_stmt",
-  "show_index_stmt", "create_table_stmt", "attr_def_list", "attr_def",
-  "nullable_spec", "number", "type", "primary_key", "attr_list",
-  "insert_stmt", "value_list", "value", "storage_format", "delete_stmt",
-  "update_stmt", "update_list", "select_stmt", "calc_stmt",
-  "expression_list", "expression", "rel_attr", "relation", "rel_list",
-  "where", "having", "condition_list", "condition", "comp_op",
-  "on_conditions", "join_list", "group_by", "load_data_stmt",
+  "analyze_table_stmt", "show_tables_stmt", "show_buffer_pool_stmt",
+  "desc_table_stmt", "create_index_stmt", "attribute_name_list",
+  "drop_index_stmt", "show_index_stmt", "create_table_stmt",
+  "attr_def_list", "attr_def", "nullable_spec", "number", "type",
+  "primary_key", "attr_list", "insert_stmt", "value_list", "value",
+  "storage_format", "delete_stmt", "update_stmt", "update_list",
+  "select_stmt", "calc_stmt", "expression_list", "expression", "rel_attr",
+  "relation", "rel_list", "where", "having", "condition_list", "condition",
+  "comp_op", "on_conditions", "join_list", "group_by", "load_data_stmt",
   "explain_stmt", "set_variable_stmt", "opt_semicolon", YY_NULLPTR
 };
 
@@ -785,7 +786,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-267)
+#define YYPACT_NINF (-274)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -799,36 +800,36 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     344,    18,    85,    87,    87,   -60,    11,  -267,    -8,     0,
-     -52,  -267,  -267,  -267,  -267,  -267,     6,    46,   344,    80,
-      99,    97,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
-    -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
-    -267,  -267,  -267,  -267,    22,    24,    92,    27,    28,     3,
-    -267,    34,    88,    89,    94,   101,   102,   103,   104,   105,
-     106,  -267,  -267,    98,  -267,  -267,    87,  -267,  -267,  -267,
-     167,  -267,    -5,  -267,  -267,    86,    61,    62,    95,    90,
-     108,  -267,    70,  -267,  -267,  -267,   138,   121,    84,  -267,
-     125,   160,    30,   162,    87,    87,    87,   111,    87,    87,
-      87,    87,   171,   122,   -31,    87,   131,   182,    87,    87,
-      87,    87,   127,    87,   128,   166,   165,   133,    54,   135,
-    -267,   134,   146,   169,   148,  -267,  -267,   171,   233,   271,
-     285,   195,   115,   139,   173,   191,   197,   206,  -267,  -267,
-     209,     3,   -29,   -29,   -31,   -31,  -267,   207,   161,   263,
-    -267,   189,  -267,   216,    87,  -267,   183,   -16,  -267,   201,
-     -17,   221,  -267,   226,   174,  -267,   237,    87,    87,    87,
-    -267,  -267,  -267,  -267,  -267,  -267,  -267,     3,   238,   241,
-     127,   190,   -40,   -15,    41,  -267,  -267,  -267,  -267,  -267,
-    -267,  -267,    87,    87,    54,  -267,    87,   186,  -267,   257,
-    -267,  -267,  -267,  -267,  -267,  -267,   -11,   -46,   247,   192,
-     250,  -267,   205,   211,   219,   255,   261,  -267,  -267,  -267,
-     127,   210,   277,  -267,  -267,   258,   303,  -267,    40,  -267,
-     303,   242,   228,   231,   275,  -267,   254,  -267,   259,  -267,
-      66,   192,  -267,  -267,  -267,  -267,  -267,   265,   127,   311,
-     310,  -267,  -267,    54,    87,  -267,  -267,   304,  -267,   306,
-     276,  -267,  -267,   252,    68,    87,   284,    87,    87,  -267,
-    -267,   303,   298,   260,   279,  -267,  -267,   345,  -267,    87,
-    -267,  -267,  -267,   308,   318,   270,    87,  -267,   260,  -267,
-    -267,   294,  -267,    87,  -267
+     359,    12,    57,    90,    90,   -59,     0,  -274,   -13,    -6,
+     -24,  -274,  -274,  -274,  -274,  -274,   -20,    14,   359,    58,
+      89,    99,  -274,  -274,  -274,  -274,  -274,  -274,  -274,  -274,
+    -274,  -274,  -274,  -274,  -274,  -274,  -274,  -274,  -274,  -274,
+    -274,  -274,  -274,  -274,  -274,    28,    32,   108,    47,    48,
+       6,  -274,    54,   107,   109,   112,   113,   116,   119,   129,
+     131,   140,  -274,  -274,   122,  -274,  -274,    90,  -274,  -274,
+    -274,   215,  -274,   -30,  -274,  -274,    86,    87,    93,    96,
+     139,   132,   136,  -274,   125,  -274,  -274,  -274,   174,   157,
+     128,  -274,   162,   188,     9,   190,    90,    90,    90,   114,
+      90,    90,    90,    90,   198,   137,   -29,    90,   145,   206,
+      90,    90,    90,    90,   141,    90,   150,   152,   191,   192,
+     159,   226,   156,  -274,   160,   163,   197,   167,  -274,  -274,
+     198,   260,   275,   279,   225,    31,   117,   142,   180,   186,
+     228,  -274,  -274,   227,     6,   -27,   -27,   -29,   -29,  -274,
+     231,   184,   360,  -274,   229,  -274,  -274,   239,    90,  -274,
+     216,    -8,  -274,   234,    67,   247,  -274,   266,   210,  -274,
+     267,    90,    90,    90,  -274,  -274,  -274,  -274,  -274,  -274,
+    -274,     6,   273,   285,   141,   233,   -41,    37,    84,  -274,
+    -274,  -274,  -274,  -274,  -274,  -274,    90,    90,   226,  -274,
+      90,   223,  -274,   301,  -274,  -274,  -274,  -274,  -274,  -274,
+      -9,   -48,   289,   236,   291,  -274,   195,   200,   209,   293,
+     294,  -274,  -274,  -274,   141,   242,   311,  -274,  -274,   286,
+     171,  -274,    -7,  -274,   171,   263,   243,   246,   290,  -274,
+     269,  -274,   274,  -274,     4,   236,  -274,  -274,  -274,  -274,
+    -274,   278,   141,   325,   320,  -274,  -274,   226,    90,  -274,
+    -274,   307,  -274,   309,   280,  -274,  -274,   254,    13,    90,
+     287,    90,    90,  -274,  -274,   171,   302,   257,   281,  -274,
+    -274,   366,  -274,    90,  -274,  -274,  -274,   312,   317,   262,
+      90,  -274,   257,  -274,  -274,    60,  -274,    90,  -274
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -836,58 +837,58 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,     0,     0,     0,     0,     0,     0,    27,     0,     0,
-       0,    28,    29,    30,    26,    25,     0,     0,     0,     0,
-       0,   140,    24,    23,    16,    17,    18,    19,     9,    10,
-      11,    13,    14,    15,    12,     8,     5,     7,     6,     4,
-       3,    20,    21,    22,     0,     0,     0,     0,     0,     0,
-      67,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    64,    65,   106,    66,    68,     0,    89,    87,    78,
-      79,    88,    77,    34,    33,     0,     0,     0,     0,     0,
-       0,   138,     0,     1,   141,     2,     0,     0,     0,    31,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    86,     0,     0,     0,     0,     0,
-       0,     0,     0,   115,     0,     0,   111,     0,     0,     0,
-      32,     0,     0,     0,     0,    96,    85,     0,     0,     0,
-       0,    89,     0,     0,     0,     0,     0,     0,   107,    80,
-       0,     0,    81,    82,    83,    84,   108,   109,   132,   121,
-      76,   116,    40,     0,   115,    71,     0,   111,   139,     0,
-       0,    57,    42,     0,     0,    39,     0,     0,     0,     0,
-      90,    91,    92,    93,    94,    95,   101,     0,     0,     0,
-       0,     0,   111,     0,     0,   122,   123,   124,   125,   126,
-     127,   128,     0,   115,     0,   112,     0,     0,    72,     0,
-      51,    52,    53,    54,    55,    56,    47,     0,     0,     0,
-       0,   102,     0,     0,     0,     0,     0,    99,    97,   110,
-       0,     0,   135,   129,   119,     0,   118,   117,     0,    62,
-      73,     0,     0,     0,     0,    45,     0,    43,    69,    37,
-       0,     0,   103,   104,   105,   100,    98,     0,     0,     0,
-     113,   120,    61,     0,     0,   137,    50,     0,    48,     0,
-       0,    41,    35,     0,     0,     0,     0,     0,   115,    75,
-      63,    74,    46,     0,     0,    38,    36,     0,   133,     0,
-     136,   114,    44,    59,     0,     0,     0,   134,     0,    58,
-      70,   130,    60,     0,   131
+       0,     0,     0,     0,     0,     0,     0,    28,     0,     0,
+       0,    29,    30,    31,    27,    26,     0,     0,     0,     0,
+       0,   142,    25,    24,    17,    18,    19,    20,     9,    10,
+      11,    12,    14,    15,    16,    13,     8,     5,     7,     6,
+       4,     3,    21,    22,    23,     0,     0,     0,     0,     0,
+       0,    69,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    66,    67,   108,    68,    70,     0,    91,    89,
+      80,    81,    90,    79,    36,    34,     0,     0,     0,     0,
+       0,     0,     0,   140,     0,     1,   143,     2,     0,     0,
+       0,    32,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    88,     0,     0,     0,
+       0,     0,     0,     0,     0,   117,     0,     0,     0,   113,
+       0,     0,     0,    33,     0,     0,     0,     0,    98,    87,
+       0,     0,     0,     0,    91,     0,     0,     0,     0,     0,
+       0,   109,    82,     0,     0,    83,    84,    85,    86,   110,
+     111,   134,   123,    78,   118,    42,    35,     0,   117,    73,
+       0,   113,   141,     0,     0,    59,    44,     0,     0,    41,
+       0,     0,     0,     0,    92,    93,    94,    95,    96,    97,
+     103,     0,     0,     0,     0,     0,   113,     0,     0,   124,
+     125,   126,   127,   128,   129,   130,     0,   117,     0,   114,
+       0,     0,    74,     0,    53,    54,    55,    56,    57,    58,
+      49,     0,     0,     0,     0,   104,     0,     0,     0,     0,
+       0,   101,    99,   112,     0,     0,   137,   131,   121,     0,
+     120,   119,     0,    64,    75,     0,     0,     0,     0,    47,
+       0,    45,    71,    39,     0,     0,   105,   106,   107,   102,
+     100,     0,     0,     0,   115,   122,    63,     0,     0,   139,
+      52,     0,    50,     0,     0,    43,    37,     0,     0,     0,
+       0,     0,   117,    77,    65,    76,    48,     0,     0,    40,
+      38,     0,   135,     0,   138,   116,    46,    61,     0,     0,
+       0,   136,     0,    60,    72,   132,    62,     0,   133
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -267,  -267,   325,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
-    -267,  -267,  -267,  -267,   112,  -267,  -267,  -267,  -267,   168,
-      73,  -267,  -267,  -267,   107,  -267,  -267,  -115,  -267,  -267,
-    -267,  -267,   -47,  -267,    -4,   -48,  -267,  -211,   202,  -149,
-    -267,  -150,  -267,   113,  -266,  -267,  -267,  -267,  -267,  -267,
-    -267
+    -274,  -274,   329,  -274,  -274,  -274,  -274,  -274,  -274,  -274,
+    -274,  -274,  -274,  -274,  -274,   104,  -274,  -274,  -274,  -274,
+     143,    74,  -274,  -274,  -274,    59,  -274,  -274,  -119,  -274,
+    -274,  -274,  -274,   -47,  -274,    -4,   -49,  -274,  -218,   169,
+    -150,  -274,  -154,  -274,    75,  -273,  -274,  -274,  -274,  -274,
+    -274,  -274
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
        0,    20,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,   240,    33,    34,    35,   161,   162,
-     235,   257,   206,   208,   284,    36,   228,    68,   261,    37,
-      38,   157,    39,    40,    69,    70,    71,   147,   148,   155,
-     269,   150,   151,   192,   278,   182,   250,    41,    42,    43,
-      85
+      29,    30,    31,    32,    33,   244,    34,    35,    36,   165,
+     166,   239,   261,   210,   212,   288,    37,   232,    69,   265,
+      38,    39,   161,    40,    41,    70,    71,    72,   150,   151,
+     159,   273,   153,   154,   196,   282,   186,   254,    42,    43,
+      44,    87
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -895,98 +896,102 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      72,    92,    91,   158,   195,   106,   154,   106,   198,   247,
-     236,   197,   233,   287,   200,   201,   202,   203,   104,     4,
-      73,   204,   205,    74,    75,   234,    49,   294,    78,    44,
-     154,    45,    46,   222,   160,    76,   221,   266,    50,    51,
-     112,   113,   107,   227,   107,    77,   128,   129,   130,   132,
-     133,   134,   135,   136,   126,   137,   110,   111,   140,   223,
-     142,   143,   144,   145,   252,   149,   106,   253,    52,    53,
-      54,    55,    56,    57,    58,    59,   224,   225,    60,   229,
-     166,    61,    62,    63,    64,    65,    79,    66,    67,    50,
-     262,    82,   276,   263,   178,   263,    47,    80,    48,    83,
-      84,   139,    86,   107,    87,    88,   149,    89,    90,    93,
-      49,    94,    95,   108,   109,   110,   111,    96,   281,   212,
-     213,   214,    50,    51,    97,    98,    99,   100,   101,   102,
-     215,   114,    61,    62,    49,    64,    65,   179,   270,   171,
-     103,   115,   116,   117,   226,   149,    50,    51,   230,   118,
-     120,   106,    52,    53,    54,    55,    56,    57,    58,    59,
-     119,   121,    60,   172,   123,    61,    62,    63,    64,    65,
-     122,    66,    67,   216,   124,   106,    52,    53,    54,    55,
-      56,    57,    58,    59,   125,   127,    60,     4,   107,    61,
-      62,    63,    64,    65,   105,    66,   131,   173,   108,   109,
-     110,   111,   138,   106,   140,   141,   271,   146,   152,   106,
-     153,   154,   107,   156,   160,   174,   159,   277,   164,   170,
-     149,   175,   108,   109,   110,   111,   163,   106,   165,   242,
-     176,   277,   177,   106,   180,   243,   193,   181,   291,   194,
-     107,   106,   196,   244,   199,   277,   107,   106,   207,   209,
-     108,   109,   110,   111,   210,   106,   108,   109,   110,   111,
-     167,   211,   217,   280,   107,   218,   231,   220,   232,   106,
-     107,   238,   239,   241,   108,   109,   110,   111,   107,   245,
-     108,   109,   110,   111,   107,   246,   249,   248,   108,   109,
-     110,   111,   107,   251,   108,   109,   110,   111,   168,   183,
-     184,   254,   108,   109,   110,   111,   107,   106,   255,   256,
-     258,   259,   169,   260,   265,   267,   108,   109,   110,   111,
-     268,   106,   185,   186,   187,   188,   189,   190,   272,   273,
-     106,   274,   275,   279,   234,   288,   107,   191,   285,   106,
-     283,   293,   289,    81,   107,   282,   108,   109,   110,   111,
-     290,     1,     2,   264,   108,   109,   110,   111,   107,     3,
-       4,     5,     6,     7,     8,     9,    10,   107,   108,   109,
-     110,   111,    11,    12,    13,   237,   107,   108,   109,   110,
-     111,   183,   219,     0,    14,    15,   108,   109,   110,   111,
-     286,     0,    16,     0,    17,   292,     0,    18,     0,     0,
-       0,     0,    19,     0,   185,   186,   187,   188,   189,   190,
-       0,     0,     0,     0,     0,     0,     0,     0,   107,   191,
-       0,     0,     0,     0,     0,     0,     0,     0,   108,   109,
-     110,   111
+      73,    94,   162,    93,   199,   158,   251,   108,   240,   108,
+     291,   202,    75,    76,   237,   114,   115,   256,   106,   201,
+     257,    74,     4,    45,   298,    46,    47,   238,   266,    50,
+      78,   267,   164,   129,   270,   225,   226,   280,   158,    79,
+     267,    51,    52,   231,   109,   108,   109,   131,   132,   133,
+     135,   136,   137,   138,   139,   175,    80,   140,   112,   113,
+      81,   145,   146,   147,   148,    82,   152,   108,    48,    84,
+      49,    53,    54,    55,    56,    57,    58,    59,    60,   233,
+      77,    61,   109,   170,    62,    63,    64,    65,    66,    85,
+      67,    68,   110,   111,   112,   113,   108,   182,   204,   205,
+     206,   207,    86,   142,   109,   208,   209,   297,    88,   152,
+     143,   227,    89,    50,   110,   111,   112,   113,   285,   228,
+     229,    90,   216,   217,   218,    51,    52,    91,    92,    95,
+      96,   116,    97,   109,   219,    98,    99,    50,   274,   100,
+     183,   176,   101,   110,   111,   112,   113,   230,   152,    51,
+      52,   234,   102,   108,   103,    53,    54,    55,    56,    57,
+      58,    59,    60,   104,   105,    61,   177,   117,    62,    63,
+      64,    65,    66,   118,    67,    68,   119,   220,   108,    53,
+      54,    55,    56,    57,    58,    59,    60,   120,   122,    61,
+     109,   121,    62,    63,    64,    65,    66,   124,    67,   134,
+     110,   111,   112,   113,   178,   123,   125,   108,   126,   275,
+     179,   127,   128,   130,     4,   109,   108,   141,   143,   246,
+     281,   149,   108,   152,   247,   110,   111,   112,   113,   144,
+     155,   108,   156,   248,   281,   157,   108,   163,   158,   160,
+     164,   295,   107,   167,   109,   108,   168,   169,   281,   174,
+     181,   108,   180,   109,   110,   111,   112,   113,   184,   109,
+     185,    51,   198,   110,   111,   112,   113,   284,   109,   110,
+     111,   112,   113,   109,   211,   200,   197,   203,   110,   111,
+     112,   113,   109,   110,   111,   112,   113,   171,   109,   213,
+     214,   215,   110,   111,   112,   113,   108,   221,   110,   111,
+     112,   113,   172,   235,    62,    63,   173,    65,    66,   222,
+     224,   108,   236,   242,   245,   108,   243,   249,   250,   252,
+     253,   255,   258,   259,   260,   262,   263,   269,   264,   271,
+     272,   276,   277,   109,   279,   278,   283,   287,   238,   292,
+     289,   293,   294,   110,   111,   112,   113,    83,   109,   268,
+     286,   296,   109,   223,   241,     0,   290,     0,   110,   111,
+     112,   113,   110,   111,   112,   113,     1,     2,     0,     0,
+       0,     0,     0,     0,     3,     4,     5,     6,     7,     8,
+       9,    10,     0,     0,     0,     0,     0,    11,    12,    13,
+       0,     0,     0,     0,     0,     0,   187,   188,     0,    14,
+      15,     0,   187,     0,     0,     0,     0,    16,     0,    17,
+       0,     0,    18,     0,     0,     0,     0,    19,     0,   189,
+     190,   191,   192,   193,   194,   189,   190,   191,   192,   193,
+     194,     0,     0,   109,   195,     0,     0,     0,     0,   109,
+     195,     0,     0,   110,   111,   112,   113,     0,     0,   110,
+     111,   112,   113
 };
 
 static const yytype_int16 yycheck[] =
 {
-       4,    49,    49,   118,   154,    36,    46,    36,   157,   220,
-      56,    27,    23,   279,    31,    32,    33,    34,    66,    16,
-      80,    38,    39,    12,    13,    36,    23,   293,    80,    11,
-      46,    13,    14,   182,    80,    43,    76,   248,    35,    36,
-      45,    46,    73,   193,    73,    45,    94,    95,    96,    97,
-      98,    99,   100,   101,    24,   102,    85,    86,    73,    74,
-     108,   109,   110,   111,    24,   113,    36,    27,    65,    66,
-      67,    68,    69,    70,    71,    72,    35,    36,    75,   194,
-     127,    78,    79,    80,    81,    82,    80,    84,    85,    35,
-      24,    11,    24,    27,   141,    27,    11,    51,    13,     0,
-       3,   105,    80,    73,    80,    13,   154,    80,    80,    75,
-      23,    23,    23,    83,    84,    85,    86,    23,   268,   167,
-     168,   169,    35,    36,    23,    23,    23,    23,    23,    23,
-     177,    45,    78,    79,    23,    81,    82,   141,   253,    24,
-      42,    80,    80,    48,   192,   193,    35,    36,   196,    59,
-      80,    36,    65,    66,    67,    68,    69,    70,    71,    72,
-      52,    23,    75,    24,    80,    78,    79,    80,    81,    82,
-      49,    84,    85,   177,    49,    36,    65,    66,    67,    68,
-      69,    70,    71,    72,    24,    23,    75,    16,    73,    78,
-      79,    80,    81,    82,    27,    84,    85,    24,    83,    84,
-      85,    86,    80,    36,    73,    23,   254,    80,    80,    36,
-      44,    46,    73,    80,    80,    24,    81,   265,    49,    24,
-     268,    24,    83,    84,    85,    86,    80,    36,    80,    24,
-      24,   279,    23,    36,    27,    24,    47,    76,   286,    23,
-      73,    36,    59,    24,    43,   293,    73,    36,    27,    23,
-      83,    84,    85,    86,    80,    36,    83,    84,    85,    86,
-      27,    24,    24,   267,    73,    24,    80,    77,    11,    36,
-      73,    24,    80,    23,    83,    84,    85,    86,    73,    24,
-      83,    84,    85,    86,    73,    24,     9,    77,    83,    84,
-      85,    86,    73,    35,    83,    84,    85,    86,    27,    36,
-      37,    59,    83,    84,    85,    86,    73,    36,    80,    78,
-      35,    57,    27,    54,    49,     4,    83,    84,    85,    86,
-      10,    36,    59,    60,    61,    62,    63,    64,    24,    23,
-      36,    55,    80,    49,    36,    27,    73,    74,    59,    36,
-      80,    47,    24,    18,    73,   272,    83,    84,    85,    86,
-      80,     7,     8,   241,    83,    84,    85,    86,    73,    15,
-      16,    17,    18,    19,    20,    21,    22,    73,    83,    84,
-      85,    86,    28,    29,    30,   207,    73,    83,    84,    85,
-      86,    36,   180,    -1,    40,    41,    83,    84,    85,    86,
-     277,    -1,    48,    -1,    50,   288,    -1,    53,    -1,    -1,
-      -1,    -1,    58,    -1,    59,    60,    61,    62,    63,    64,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    73,    74,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    83,    84,
-      85,    86
+       4,    50,   121,    50,   158,    46,   224,    36,    56,    36,
+     283,   161,    12,    13,    23,    45,    46,    24,    67,    27,
+      27,    80,    16,    11,   297,    13,    14,    36,    24,    23,
+      43,    27,    80,    24,   252,    76,   186,    24,    46,    45,
+      27,    35,    36,   197,    73,    36,    73,    96,    97,    98,
+      99,   100,   101,   102,   103,    24,    80,   104,    85,    86,
+      80,   110,   111,   112,   113,    51,   115,    36,    11,    11,
+      13,    65,    66,    67,    68,    69,    70,    71,    72,   198,
+      80,    75,    73,   130,    78,    79,    80,    81,    82,     0,
+      84,    85,    83,    84,    85,    86,    36,   144,    31,    32,
+      33,    34,     3,   107,    73,    38,    39,    47,    80,   158,
+      73,    74,    80,    23,    83,    84,    85,    86,   272,    35,
+      36,    13,   171,   172,   173,    35,    36,    80,    80,    75,
+      23,    45,    23,    73,   181,    23,    23,    23,   257,    23,
+     144,    24,    23,    83,    84,    85,    86,   196,   197,    35,
+      36,   200,    23,    36,    23,    65,    66,    67,    68,    69,
+      70,    71,    72,    23,    42,    75,    24,    80,    78,    79,
+      80,    81,    82,    80,    84,    85,    80,   181,    36,    65,
+      66,    67,    68,    69,    70,    71,    72,    48,    52,    75,
+      73,    59,    78,    79,    80,    81,    82,    23,    84,    85,
+      83,    84,    85,    86,    24,    80,    49,    36,    80,   258,
+      24,    49,    24,    23,    16,    73,    36,    80,    73,    24,
+     269,    80,    36,   272,    24,    83,    84,    85,    86,    23,
+      80,    36,    80,    24,   283,    44,    36,    81,    46,    80,
+      80,   290,    27,    80,    73,    36,    49,    80,   297,    24,
+      23,    36,    24,    73,    83,    84,    85,    86,    27,    73,
+      76,    35,    23,    83,    84,    85,    86,   271,    73,    83,
+      84,    85,    86,    73,    27,    59,    47,    43,    83,    84,
+      85,    86,    73,    83,    84,    85,    86,    27,    73,    23,
+      80,    24,    83,    84,    85,    86,    36,    24,    83,    84,
+      85,    86,    27,    80,    78,    79,    27,    81,    82,    24,
+      77,    36,    11,    24,    23,    36,    80,    24,    24,    77,
+       9,    35,    59,    80,    78,    35,    57,    49,    54,     4,
+      10,    24,    23,    73,    80,    55,    49,    80,    36,    27,
+      59,    24,    80,    83,    84,    85,    86,    18,    73,   245,
+     276,   292,    73,   184,   211,    -1,   281,    -1,    83,    84,
+      85,    86,    83,    84,    85,    86,     7,     8,    -1,    -1,
+      -1,    -1,    -1,    -1,    15,    16,    17,    18,    19,    20,
+      21,    22,    -1,    -1,    -1,    -1,    -1,    28,    29,    30,
+      -1,    -1,    -1,    -1,    -1,    -1,    36,    37,    -1,    40,
+      41,    -1,    36,    -1,    -1,    -1,    -1,    48,    -1,    50,
+      -1,    -1,    53,    -1,    -1,    -1,    -1,    58,    -1,    59,
+      60,    61,    62,    63,    64,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    73,    74,    -1,    -1,    -1,    -1,    73,
+      74,    -1,    -1,    83,    84,    85,    86,    -1,    -1,    83,
+      84,    85,    86
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -996,33 +1001,33 @@ static const yytype_uint8 yystos[] =
        0,     7,     8,    15,    16,    17,    18,    19,    20,    21,
       22,    28,    29,    30,    40,    41,    48,    50,    53,    58,
       89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
-      99,   100,   101,   103,   104,   105,   113,   117,   118,   120,
-     121,   135,   136,   137,    11,    13,    14,    11,    13,    23,
-      35,    36,    65,    66,    67,    68,    69,    70,    71,    72,
-      75,    78,    79,    80,    81,    82,    84,    85,   115,   122,
-     123,   124,   122,    80,    12,    13,    43,    45,    80,    80,
-      51,    90,    11,     0,     3,   138,    80,    80,    13,    80,
-      80,   120,   123,    75,    23,    23,    23,    23,    23,    23,
-      23,    23,    23,    42,   123,    27,    36,    73,    83,    84,
-      85,    86,    45,    46,    45,    80,    80,    48,    59,    52,
-      80,    23,    49,    80,    49,    24,    24,    23,   123,   123,
-     123,    85,   123,   123,   123,   123,   123,   120,    80,   122,
-      73,    23,   123,   123,   123,   123,    80,   125,   126,   123,
-     129,   130,    80,    44,    46,   127,    80,   119,   115,    81,
-      80,   106,   107,    80,    49,    80,   120,    27,    27,    27,
-      24,    24,    24,    24,    24,    24,    24,    23,   120,   122,
-      27,    76,   133,    36,    37,    59,    60,    61,    62,    63,
-      64,    74,   131,    47,    23,   129,    59,    27,   127,    43,
-      31,    32,    33,    34,    38,    39,   110,    27,   111,    23,
-      80,    24,   123,   123,   123,   120,   122,    24,    24,   126,
-      77,    76,   127,    74,    35,    36,   123,   129,   114,   115,
-     123,    80,    11,    23,    36,   108,    56,   107,    24,    80,
-     102,    23,    24,    24,    24,    24,    24,   125,    77,     9,
-     134,    35,    24,    27,    59,    80,    78,   109,    35,    57,
-      54,   116,    24,    27,   102,    49,   125,     4,    10,   128,
-     115,   123,    24,    23,    55,    80,    24,   123,   132,    49,
-     122,   129,   108,    80,   112,    59,   131,   132,    27,    24,
-      80,   123,   112,    47,   132
+      99,   100,   101,   102,   104,   105,   106,   114,   118,   119,
+     121,   122,   136,   137,   138,    11,    13,    14,    11,    13,
+      23,    35,    36,    65,    66,    67,    68,    69,    70,    71,
+      72,    75,    78,    79,    80,    81,    82,    84,    85,   116,
+     123,   124,   125,   123,    80,    12,    13,    80,    43,    45,
+      80,    80,    51,    90,    11,     0,     3,   139,    80,    80,
+      13,    80,    80,   121,   124,    75,    23,    23,    23,    23,
+      23,    23,    23,    23,    23,    42,   124,    27,    36,    73,
+      83,    84,    85,    86,    45,    46,    45,    80,    80,    80,
+      48,    59,    52,    80,    23,    49,    80,    49,    24,    24,
+      23,   124,   124,   124,    85,   124,   124,   124,   124,   124,
+     121,    80,   123,    73,    23,   124,   124,   124,   124,    80,
+     126,   127,   124,   130,   131,    80,    80,    44,    46,   128,
+      80,   120,   116,    81,    80,   107,   108,    80,    49,    80,
+     121,    27,    27,    27,    24,    24,    24,    24,    24,    24,
+      24,    23,   121,   123,    27,    76,   134,    36,    37,    59,
+      60,    61,    62,    63,    64,    74,   132,    47,    23,   130,
+      59,    27,   128,    43,    31,    32,    33,    34,    38,    39,
+     111,    27,   112,    23,    80,    24,   124,   124,   124,   121,
+     123,    24,    24,   127,    77,    76,   128,    74,    35,    36,
+     124,   130,   115,   116,   124,    80,    11,    23,    36,   109,
+      56,   108,    24,    80,   103,    23,    24,    24,    24,    24,
+      24,   126,    77,     9,   135,    35,    24,    27,    59,    80,
+      78,   110,    35,    57,    54,   117,    24,    27,   103,    49,
+     126,     4,    10,   129,   116,   124,    24,    23,    55,    80,
+      24,   124,   133,    49,   123,   130,   109,    80,   113,    59,
+     132,   133,    27,    24,    80,   124,   113,    47,   133
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1030,19 +1035,19 @@ static const yytype_uint8 yyr1[] =
 {
        0,    88,    89,    90,    90,    90,    90,    90,    90,    90,
       90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
-      90,    90,    90,    90,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   101,   102,   102,   103,
-     104,   105,   106,   106,   107,   107,   107,   107,   108,   108,
-     109,   110,   110,   110,   110,   110,   110,   111,   111,   112,
-     112,   113,   114,   114,   115,   115,   115,   115,   115,   116,
-     116,   117,   118,   119,   119,   120,   120,   120,   121,   122,
-     122,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   124,   124,   125,   126,
-     126,   127,   127,   128,   128,   129,   129,   129,   130,   130,
-     130,   130,   131,   131,   131,   131,   131,   131,   131,   131,
-     132,   132,   133,   133,   133,   134,   134,   135,   136,   137,
-     138,   138
+      90,    90,    90,    90,    90,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   102,   103,
+     103,   104,   105,   106,   107,   107,   108,   108,   108,   108,
+     109,   109,   110,   111,   111,   111,   111,   111,   111,   112,
+     112,   113,   113,   114,   115,   115,   116,   116,   116,   116,
+     116,   117,   117,   118,   119,   120,   120,   121,   121,   121,
+     122,   123,   123,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   125,   125,
+     126,   127,   127,   128,   128,   129,   129,   130,   130,   130,
+     131,   131,   131,   131,   132,   132,   132,   132,   132,   132,
+     132,   132,   133,   133,   134,   134,   134,   135,   135,   136,
+     137,   138,   139,   139
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1051,18 +1056,18 @@ static const yytype_int8 yyr2[] =
        0,     2,     2,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     2,     2,     8,     9,     1,     3,     5,
-       4,     8,     1,     3,     6,     3,     5,     2,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     0,     6,     1,
-       3,     7,     1,     3,     1,     1,     1,     1,     1,     0,
-       4,     4,     5,     3,     5,     8,     4,     2,     2,     1,
-       3,     3,     3,     3,     3,     3,     2,     1,     1,     1,
-       4,     4,     4,     4,     4,     4,     3,     5,     6,     5,
-       6,     4,     5,     6,     6,     6,     1,     3,     1,     1,
-       3,     0,     2,     0,     2,     0,     1,     3,     3,     3,
-       4,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       3,     5,     0,     5,     6,     0,     3,     7,     2,     4,
-       0,     1
+       1,     1,     3,     3,     2,     4,     2,     8,     9,     1,
+       3,     5,     4,     8,     1,     3,     6,     3,     5,     2,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     0,
+       6,     1,     3,     7,     1,     3,     1,     1,     1,     1,
+       1,     0,     4,     4,     5,     3,     5,     8,     4,     2,
+       2,     1,     3,     3,     3,     3,     3,     3,     2,     1,
+       1,     1,     4,     4,     4,     4,     4,     4,     3,     5,
+       6,     5,     6,     4,     5,     6,     6,     6,     1,     3,
+       1,     1,     3,     0,     2,     0,     2,     0,     1,     3,
+       3,     3,     4,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     3,     5,     0,     5,     6,     0,     3,     7,
+       2,     4,     0,     1
 };
 
 
@@ -1628,111 +1633,111 @@ yydestruct (const char *yymsg,
   switch (yykind)
     {
     case YYSYMBOL_attribute_name_list: /* attribute_name_list  */
-#line 215 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 215 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).key_list); }
-#line 1634 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1639 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_attr_def_list: /* attr_def_list  */
-#line 207 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 207 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).attr_infos); }
-#line 1640 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1645 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_attr_def: /* attr_def  */
-#line 208 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 208 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).attr_info); }
-#line 1646 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1651 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_primary_key: /* primary_key  */
-#line 215 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 215 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).key_list); }
-#line 1652 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1657 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_attr_list: /* attr_list  */
-#line 215 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 215 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).key_list); }
-#line 1658 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1663 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_value_list: /* value_list  */
-#line 211 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 211 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).value_list); }
-#line 1664 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1669 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_value: /* value  */
-#line 205 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 205 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).value); }
-#line 1670 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1675 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_update_list: /* update_list  */
-#line 216 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 216 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).update_list); }
-#line 1676 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1681 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_expression_list: /* expression_list  */
-#line 210 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 210 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).expression_list); }
-#line 1682 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1687 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_expression: /* expression  */
-#line 209 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 209 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).expression); }
-#line 1688 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1693 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_rel_attr: /* rel_attr  */
-#line 206 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 206 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).rel_attr); }
-#line 1694 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1699 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_rel_list: /* rel_list  */
-#line 214 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 214 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).relation_list); }
-#line 1700 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1705 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_where: /* where  */
-#line 212 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 212 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).condition_list); }
-#line 1706 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1711 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_having: /* having  */
-#line 212 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 212 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).condition_list); }
-#line 1712 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1717 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_condition_list: /* condition_list  */
-#line 212 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 212 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).condition_list); }
-#line 1718 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1723 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_condition: /* condition  */
-#line 204 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 204 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).condition); }
-#line 1724 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1729 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_on_conditions: /* on_conditions  */
-#line 212 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 212 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).condition_list); }
-#line 1730 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1735 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
     case YYSYMBOL_group_by: /* group_by  */
-#line 210 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 210 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             { delete ((*yyvaluep).expression_list); }
-#line 1736 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 1741 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
         break;
 
       default:
@@ -2036,100 +2041,113 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* commands: command_wrapper opt_semicolon  */
-#line 284 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 285 "/root/repo/src/observer/sql/parser/yacc_sql.y"
   {
     unique_ptr<ParsedSqlNode> sql_node = unique_ptr<ParsedSqlNode>((yyvsp[-1].sql_node));
     sql_result->add_sql_node(std::move(sql_node));
   }
-#line 2045 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2050 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 25: /* exit_stmt: EXIT  */
-#line 316 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 26: /* exit_stmt: EXIT  */
+#line 318 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          {
       (void)yynerrs;  // 这么写为了消除yynerrs未使用的告警。如果你有更好的方法欢迎提PR
       (yyval.sql_node) = new ParsedSqlNode(SCF_EXIT);
     }
-#line 2054 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2059 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 26: /* help_stmt: HELP  */
-#line 322 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 27: /* help_stmt: HELP  */
+#line 324 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          {
       (yyval.sql_node) = new ParsedSqlNode(SCF_HELP);
     }
-#line 2062 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2067 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 27: /* sync_stmt: SYNC  */
-#line 327 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 28: /* sync_stmt: SYNC  */
+#line 329 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SYNC);
     }
-#line 2070 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2075 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 28: /* begin_stmt: TRX_BEGIN  */
-#line 333 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 29: /* begin_stmt: TRX_BEGIN  */
+#line 335 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                {
       (yyval.sql_node) = new ParsedSqlNode(SCF_BEGIN);
     }
-#line 2078 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2083 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 29: /* commit_stmt: TRX_COMMIT  */
-#line 339 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 30: /* commit_stmt: TRX_COMMIT  */
+#line 341 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                {
       (yyval.sql_node) = new ParsedSqlNode(SCF_COMMIT);
     }
-#line 2086 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2091 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 30: /* rollback_stmt: TRX_ROLLBACK  */
-#line 345 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 31: /* rollback_stmt: TRX_ROLLBACK  */
+#line 347 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                   {
       (yyval.sql_node) = new ParsedSqlNode(SCF_ROLLBACK);
     }
-#line 2094 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2099 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 31: /* drop_table_stmt: DROP TABLE ID  */
-#line 351 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 32: /* drop_table_stmt: DROP TABLE ID  */
+#line 353 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                   {
       (yyval.sql_node) = new ParsedSqlNode(SCF_DROP_TABLE);
       (yyval.sql_node)->drop_table.relation_name = (yyvsp[0].cstring);
     }
-#line 2103 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2108 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 32: /* analyze_table_stmt: ANALYZE TABLE ID  */
-#line 357 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 33: /* analyze_table_stmt: ANALYZE TABLE ID  */
+#line 359 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                      {
       (yyval.sql_node) = new ParsedSqlNode(SCF_ANALYZE_TABLE);
       (yyval.sql_node)->analyze_table.relation_name = (yyvsp[0].cstring);
     }
-#line 2112 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2117 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 33: /* show_tables_stmt: SHOW TABLES  */
-#line 364 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 34: /* show_tables_stmt: SHOW TABLES  */
+#line 366 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                 {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SHOW_TABLES);
     }
-#line 2120 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2125 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 34: /* desc_table_stmt: DESC ID  */
-#line 370 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 35: /* show_buffer_pool_stmt: SHOW ID ID ID  */
+#line 373 "/root/repo/src/observer/sql/parser/yacc_sql.y"
+                  {
+      bool valid = 0 == strcasecmp((yyvsp[-2].cstring), "buffer") && 0 == strcasecmp((yyvsp[-1].cstring), "pool") && 0 == strcasecmp((yyvsp[0].cstring), "status");
+      if (!valid) {
+        yyerror(&(yyloc), sql_string, sql_result, scanner, "unknown show command");
+        YYERROR;
+      }
+      (yyval.sql_node) = new ParsedSqlNode(SCF_SHOW_BUFFER_POOL);
+    }
+#line 2138 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
+    break;
+
+  case 36: /* desc_table_stmt: DESC ID  */
+#line 384 "/root/repo/src/observer/sql/parser/yacc_sql.y"
              {
       (yyval.sql_node) = new ParsedSqlNode(SCF_DESC_TABLE);
       (yyval.sql_node)->desc_table.relation_name = (yyvsp[0].cstring);
     }
-#line 2129 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2147 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 35: /* create_index_stmt: CREATE INDEX ID ON ID LBRACE attribute_name_list RBRACE  */
-#line 378 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 37: /* create_index_stmt: CREATE INDEX ID ON ID LBRACE attribute_name_list RBRACE  */
+#line 392 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_CREATE_INDEX);
       CreateIndexSqlNode &create_index = (yyval.sql_node)->create_index;
@@ -2139,11 +2157,11 @@ yyreduce:
       create_index.attribute_names = std::move (*(yyvsp[-1].key_list));
       delete (yyvsp[-1].key_list);
     }
-#line 2143 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2161 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 36: /* create_index_stmt: CREATE UNIQUE INDEX ID ON ID LBRACE attribute_name_list RBRACE  */
-#line 388 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 38: /* create_index_stmt: CREATE UNIQUE INDEX ID ON ID LBRACE attribute_name_list RBRACE  */
+#line 402 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_CREATE_INDEX);
       CreateIndexSqlNode &create_index = (yyval.sql_node)->create_index;
@@ -2153,48 +2171,48 @@ yyreduce:
       create_index.attribute_names = std::move (*(yyvsp[-1].key_list));
       delete (yyvsp[-1].key_list);
     }
-#line 2157 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2175 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 37: /* attribute_name_list: ID  */
-#line 400 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 39: /* attribute_name_list: ID  */
+#line 414 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.key_list) = new vector<string> ();
       (yyval.key_list)->push_back((yyvsp[0].cstring));
     }
-#line 2166 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2184 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 38: /* attribute_name_list: attribute_name_list COMMA ID  */
-#line 405 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 40: /* attribute_name_list: attribute_name_list COMMA ID  */
+#line 419 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.key_list) = (yyvsp[-2].key_list);
       (yyval.key_list)->push_back((yyvsp[0].cstring));
     }
-#line 2175 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2193 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 39: /* drop_index_stmt: DROP INDEX ID ON ID  */
-#line 412 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 41: /* drop_index_stmt: DROP INDEX ID ON ID  */
+#line 426 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_DROP_INDEX);
       (yyval.sql_node)->drop_index.index_name = (yyvsp[-2].cstring);
       (yyval.sql_node)->drop_index.relation_name = (yyvsp[0].cstring);
     }
-#line 2185 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2203 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 40: /* show_index_stmt: SHOW INDEX FROM ID  */
-#line 420 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 42: /* show_index_stmt: SHOW INDEX FROM ID  */
+#line 434 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SHOW_INDEX);
       (yyval.sql_node)->show_index.relation_name = (yyvsp[0].cstring);  
     }
-#line 2194 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2212 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 41: /* create_table_stmt: CREATE TABLE ID LBRACE attr_def_list primary_key RBRACE storage_format  */
-#line 427 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 43: /* create_table_stmt: CREATE TABLE ID LBRACE attr_def_list primary_key RBRACE storage_format  */
+#line 441 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_CREATE_TABLE);
       CreateTableSqlNode &create_table = (yyval.sql_node)->create_table;
@@ -2212,31 +2230,31 @@ yyreduce:
         create_table.storage_format = (yyvsp[0].cstring);
       }
     }
-#line 2216 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2234 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 42: /* attr_def_list: attr_def  */
-#line 448 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 44: /* attr_def_list: attr_def  */
+#line 462 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_infos) = new vector<AttrInfoSqlNode>;
       (yyval.attr_infos)->emplace_back(*(yyvsp[0].attr_info));
       delete (yyvsp[0].attr_info);
     }
-#line 2226 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2244 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 43: /* attr_def_list: attr_def_list COMMA attr_def  */
-#line 454 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 45: /* attr_def_list: attr_def_list COMMA attr_def  */
+#line 468 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_infos) = (yyvsp[-2].attr_infos);
       (yyval.attr_infos)->emplace_back(*(yyvsp[0].attr_info));
       delete (yyvsp[0].attr_info);
     }
-#line 2236 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2254 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 44: /* attr_def: ID type LBRACE number RBRACE nullable_spec  */
-#line 463 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 46: /* attr_def: ID type LBRACE number RBRACE nullable_spec  */
+#line 477 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_info) = new AttrInfoSqlNode;
       (yyval.attr_info)->type = (AttrType)(yyvsp[-4].number);
@@ -2248,11 +2266,11 @@ yyreduce:
       }
       (yyval.attr_info)->nullable = ((yyvsp[0].number) == 1);
     }
-#line 2252 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2270 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 45: /* attr_def: ID type nullable_spec  */
-#line 475 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 47: /* attr_def: ID type nullable_spec  */
+#line 489 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_info) = new AttrInfoSqlNode;
       (yyval.attr_info)->type = (AttrType)(yyvsp[-1].number);
@@ -2264,11 +2282,11 @@ yyreduce:
       }
       (yyval.attr_info)->nullable = ((yyvsp[0].number) == 1);
     }
-#line 2268 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2286 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 46: /* attr_def: ID type LBRACE number RBRACE  */
-#line 487 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 48: /* attr_def: ID type LBRACE number RBRACE  */
+#line 501 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_info) = new AttrInfoSqlNode;
       (yyval.attr_info)->type = (AttrType)(yyvsp[-3].number);
@@ -2280,11 +2298,11 @@ yyreduce:
       }
       (yyval.attr_info)->nullable = true;  
     }
-#line 2284 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2302 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 47: /* attr_def: ID type  */
-#line 499 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 49: /* attr_def: ID type  */
+#line 513 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.attr_info) = new AttrInfoSqlNode;
       (yyval.attr_info)->type = (AttrType)(yyvsp[0].number);
@@ -2296,90 +2314,90 @@ yyreduce:
       }
       (yyval.attr_info)->nullable = true;  
     }
-#line 2300 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2318 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 48: /* nullable_spec: NOT NULL_T  */
-#line 513 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 50: /* nullable_spec: NOT NULL_T  */
+#line 527 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                         { (yyval.number) = 0; }
-#line 2306 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2324 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 49: /* nullable_spec: %empty  */
-#line 514 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 51: /* nullable_spec: %empty  */
+#line 528 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                         { (yyval.number) = 1; }
-#line 2312 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2330 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 50: /* number: NUMBER  */
-#line 518 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 52: /* number: NUMBER  */
+#line 532 "/root/repo/src/observer/sql/parser/yacc_sql.y"
            {(yyval.number) = (yyvsp[0].number);}
-#line 2318 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2336 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 51: /* type: INT_T  */
-#line 521 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 53: /* type: INT_T  */
+#line 535 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                { (yyval.number) = static_cast<int>(AttrType::INTS); }
-#line 2324 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2342 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 52: /* type: STRING_T  */
-#line 522 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 54: /* type: STRING_T  */
+#line 536 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                { (yyval.number) = static_cast<int>(AttrType::CHARS); }
-#line 2330 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2348 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 53: /* type: FLOAT_T  */
-#line 523 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 55: /* type: FLOAT_T  */
+#line 537 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                { (yyval.number) = static_cast<int>(AttrType::FLOATS); }
-#line 2336 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2354 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 54: /* type: DATE_T  */
-#line 524 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 56: /* type: DATE_T  */
+#line 538 "/root/repo/src/observer/sql/parser/yacc_sql.y"
              { (yyval.number) = static_cast<int>(AttrType::DATES); }
-#line 2342 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2360 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 55: /* type: VECTOR_T  */
-#line 525 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 57: /* type: VECTOR_T  */
+#line 539 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                { (yyval.number) = static_cast<int>(AttrType::VECTORS); }
-#line 2348 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2366 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 56: /* type: TEXT_T  */
-#line 526 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 58: /* type: TEXT_T  */
+#line 540 "/root/repo/src/observer/sql/parser/yacc_sql.y"
              { (yyval.number) = static_cast<int>(AttrType::TEXTS); }
-#line 2354 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2372 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 57: /* primary_key: %empty  */
-#line 530 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 59: /* primary_key: %empty  */
+#line 544 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.key_list) = nullptr;
     }
-#line 2362 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2380 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 58: /* primary_key: COMMA PRIMARY KEY LBRACE attr_list RBRACE  */
-#line 534 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 60: /* primary_key: COMMA PRIMARY KEY LBRACE attr_list RBRACE  */
+#line 548 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.key_list) = (yyvsp[-1].key_list);
     }
-#line 2370 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2388 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 59: /* attr_list: ID  */
-#line 540 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 61: /* attr_list: ID  */
+#line 554 "/root/repo/src/observer/sql/parser/yacc_sql.y"
        {
       (yyval.key_list) = new vector<string>();
       (yyval.key_list)->push_back((yyvsp[0].cstring));
     }
-#line 2379 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2397 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 60: /* attr_list: ID COMMA attr_list  */
-#line 544 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 62: /* attr_list: ID COMMA attr_list  */
+#line 558 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                          {
       if ((yyvsp[0].key_list) != nullptr) {
         (yyval.key_list) = (yyvsp[0].key_list);
@@ -2389,60 +2407,60 @@ yyreduce:
 
       (yyval.key_list)->insert((yyval.key_list)->begin(), (yyvsp[-2].cstring));
     }
-#line 2393 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2411 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 61: /* insert_stmt: INSERT INTO ID VALUES LBRACE value_list RBRACE  */
-#line 557 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 63: /* insert_stmt: INSERT INTO ID VALUES LBRACE value_list RBRACE  */
+#line 571 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_INSERT);
       (yyval.sql_node)->insertion.relation_name = (yyvsp[-4].cstring);
       (yyval.sql_node)->insertion.values.swap(*(yyvsp[-1].value_list));
       delete (yyvsp[-1].value_list);
     }
-#line 2404 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2422 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 62: /* value_list: value  */
-#line 567 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 64: /* value_list: value  */
+#line 581 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.value_list) = new vector<Value>;
       (yyval.value_list)->emplace_back(*(yyvsp[0].value));
       delete (yyvsp[0].value);
     }
-#line 2414 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2432 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 63: /* value_list: value_list COMMA value  */
-#line 572 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 65: /* value_list: value_list COMMA value  */
+#line 586 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                              { 
       (yyval.value_list) = (yyvsp[-2].value_list);
       (yyval.value_list)->emplace_back(*(yyvsp[0].value));
       delete (yyvsp[0].value);
     }
-#line 2424 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2442 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 64: /* value: NUMBER  */
-#line 579 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 66: /* value: NUMBER  */
+#line 593 "/root/repo/src/observer/sql/parser/yacc_sql.y"
            {
       (yyval.value) = new Value((int)(yyvsp[0].number));
       (yyloc) = (yylsp[0]);
     }
-#line 2433 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2451 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 65: /* value: FLOAT  */
-#line 583 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 67: /* value: FLOAT  */
+#line 597 "/root/repo/src/observer/sql/parser/yacc_sql.y"
            {
       (yyval.value) = new Value((float)(yyvsp[0].floats));
       (yyloc) = (yylsp[0]);
     }
-#line 2442 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2460 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 66: /* value: SSS  */
-#line 587 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 68: /* value: SSS  */
+#line 601 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          {
       char *tmp = common::substr((yyvsp[0].cstring),1,strlen((yyvsp[0].cstring))-2);
       size_t str_len = strlen(tmp);
@@ -2453,22 +2471,22 @@ yyreduce:
       (yyval.value) = new Value(tmp, str_len);
       free(tmp);
     }
-#line 2457 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2475 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 67: /* value: NULL_T  */
-#line 597 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 69: /* value: NULL_T  */
+#line 611 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             {
       (yyval.value) = new Value();
       (yyval.value)->set_null();
       (yyval.value)->set_type(AttrType::UNDEFINED);  // NULL值类型标识
       (yyloc) = (yylsp[0]);
     }
-#line 2468 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2486 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 68: /* value: VECTOR_LITERAL  */
-#line 603 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 70: /* value: VECTOR_LITERAL  */
+#line 617 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                     {
        std::vector<float> elements;
        RC rc = parse_vector_literal((yyvsp[0].cstring), elements);
@@ -2480,27 +2498,27 @@ yyreduce:
        (yyval.value)->set_vector(elements);
        (yyloc) = (yylsp[0]);
     }
-#line 2484 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2502 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 69: /* storage_format: %empty  */
-#line 617 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 71: /* storage_format: %empty  */
+#line 631 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.cstring) = nullptr;
     }
-#line 2492 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2510 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 70: /* storage_format: STORAGE FORMAT EQ ID  */
-#line 621 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 72: /* storage_format: STORAGE FORMAT EQ ID  */
+#line 635 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.cstring) = (yyvsp[0].cstring);
     }
-#line 2500 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2518 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 71: /* delete_stmt: DELETE FROM ID where  */
-#line 628 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 73: /* delete_stmt: DELETE FROM ID where  */
+#line 642 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_DELETE);
       (yyval.sql_node)->deletion.relation_name = (yyvsp[-1].cstring);
@@ -2509,11 +2527,11 @@ yyreduce:
         delete (yyvsp[0].condition_list);
       }
     }
-#line 2513 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2531 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 72: /* update_stmt: UPDATE ID SET update_list where  */
-#line 639 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 74: /* update_stmt: UPDATE ID SET update_list where  */
+#line 653 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_UPDATE);
       (yyval.sql_node)->update.relation_name = (yyvsp[-3].cstring);
@@ -2526,33 +2544,33 @@ yyreduce:
       delete (yyvsp[-1].update_list);
       // 不需要 free($2)，sql_parse 会统一清理 allocated_strings
     }
-#line 2530 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2548 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 73: /* update_list: ID EQ expression  */
-#line 655 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 75: /* update_list: ID EQ expression  */
+#line 669 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.update_list) = new UpdateList();
       (yyval.update_list)->attribute_names.push_back((yyvsp[-2].cstring));
       (yyval.update_list)->expressions.push_back((yyvsp[0].expression));
       // 不需要 free($1)，sql_parse 会统一清理 allocated_strings
     }
-#line 2541 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2559 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 74: /* update_list: update_list COMMA ID EQ expression  */
-#line 662 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 76: /* update_list: update_list COMMA ID EQ expression  */
+#line 676 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.update_list) = (yyvsp[-4].update_list);
       (yyval.update_list)->attribute_names.push_back((yyvsp[-2].cstring));
       (yyval.update_list)->expressions.push_back((yyvsp[0].expression));
       // 不需要 free($3)，sql_parse 会统一清理 allocated_strings
     }
-#line 2552 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2570 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 75: /* select_stmt: SELECT expression_list FROM rel_list join_list where group_by having  */
-#line 672 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 77: /* select_stmt: SELECT expression_list FROM rel_list join_list where group_by having  */
+#line 686 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SELECT);
       if ((yyvsp[-6].expression_list) != nullptr) {
@@ -2585,11 +2603,11 @@ yyreduce:
         delete (yyvsp[0].condition_list);
       }
     }
-#line 2589 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2607 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 76: /* select_stmt: SELECT expression_list WHERE condition_list  */
-#line 705 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 78: /* select_stmt: SELECT expression_list WHERE condition_list  */
+#line 719 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SELECT);
       if ((yyvsp[-2].expression_list) != nullptr) {
@@ -2603,11 +2621,11 @@ yyreduce:
       }
       // 不设置relations，表示没有FROM子句
     }
-#line 2607 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2625 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 77: /* select_stmt: SELECT expression_list  */
-#line 719 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 79: /* select_stmt: SELECT expression_list  */
+#line 733 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SELECT);
       if ((yyvsp[0].expression_list) != nullptr) {
@@ -2616,30 +2634,30 @@ yyreduce:
       }
       // 不设置relations，表示没有FROM子句
     }
-#line 2620 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2638 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 78: /* calc_stmt: CALC expression_list  */
-#line 730 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 80: /* calc_stmt: CALC expression_list  */
+#line 744 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_CALC);
       (yyval.sql_node)->calc.expressions.swap(*(yyvsp[0].expression_list));
       delete (yyvsp[0].expression_list);
     }
-#line 2630 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2648 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 79: /* expression_list: expression  */
-#line 739 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 81: /* expression_list: expression  */
+#line 753 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.expression_list) = new vector<unique_ptr<Expression>>;
       (yyval.expression_list)->emplace_back((yyvsp[0].expression));
     }
-#line 2639 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2657 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 80: /* expression_list: expression COMMA expression_list  */
-#line 744 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 82: /* expression_list: expression COMMA expression_list  */
+#line 758 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       if ((yyvsp[0].expression_list) != nullptr) {
         (yyval.expression_list) = (yyvsp[0].expression_list);
@@ -2648,149 +2666,149 @@ yyreduce:
       }
       (yyval.expression_list)->emplace((yyval.expression_list)->begin(), (yyvsp[-2].expression));
     }
-#line 2652 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2670 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 81: /* expression: expression '+' expression  */
-#line 754 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 83: /* expression: expression '+' expression  */
+#line 768 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                               {
       (yyval.expression) = create_arithmetic_expression(ArithmeticExpr::Type::ADD, (yyvsp[-2].expression), (yyvsp[0].expression), sql_string, &(yyloc));
     }
-#line 2660 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2678 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 82: /* expression: expression '-' expression  */
-#line 757 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 84: /* expression: expression '-' expression  */
+#line 771 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                 {
       (yyval.expression) = create_arithmetic_expression(ArithmeticExpr::Type::SUB, (yyvsp[-2].expression), (yyvsp[0].expression), sql_string, &(yyloc));
     }
-#line 2668 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2686 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 83: /* expression: expression '*' expression  */
-#line 760 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 85: /* expression: expression '*' expression  */
+#line 774 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                 {
       (yyval.expression) = create_arithmetic_expression(ArithmeticExpr::Type::MUL, (yyvsp[-2].expression), (yyvsp[0].expression), sql_string, &(yyloc));
     }
-#line 2676 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2694 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 84: /* expression: expression '/' expression  */
-#line 763 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 86: /* expression: expression '/' expression  */
+#line 777 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                 {
       printf("DEBUG: Creating DIV expression\n");
       (yyval.expression) = create_arithmetic_expression(ArithmeticExpr::Type::DIV, (yyvsp[-2].expression), (yyvsp[0].expression), sql_string, &(yyloc));
     }
-#line 2685 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2703 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 85: /* expression: LBRACE expression RBRACE  */
-#line 767 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 87: /* expression: LBRACE expression RBRACE  */
+#line 781 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                {
       (yyval.expression) = (yyvsp[-1].expression);
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
     }
-#line 2694 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2712 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 86: /* expression: '-' expression  */
-#line 771 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 88: /* expression: '-' expression  */
+#line 785 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                   {
       (yyval.expression) = create_arithmetic_expression(ArithmeticExpr::Type::NEGATIVE, (yyvsp[0].expression), nullptr, sql_string, &(yyloc));
     }
-#line 2702 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2720 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 87: /* expression: value  */
-#line 774 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 89: /* expression: value  */
+#line 788 "/root/repo/src/observer/sql/parser/yacc_sql.y"
             {
       (yyval.expression) = new ValueExpr(*(yyvsp[0].value));
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[0].value);
     }
-#line 2712 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2730 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 88: /* expression: rel_attr  */
-#line 779 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 90: /* expression: rel_attr  */
+#line 793 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                {
       RelAttrSqlNode *node = (yyvsp[0].rel_attr);
       (yyval.expression) = new UnboundFieldExpr(node->relation_name, node->attribute_name);
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[0].rel_attr);
     }
-#line 2723 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2741 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 89: /* expression: '*'  */
-#line 785 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 91: /* expression: '*'  */
+#line 799 "/root/repo/src/observer/sql/parser/yacc_sql.y"
           {
       (yyval.expression) = new StarExpr();
     }
-#line 2731 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2749 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 90: /* expression: COUNT LBRACE '*' RBRACE  */
-#line 788 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 92: /* expression: COUNT LBRACE '*' RBRACE  */
+#line 802 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                               {
       (yyval.expression) = create_aggregate_expression("count", new StarExpr(), sql_string, &(yyloc));
     }
-#line 2739 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2757 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 91: /* expression: COUNT LBRACE expression RBRACE  */
-#line 791 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 93: /* expression: COUNT LBRACE expression RBRACE  */
+#line 805 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                      {
       (yyval.expression) = create_aggregate_expression("count", (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2747 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2765 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 92: /* expression: SUM LBRACE expression RBRACE  */
-#line 794 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 94: /* expression: SUM LBRACE expression RBRACE  */
+#line 808 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                    {
       (yyval.expression) = create_aggregate_expression("sum", (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2755 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2773 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 93: /* expression: AVG LBRACE expression RBRACE  */
-#line 797 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 95: /* expression: AVG LBRACE expression RBRACE  */
+#line 811 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                    {
       (yyval.expression) = create_aggregate_expression("avg", (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2763 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2781 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 94: /* expression: MAX LBRACE expression RBRACE  */
-#line 800 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 96: /* expression: MAX LBRACE expression RBRACE  */
+#line 814 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                    {
       (yyval.expression) = create_aggregate_expression("max", (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2771 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2789 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 95: /* expression: MIN LBRACE expression RBRACE  */
-#line 803 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 97: /* expression: MIN LBRACE expression RBRACE  */
+#line 817 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                    {
       (yyval.expression) = create_aggregate_expression("min", (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2779 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2797 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 96: /* expression: LBRACE select_stmt RBRACE  */
-#line 806 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 98: /* expression: LBRACE select_stmt RBRACE  */
+#line 820 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                 {
       // 子查询表达式
       (yyval.expression) = new SubqueryExpr(SelectSqlNode::create_copy(&((yyvsp[-1].sql_node)->selection)));
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[-1].sql_node);
     }
-#line 2790 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2808 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 97: /* expression: expression IN LBRACE expression_list RBRACE  */
-#line 812 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 99: /* expression: expression IN LBRACE expression_list RBRACE  */
+#line 826 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                   {
       // IN (value_list) 表达式
       vector<unique_ptr<Expression>> value_list;
@@ -2801,11 +2819,11 @@ yyreduce:
       (yyval.expression) = new InExpr(false, unique_ptr<Expression>((yyvsp[-4].expression)), std::move(value_list));
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
     }
-#line 2805 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2823 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 98: /* expression: expression NOT IN LBRACE expression_list RBRACE  */
-#line 822 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 100: /* expression: expression NOT IN LBRACE expression_list RBRACE  */
+#line 836 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                       {
       // NOT IN (value_list) 表达式
       vector<unique_ptr<Expression>> value_list;
@@ -2816,11 +2834,11 @@ yyreduce:
       (yyval.expression) = new InExpr(true, unique_ptr<Expression>((yyvsp[-5].expression)), std::move(value_list));
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
     }
-#line 2820 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2838 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 99: /* expression: expression IN LBRACE select_stmt RBRACE  */
-#line 832 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 101: /* expression: expression IN LBRACE select_stmt RBRACE  */
+#line 846 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                               {
       // IN (SELECT ...) 表达式
       auto subquery = new SubqueryExpr(SelectSqlNode::create_copy(&((yyvsp[-1].sql_node)->selection)));
@@ -2828,11 +2846,11 @@ yyreduce:
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[-1].sql_node);
     }
-#line 2832 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2850 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 100: /* expression: expression NOT IN LBRACE select_stmt RBRACE  */
-#line 839 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 102: /* expression: expression NOT IN LBRACE select_stmt RBRACE  */
+#line 853 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                   {
       // NOT IN (SELECT ...) 表达式
       auto subquery = new SubqueryExpr(SelectSqlNode::create_copy(&((yyvsp[-1].sql_node)->selection)));
@@ -2840,11 +2858,11 @@ yyreduce:
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[-1].sql_node);
     }
-#line 2844 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2862 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 101: /* expression: EXISTS LBRACE select_stmt RBRACE  */
-#line 846 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 103: /* expression: EXISTS LBRACE select_stmt RBRACE  */
+#line 860 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                        {
       // EXISTS (SELECT ...) 表达式
       auto subquery = new SubqueryExpr(SelectSqlNode::create_copy(&((yyvsp[-1].sql_node)->selection)));
@@ -2852,11 +2870,11 @@ yyreduce:
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[-1].sql_node);
     }
-#line 2856 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2874 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 102: /* expression: NOT EXISTS LBRACE select_stmt RBRACE  */
-#line 853 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 104: /* expression: NOT EXISTS LBRACE select_stmt RBRACE  */
+#line 867 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                            {
       // NOT EXISTS (SELECT ...) 表达式
       auto subquery = new SubqueryExpr(SelectSqlNode::create_copy(&((yyvsp[-1].sql_node)->selection)));
@@ -2864,71 +2882,71 @@ yyreduce:
       (yyval.expression)->set_name(token_name(sql_string, &(yyloc)));
       delete (yyvsp[-1].sql_node);
     }
-#line 2868 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2886 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 103: /* expression: L2_DISTANCE LBRACE expression COMMA expression RBRACE  */
-#line 860 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 105: /* expression: L2_DISTANCE LBRACE expression COMMA expression RBRACE  */
+#line 874 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                             {
       (yyval.expression) = create_distance_function_expression(DistanceFunctionExpr::Type::L2_DISTANCE, (yyvsp[-3].expression), (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2876 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2894 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 104: /* expression: COSINE_DISTANCE LBRACE expression COMMA expression RBRACE  */
-#line 863 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 106: /* expression: COSINE_DISTANCE LBRACE expression COMMA expression RBRACE  */
+#line 877 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                                 {
       (yyval.expression) = create_distance_function_expression(DistanceFunctionExpr::Type::COSINE_DISTANCE, (yyvsp[-3].expression), (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2884 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2902 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 105: /* expression: INNER_PRODUCT LBRACE expression COMMA expression RBRACE  */
-#line 866 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 107: /* expression: INNER_PRODUCT LBRACE expression COMMA expression RBRACE  */
+#line 880 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                               {
       (yyval.expression) = create_distance_function_expression(DistanceFunctionExpr::Type::INNER_PRODUCT, (yyvsp[-3].expression), (yyvsp[-1].expression), sql_string, &(yyloc));
     }
-#line 2892 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2910 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 106: /* rel_attr: ID  */
-#line 872 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 108: /* rel_attr: ID  */
+#line 886 "/root/repo/src/observer/sql/parser/yacc_sql.y"
        {
       (yyval.rel_attr) = new RelAttrSqlNode;
       (yyval.rel_attr)->attribute_name = (yyvsp[0].cstring);
     }
-#line 2901 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2919 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 107: /* rel_attr: ID DOT ID  */
-#line 876 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 109: /* rel_attr: ID DOT ID  */
+#line 890 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                 {
       (yyval.rel_attr) = new RelAttrSqlNode;
       (yyval.rel_attr)->relation_name  = (yyvsp[-2].cstring);
       (yyval.rel_attr)->attribute_name = (yyvsp[0].cstring);
     }
-#line 2911 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2929 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 108: /* relation: ID  */
-#line 884 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 110: /* relation: ID  */
+#line 898 "/root/repo/src/observer/sql/parser/yacc_sql.y"
        {
       (yyval.cstring) = (yyvsp[0].cstring);
     }
-#line 2919 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2937 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 109: /* rel_list: relation  */
-#line 889 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 111: /* rel_list: relation  */
+#line 903 "/root/repo/src/observer/sql/parser/yacc_sql.y"
              {
       (yyval.relation_list) = new vector<string>();
       (yyval.relation_list)->push_back((yyvsp[0].cstring));
     }
-#line 2928 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2946 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 110: /* rel_list: relation COMMA rel_list  */
-#line 893 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 112: /* rel_list: relation COMMA rel_list  */
+#line 907 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                               {
       if ((yyvsp[0].relation_list) != nullptr) {
         (yyval.relation_list) = (yyvsp[0].relation_list);
@@ -2938,61 +2956,61 @@ yyreduce:
 
       (yyval.relation_list)->insert((yyval.relation_list)->begin(), (yyvsp[-2].cstring));
     }
-#line 2942 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2960 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 111: /* where: %empty  */
-#line 906 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 113: /* where: %empty  */
+#line 920 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.condition_list) = nullptr;
     }
-#line 2950 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2968 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 112: /* where: WHERE condition_list  */
-#line 909 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 114: /* where: WHERE condition_list  */
+#line 923 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                            {
       (yyval.condition_list) = (yyvsp[0].condition_list);  
     }
-#line 2958 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2976 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 113: /* having: %empty  */
-#line 915 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 115: /* having: %empty  */
+#line 929 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.condition_list) = nullptr;
     }
-#line 2966 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2984 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 114: /* having: HAVING condition_list  */
-#line 918 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 116: /* having: HAVING condition_list  */
+#line 932 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                             {
       (yyval.condition_list) = (yyvsp[0].condition_list);
     }
-#line 2974 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 2992 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 115: /* condition_list: %empty  */
-#line 924 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 117: /* condition_list: %empty  */
+#line 938 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.condition_list) = nullptr;
     }
-#line 2982 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3000 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 116: /* condition_list: condition  */
-#line 927 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 118: /* condition_list: condition  */
+#line 941 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                 {
       (yyval.condition_list) = new vector<ConditionSqlNode>;
       (yyval.condition_list)->push_back(*(yyvsp[0].condition));
       delete (yyvsp[0].condition);
     }
-#line 2992 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3010 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 117: /* condition_list: condition AND condition_list  */
-#line 932 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 119: /* condition_list: condition AND condition_list  */
+#line 946 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                    {
       if ((yyvsp[0].condition_list) == nullptr) {
         (yyval.condition_list) = new vector<ConditionSqlNode>;
@@ -3002,11 +3020,11 @@ yyreduce:
       (yyval.condition_list)->insert((yyval.condition_list)->begin(), *(yyvsp[-2].condition));
       delete (yyvsp[-2].condition);
     }
-#line 3006 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3024 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 118: /* condition: expression comp_op expression  */
-#line 944 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 120: /* condition: expression comp_op expression  */
+#line 958 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       printf("DEBUG: unified condition expression comp_op expression\n");
       (yyval.condition) = new ConditionSqlNode;
@@ -3019,11 +3037,11 @@ yyreduce:
       (yyval.condition)->left_is_attr = 0;
       (yyval.condition)->right_is_attr = 0;
     }
-#line 3023 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3041 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 119: /* condition: expression IS NULL_T  */
-#line 957 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 121: /* condition: expression IS NULL_T  */
+#line 971 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       printf("DEBUG: IS NULL condition\n");
       (yyval.condition) = new ConditionSqlNode;
@@ -3036,11 +3054,11 @@ yyreduce:
       (yyval.condition)->left_is_attr = 0;
       (yyval.condition)->right_is_attr = 0;
     }
-#line 3040 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3058 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 120: /* condition: expression IS NOT NULL_T  */
-#line 970 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 122: /* condition: expression IS NOT NULL_T  */
+#line 984 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       printf("DEBUG: IS NOT NULL condition\n");
       (yyval.condition) = new ConditionSqlNode;
@@ -3053,11 +3071,11 @@ yyreduce:
       (yyval.condition)->left_is_attr = 0;
       (yyval.condition)->right_is_attr = 0;
     }
-#line 3057 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3075 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 121: /* condition: expression  */
-#line 983 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 123: /* condition: expression  */
+#line 997 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       printf("DEBUG: single expression condition\n");
       (yyval.condition) = new ConditionSqlNode;
@@ -3070,59 +3088,59 @@ yyreduce:
       (yyval.condition)->left_is_attr = 0;
       (yyval.condition)->right_is_attr = 0;
     }
-#line 3074 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3092 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 122: /* comp_op: EQ  */
-#line 998 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 124: /* comp_op: EQ  */
+#line 1012 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = EQUAL_TO; }
-#line 3080 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3098 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 123: /* comp_op: LT  */
-#line 999 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 125: /* comp_op: LT  */
+#line 1013 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = LESS_THAN; }
-#line 3086 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3104 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 124: /* comp_op: GT  */
-#line 1000 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 126: /* comp_op: GT  */
+#line 1014 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = GREAT_THAN; }
-#line 3092 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3110 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 125: /* comp_op: LE  */
-#line 1001 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 127: /* comp_op: LE  */
+#line 1015 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = LESS_EQUAL; }
-#line 3098 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3116 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 126: /* comp_op: GE  */
-#line 1002 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 128: /* comp_op: GE  */
+#line 1016 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = GREAT_EQUAL; }
-#line 3104 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3122 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 127: /* comp_op: NE  */
-#line 1003 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 129: /* comp_op: NE  */
+#line 1017 "/root/repo/src/observer/sql/parser/yacc_sql.y"
          { (yyval.comp) = NOT_EQUAL; }
-#line 3110 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3128 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 128: /* comp_op: LIKE  */
-#line 1004 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 130: /* comp_op: LIKE  */
+#line 1018 "/root/repo/src/observer/sql/parser/yacc_sql.y"
            { (yyval.comp) = LIKE_OP; }
-#line 3116 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3134 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 129: /* comp_op: NOT LIKE  */
-#line 1005 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 131: /* comp_op: NOT LIKE  */
+#line 1019 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                { (yyval.comp) = NOT_LIKE_OP; }
-#line 3122 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3140 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 130: /* on_conditions: expression comp_op expression  */
-#line 1010 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 132: /* on_conditions: expression comp_op expression  */
+#line 1024 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                   {
       (yyval.condition_list) = new vector<ConditionSqlNode>;
       ConditionSqlNode *cond = new ConditionSqlNode;
@@ -3135,11 +3153,11 @@ yyreduce:
       (yyval.condition_list)->push_back(*cond);
       delete cond;
     }
-#line 3139 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3157 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 131: /* on_conditions: expression comp_op expression AND on_conditions  */
-#line 1022 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 133: /* on_conditions: expression comp_op expression AND on_conditions  */
+#line 1036 "/root/repo/src/observer/sql/parser/yacc_sql.y"
                                                       {
       if ((yyvsp[0].condition_list) == nullptr) {
         (yyval.condition_list) = new vector<ConditionSqlNode>;
@@ -3155,19 +3173,19 @@ yyreduce:
       cond.right_is_attr = 0;
       (yyval.condition_list)->insert((yyval.condition_list)->begin(), cond);
     }
-#line 3159 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3177 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 132: /* join_list: %empty  */
-#line 1042 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 134: /* join_list: %empty  */
+#line 1056 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.join_list) = nullptr;
     }
-#line 3167 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3185 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 133: /* join_list: INNER JOIN relation ON on_conditions  */
-#line 1046 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 135: /* join_list: INNER JOIN relation ON on_conditions  */
+#line 1060 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.join_list) = new vector<JoinSqlNode>;
       JoinSqlNode join_node;
@@ -3182,11 +3200,11 @@ yyreduce:
       
       (yyval.join_list)->push_back(join_node);
     }
-#line 3186 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3204 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 134: /* join_list: join_list INNER JOIN relation ON on_conditions  */
-#line 1061 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 136: /* join_list: join_list INNER JOIN relation ON on_conditions  */
+#line 1075 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       if ((yyvsp[-5].join_list) != nullptr) {
         (yyval.join_list) = (yyvsp[-5].join_list);
@@ -3206,27 +3224,27 @@ yyreduce:
       
       (yyval.join_list)->push_back(join_node);
     }
-#line 3210 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3228 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 135: /* group_by: %empty  */
-#line 1084 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 137: /* group_by: %empty  */
+#line 1098 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.expression_list) = nullptr;
     }
-#line 3218 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3236 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 136: /* group_by: GROUP BY expression_list  */
-#line 1088 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 138: /* group_by: GROUP BY expression_list  */
+#line 1102 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.expression_list) = (yyvsp[0].expression_list); 
     }
-#line 3226 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3244 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 137: /* load_data_stmt: LOAD DATA INFILE SSS INTO TABLE ID  */
-#line 1094 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 139: /* load_data_stmt: LOAD DATA INFILE SSS INTO TABLE ID  */
+#line 1108 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       char *tmp_file_name = common::substr((yyvsp[-3].cstring), 1, strlen((yyvsp[-3].cstring)) - 2);
       
@@ -3235,31 +3253,31 @@ yyreduce:
       (yyval.sql_node)->load_data.file_name = tmp_file_name;
       free(tmp_file_name);
     }
-#line 3239 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3257 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 138: /* explain_stmt: EXPLAIN command_wrapper  */
-#line 1106 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 140: /* explain_stmt: EXPLAIN command_wrapper  */
+#line 1120 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_EXPLAIN);
       (yyval.sql_node)->explain.sql_node = unique_ptr<ParsedSqlNode>((yyvsp[0].sql_node));
     }
-#line 3248 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3266 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
-  case 139: /* set_variable_stmt: SET ID EQ value  */
-#line 1114 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+  case 141: /* set_variable_stmt: SET ID EQ value  */
+#line 1128 "/root/repo/src/observer/sql/parser/yacc_sql.y"
     {
       (yyval.sql_node) = new ParsedSqlNode(SCF_SET_VARIABLE);
       (yyval.sql_node)->set_variable.name  = (yyvsp[-2].cstring);
       (yyval.sql_node)->set_variable.value = *(yyvsp[0].value);
       delete (yyvsp[0].value);
     }
-#line 3259 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3277 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
     break;
 
 
-#line 3263 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.cpp"
+#line 3281 "/root/repo/src/observer/sql/parser/yacc_sql.cpp"
 
       default: break;
     }
@@ -3488,7 +3506,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 1125 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 1139 "/root/repo/src/observer/sql/parser/yacc_sql.y"
 
 //_____________________________________________________________________
 extern void scan_string(const char *str, yyscan_t scanner);
@@ -35,8 +35,8 @@
    especially those whose name start with YY_ or yy_.  They are
    private implementation details that can be changed or removed.  */
 
-#ifndef YY_YY_HOME_SUYE_MINIOB_MINIOB_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED
-# define YY_YY_HOME_SUYE_MINIOB_MINIOB_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED
+#ifndef YY_YY_ROOT_REPO_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED
+# define YY_YY_ROOT_REPO_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
@@ -143,7 +143,7 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 182 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.y"
+#line 182 "/root/repo/src/observer/sql/parser/yacc_sql.y"
 
   ParsedSqlNode *                            sql_node;                // SQL节点指针
   ConditionSqlNode *                         condition;               // 条件节点指针 
@@ -165,7 +165,7 @@ union YYSTYPE
   int                                        number;                  // 整数
   float                                      floats;                  // 浮点数
 
-#line 169 "/home/suye/MiniOB/miniob/src/observer/sql/parser/yacc_sql.hpp"
+#line 169 "/root/repo/src/observer/sql/parser/yacc_sql.hpp"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -193,4 +193,4 @@ struct YYLTYPE
 int yyparse (const char * sql_string, ParsedSqlResult * sql_result, void * scanner);
 
 
-#endif /* !YY_YY_HOME_SUYE_MINIOB_MINIOB_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED  */
+#endif /* !YY_YY_ROOT_REPO_SRC_OBSERVER_SQL_PARSER_YACC_SQL_HPP_INCLUDED  */
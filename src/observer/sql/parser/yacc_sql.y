@@ -257,6 +257,7 @@ ComparisonExpr *create_comparison_expression(CompOp comp_op,
 %type <sql_node>            drop_table_stmt
 %type <sql_node>            analyze_table_stmt
 %type <sql_node>            show_tables_stmt
+%type <sql_node>            show_buffer_pool_stmt
 %type <sql_node>            desc_table_stmt
 %type <sql_node>            create_index_stmt
 %type <sql_node>            show_index_stmt
@@ -297,6 +298,7 @@ command_wrapper:
   | drop_table_stmt
   | analyze_table_stmt
   | show_tables_stmt
+  | show_buffer_pool_stmt
   | show_index_stmt
   | desc_table_stmt
   | create_index_stmt
@@ -366,6 +368,18 @@ show_tables_stmt:
     }
     ;
 
+show_buffer_pool_stmt:
+    /* BUFFER POOL STATUS 不是关键字，避免影响使用这些单词作为表名或者字段名 */
+    SHOW ID ID ID {
+      bool valid = 0 == strcasecmp($2, "buffer") && 0 == strcasecmp($3, "pool") && 0 == strcasecmp($4, "status");
+      if (!valid) {
+        yyerror(&@$, sql_string, sql_result, scanner, "unknown show command");
+        YYERROR;
+      }
+      $$ = new ParsedSqlNode(SCF_SHOW_BUFFER_POOL);
+    }
+    ;
+
 desc_table_stmt:
     DESC ID  {
       $$ = new ParsedSqlNode(SCF_DESC_TABLE);
@@ -29,6 +29,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/stmt/update_stmt.h"
 #include "sql/stmt/select_stmt.h"
 #include "sql/stmt/set_variable_stmt.h"
+#include "sql/stmt/show_buffer_pool_stmt.h"
 #include "sql/stmt/show_tables_stmt.h"
 #include "sql/stmt/show_index_stmt.h"
 #include "sql/stmt/trx_begin_stmt.h"
@@ -98,6 +99,10 @@ RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
       return ShowTablesStmt::create(db, stmt);
     }
 
+    case SCF_SHOW_BUFFER_POOL: {
+      return ShowBufferPoolStmt::create(db, stmt);
+    }
+
     case SCF_SHOW_INDEX: {
       return ShowIndexStmt::create(db, sql_node.show_index, stmt);
     }
@@ -34,29 +34,30 @@ class InsertStmt;
  * @brief Statement的类型
  *
  */
-#define DEFINE_ENUM()             \
-  DEFINE_ENUM_ITEM(CALC)          \
-  DEFINE_ENUM_ITEM(SELECT)        \
-  DEFINE_ENUM_ITEM(INSERT)        \
-  DEFINE_ENUM_ITEM(UPDATE)        \
-  DEFINE_ENUM_ITEM(DELETE)        \
-  DEFINE_ENUM_ITEM(CREATE_TABLE)  \
-  DEFINE_ENUM_ITEM(DROP_TABLE)    \
-  DEFINE_ENUM_ITEM(ANALYZE_TABLE) \
-  DEFINE_ENUM_ITEM(CREATE_INDEX)  \
-  DEFINE_ENUM_ITEM(DROP_INDEX)    \
-  DEFINE_ENUM_ITEM(SHOW_INDEX)    \
-  DEFINE_ENUM_ITEM(SYNC)          \
-  DEFINE_ENUM_ITEM(SHOW_TABLES)   \
-  DEFINE_ENUM_ITEM(DESC_TABLE)    \
-  DEFINE_ENUM_ITEM(BEGIN)         \
-  DEFINE_ENUM_ITEM(COMMIT)        \
-  DEFINE_ENUM_ITEM(ROLLBACK)      \
-  DEFINE_ENUM_ITEM(LOAD_DATA)     \
-  DEFINE_ENUM_ITEM(HELP)          \
-  DEFINE_ENUM_ITEM(EXIT)          \
-  DEFINE_ENUM_ITEM(EXPLAIN)       \
-  DEFINE_ENUM_ITEM(PREDICATE)     \
+#define DEFINE_ENUM()                \
+  DEFINE_ENUM_ITEM(CALC)             \
+  DEFINE_ENUM_ITEM(SELECT)           \
+  DEFINE_ENUM_ITEM(INSERT)           \
+  DEFINE_ENUM_ITEM(UPDATE)           \
+  DEFINE_ENUM_ITEM(DELETE)           \
+  DEFINE_ENUM_ITEM(CREATE_TABLE)     \
+  DEFINE_ENUM_ITEM(DROP_TABLE)       \
+  DEFINE_ENUM_ITEM(ANALYZE_TABLE)    \
+  DEFINE_ENUM_ITEM(CREATE_INDEX)     \
+  DEFINE_ENUM_ITEM(DROP_INDEX)       \
+  DEFINE_ENUM_ITEM(SHOW_INDEX)       \
+  DEFINE_ENUM_ITEM(SYNC)             \
+  DEFINE_ENUM_ITEM(SHOW_TABLES)      \
+  DEFINE_ENUM_ITEM(SHOW_BUFFER_POOL) \
+  DEFINE_ENUM_ITEM(DESC_TABLE)       \
+  DEFINE_ENUM_ITEM(BEGIN)            \
+  DEFINE_ENUM_ITEM(COMMIT)           \
+  DEFINE_ENUM_ITEM(ROLLBACK)         \
+  DEFINE_ENUM_ITEM(LOAD_DATA)        \
+  DEFINE_ENUM_ITEM(HELP)             \
+  DEFINE_ENUM_ITEM(EXIT)             \
+  DEFINE_ENUM_ITEM(EXPLAIN)          \
+  DEFINE_ENUM_ITEM(PREDICATE)        \
   DEFINE_ENUM_ITEM(SET_VARIABLE)
 
 enum class StmtType
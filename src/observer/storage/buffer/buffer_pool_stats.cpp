@@ -0,0 +1,36 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/buffer/buffer_pool_stats.h"
+
+int BufferPoolStats::slot_index()
+{
+  static atomic<int> next_slot{0};
+  thread_local int   index = next_slot.fetch_add(1, memory_order_relaxed) % SLOT_NUM;
+  return index;
+}
+
+int64_t BufferPoolStats::get(Counter counter) const
+{
+  int64_t value = 0;
+  for (const Slot &slot : slots_) {
+    value += slot.values[static_cast<int>(counter)].load(memory_order_relaxed);
+  }
+  return value;
+}
+
+void BufferPoolStats::reset()
+{
+  for (Slot &slot : slots_) {
+    for (auto &value : slot.values) {
+      value.store(0, memory_order_relaxed);
+    }
+  }
+}
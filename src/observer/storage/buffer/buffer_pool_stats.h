@@ -0,0 +1,126 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/atomic.h"
+#include "common/lang/chrono.h"
+#include "common/lang/string.h"
+
+/**
+ * @brief buffer pool 的统计信息
+ * @ingroup BufferPool
+ * @details 统计项在每次访问页面时都会修改，如果所有线程都修改同一个计数器，缓存行会在CPU之间
+ * 来回传递。这里给每个线程分配一个独立的槽位(按缓存行对齐)，线程只修改自己的槽位，读取时再把
+ * 所有槽位加起来。线程个数超过槽位个数时，多个线程会共用一个槽位，计数依然是准确的。
+ */
+class BufferPoolStats
+{
+public:
+  enum class Counter
+  {
+    HIT,          ///< 访问页面时在内存中找到
+    MISS,         ///< 访问页面时不在内存中
+    EVICT,        ///< 为了加载新的页面淘汰的页帧个数
+    PIN_WAIT,     ///< 分配页帧时所有页帧都被pin住，需要重试的次数
+    READ,         ///< 从文件中读取页面的次数
+    READ_TIME,    ///< 从文件中读取页面的总耗时，单位纳秒
+    WRITE,        ///< 向文件写入页面的次数
+    WRITE_TIME,   ///< 向文件写入页面的总耗时，单位纳秒
+    COUNTER_NUM,
+  };
+
+  BufferPoolStats()  = default;
+  ~BufferPoolStats() = default;
+
+  void add(Counter counter, int64_t value = 1)
+  {
+    slots_[slot_index()].values[static_cast<int>(counter)].fetch_add(value, memory_order_relaxed);
+  }
+
+  /**
+   * @brief 汇总所有线程的计数
+   */
+  int64_t get(Counter counter) const;
+
+  void reset();
+
+  /**
+   * @brief 记录一次读写操作的耗时
+   * @details 析构时把耗时累加到 time_counter 上，同时 counter 加一
+   */
+  class Timer
+  {
+  public:
+    Timer(BufferPoolStats &stats, Counter counter, Counter time_counter)
+        : stats_(stats), counter_(counter), time_counter_(time_counter), begin_(chrono::steady_clock::now())
+    {}
+
+    ~Timer()
+    {
+      auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin_);
+      stats_.add(counter_);
+      stats_.add(time_counter_, elapsed.count());
+    }
+
+  private:
+    BufferPoolStats                &stats_;
+    Counter                         counter_;
+    Counter                         time_counter_;
+    chrono::steady_clock::time_point begin_;
+  };
+
+private:
+  static constexpr int SLOT_NUM = 32;
+
+  /// 当前线程使用的槽位
+  static int slot_index();
+
+  struct alignas(64) Slot
+  {
+    atomic<int64_t> values[static_cast<int>(Counter::COUNTER_NUM)] = {};
+  };
+
+  Slot slots_[SLOT_NUM];
+};
+
+/**
+ * @brief 一个buffer pool的状态
+ * @ingroup BufferPool
+ * @details SHOW BUFFER POOL STATUS 时使用，参考 BufferPoolManager::collect_status
+ */
+struct BufferPoolStatus
+{
+  string  file_name;
+  int64_t resident_pages = 0;  ///< 在内存中的页面个数
+  int64_t dirty_pages    = 0;
+  int64_t hits           = 0;
+  int64_t misses         = 0;
+  int64_t evictions      = 0;
+  int64_t pin_waits      = 0;
+  int64_t reads          = 0;
+  int64_t read_time_ns   = 0;
+  int64_t writes         = 0;
+  int64_t write_time_ns  = 0;
+
+  void merge(const BufferPoolStatus &other)
+  {
+    resident_pages += other.resident_pages;
+    dirty_pages += other.dirty_pages;
+    hits += other.hits;
+    misses += other.misses;
+    evictions += other.evictions;
+    pin_waits += other.pin_waits;
+    reads += other.reads;
+    read_time_ns += other.read_time_ns;
+    writes += other.writes;
+    write_time_ns += other.write_time_ns;
+  }
+};
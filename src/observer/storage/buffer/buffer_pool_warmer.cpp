@@ -0,0 +1,234 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "storage/buffer/buffer_pool_warmer.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/chrono.h"
+#include "common/lang/filesystem.h"
+#include "common/lang/fstream.h"
+#include "common/log/log.h"
+#include "common/thread/thread_util.h"
+#include "storage/buffer/disk_buffer_pool.h"
+
+using namespace common;
+
+/// 每次交给buffer pool加载的页面个数。加载完一批后会检查是否需要停止
+static constexpr int LOAD_BATCH_PAGES = 256;
+
+BufferPoolWarmer::BufferPoolWarmer(BufferPoolManager &bp_manager) : bp_manager_(bp_manager) {}
+
+BufferPoolWarmer::~BufferPoolWarmer() { stop(); }
+
+RC BufferPoolWarmer::start(const char *file_name, int dump_interval_sec)
+{
+  if (!file_name_.empty()) {
+    LOG_WARN("buffer pool warmer has been started");
+    return RC::INTERNAL;
+  }
+
+  if (dump_interval_sec <= 0) {
+    LOG_INFO("buffer pool warm up is disabled");
+    return RC::SUCCESS;
+  }
+
+  file_name_         = file_name;
+  dump_interval_sec_ = dump_interval_sec;
+  running_.store(true);
+
+  bool need_load = true;
+#ifndef CONCURRENCY
+  // buffer pool的锁不生效，不能与前台线程同时加载页面
+  RC rc = load();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to warm up buffer pool. file=%s, rc=%s", file_name, strrc(rc));
+  }
+  need_load = false;
+#endif
+
+  thread_ = make_unique<thread>(&BufferPoolWarmer::thread_func, this, need_load);
+  LOG_INFO("buffer pool warmer started. file=%s, dump interval=%ds", file_name, dump_interval_sec);
+  return RC::SUCCESS;
+}
+
+void BufferPoolWarmer::stop()
+{
+  if (file_name_.empty()) {
+    return;
+  }
+
+  {
+    lock_guard guard(lock_);
+    running_.store(false);
+  }
+  cond_.notify_all();
+
+  if (thread_) {
+    thread_->join();
+    thread_.reset();
+  }
+
+  RC rc = dump();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to dump buffer pool pages. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+  }
+
+  LOG_INFO("buffer pool warmer stopped. file=%s", file_name_.c_str());
+  file_name_.clear();
+}
+
+RC BufferPoolWarmer::dump()
+{
+  vector<FrameId> frame_ids;
+  bp_manager_.get_frame_manager().resident_frames(frame_ids);
+
+  const string tmp_file_name = file_name_ + ".tmp";
+  ofstream     ofs(tmp_file_name, ios::out | ios::trunc);
+  if (!ofs) {
+    LOG_WARN("failed to open file. file=%s, error=%s", tmp_file_name.c_str(), strerror(errno));
+    return RC::IOERR_OPEN;
+  }
+
+  ofs << frame_ids.size() << '\n';
+  for (const FrameId &frame_id : frame_ids) {
+    ofs << frame_id.buffer_pool_id() << ' ' << frame_id.page_num() << '\n';
+  }
+  ofs.close();
+  if (!ofs) {
+    LOG_WARN("failed to write file. file=%s, error=%s", tmp_file_name.c_str(), strerror(errno));
+    return RC::IOERR_WRITE;
+  }
+
+  if (::rename(tmp_file_name.c_str(), file_name_.c_str()) != 0) {
+    LOG_WARN("failed to rename file. from=%s, to=%s, error=%s",
+             tmp_file_name.c_str(), file_name_.c_str(), strerror(errno));
+    return RC::IOERR_WRITE;
+  }
+
+  LOG_DEBUG("dump buffer pool pages done. file=%s, page num=%d", file_name_.c_str(), (int)frame_ids.size());
+  return RC::SUCCESS;
+}
+
+RC BufferPoolWarmer::read_frame_ids(vector<FrameId> &frame_ids)
+{
+  ifstream ifs(file_name_);
+  if (!ifs) {
+    return RC::FILE_NOT_EXIST;
+  }
+
+  size_t count = 0;
+  if (!(ifs >> count)) {
+    LOG_WARN("invalid buffer pool dump file. file=%s", file_name_.c_str());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  frame_ids.reserve(min(count, bp_manager_.get_frame_manager().total_frame_num()));
+  int32_t buffer_pool_id = -1;
+  PageNum page_num       = -1;
+  while (frame_ids.size() < count && ifs >> buffer_pool_id >> page_num) {
+    frame_ids.emplace_back(buffer_pool_id, page_num);
+  }
+
+  if (frame_ids.size() != count) {
+    // 文件不完整时，已经读到的页面依然可以使用
+    LOG_WARN("buffer pool dump file is incomplete. file=%s, expect=%d, got=%d",
+             file_name_.c_str(), (int)count, (int)frame_ids.size());
+  }
+  return RC::SUCCESS;
+}
+
+RC BufferPoolWarmer::load()
+{
+  vector<FrameId> frame_ids;
+  RC              rc = read_frame_ids(frame_ids);
+  if (RC::FILE_NOT_EXIST == rc) {
+    LOG_INFO("no buffer pool dump file, skip warm up. file=%s", file_name_.c_str());
+    return RC::SUCCESS;
+  }
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  // 文件中的页面按照访问时间从新到旧排列，空闲页帧不够时只加载最热的那部分
+  BPFrameManager &frame_manager = bp_manager_.get_frame_manager();
+  const size_t    total_num     = frame_manager.total_frame_num();
+  const size_t    used_num      = frame_manager.frame_num();
+  const size_t    free_num      = total_num > used_num ? total_num - used_num : 0;
+  if (frame_ids.size() > free_num) {
+    frame_ids.resize(free_num);
+  }
+
+  // 按照页面在文件中的位置排序，这样相邻的页面可以合并成一次顺序读
+  sort(frame_ids.begin(), frame_ids.end(), [](const FrameId &a, const FrameId &b) {
+    return a.buffer_pool_id() != b.buffer_pool_id() ? a.buffer_pool_id() < b.buffer_pool_id()
+                                                    : a.page_num() < b.page_num();
+  });
+
+  vector<PageNum> page_nums;
+  page_nums.reserve(LOAD_BATCH_PAGES);
+  for (size_t i = 0; i < frame_ids.size() && running_.load(); i++) {
+    page_nums.push_back(frame_ids[i].page_num());
+
+    const bool last = (i + 1 == frame_ids.size()) || frame_ids[i + 1].buffer_pool_id() != frame_ids[i].buffer_pool_id();
+    if (last || page_nums.size() >= static_cast<size_t>(LOAD_BATCH_PAGES)) {
+      loaded_page_num_ += load_pages(frame_ids[i].buffer_pool_id(), page_nums);
+      page_nums.clear();
+    }
+  }
+
+  LOG_INFO("buffer pool warm up done. file=%s, candidates=%d, loaded=%d",
+           file_name_.c_str(), (int)frame_ids.size(), loaded_page_num_.load());
+  return RC::SUCCESS;
+}
+
+int BufferPoolWarmer::load_pages(int32_t buffer_pool_id, vector<PageNum> &page_nums)
+{
+  scoped_lock cleaner_guard(bp_manager_.page_cleaner_lock());
+
+  DiskBufferPool *bp = nullptr;
+  RC              rc = bp_manager_.get_buffer_pool(buffer_pool_id, bp);
+  if (OB_FAIL(rc)) {
+    // 表可能已经被删除了
+    LOG_INFO("skip warm up pages of unknown buffer pool. buffer pool id=%d", buffer_pool_id);
+    return 0;
+  }
+
+  return bp->warm_up(page_nums);
+}
+
+void BufferPoolWarmer::thread_func(bool need_load)
+{
+  thread_set_name("BPWarmer");
+
+  if (need_load) {
+    RC rc = load();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to warm up buffer pool. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+    }
+  }
+
+  while (running_.load()) {
+    {
+      unique_lock guard(lock_);
+      cond_.wait_for(guard, chrono::seconds(dump_interval_sec_), [this]() { return !running_.load(); });
+    }
+    if (!running_.load()) {
+      break;
+    }
+
+    RC rc = dump();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to dump buffer pool pages. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+    }
+  }
+}
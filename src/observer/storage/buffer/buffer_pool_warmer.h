@@ -0,0 +1,97 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/atomic.h"
+#include "common/lang/condition_variable.h"
+#include "common/lang/memory.h"
+#include "common/lang/mutex.h"
+#include "common/lang/string.h"
+#include "common/lang/thread.h"
+#include "common/lang/vector.h"
+#include "common/sys/rc.h"
+#include "storage/buffer/frame.h"
+
+class BufferPoolManager;
+
+/**
+ * @brief buffer pool 预热
+ * @ingroup BufferPool
+ * @details 系统重启后buffer pool是空的，需要很长时间才能把热点页面重新加载到内存中。
+ * 预热线程定期把内存中的页面编号(FrameId)按照最近访问时间从新到旧写到文件中，系统启动时
+ * 再按照文件中的顺序，把最热的页面加载回来。加载时按照页面编号排序，把连续的页面合并成一次
+ * 大的顺序读。
+ * 文件中只记录页面编号，不记录页面数据，所以即使文件过时了也不会影响正确性，
+ * 最多只是加载了一些不再需要的页面。
+ * CONCURRENCY 编译模式下，加载页面也在后台线程中进行，不会阻塞系统启动；否则buffer pool的锁
+ * 都不生效，只能在启动时同步加载。
+ */
+class BufferPoolWarmer
+{
+public:
+  explicit BufferPoolWarmer(BufferPoolManager &bp_manager);
+  ~BufferPoolWarmer();
+
+  /**
+   * @brief 加载上次保存的页面，并启动定期保存页面列表的后台线程
+   * @details 需要在所有buffer pool都打开并且完成恢复之后调用
+   * @param file_name 保存页面列表的文件
+   * @param dump_interval_sec 保存页面列表的时间间隔，单位秒
+   */
+  RC start(const char *file_name, int dump_interval_sec);
+
+  /**
+   * @brief 停止后台线程，并最后保存一次页面列表
+   * @details 需要在关闭buffer pool之前调用
+   */
+  void stop();
+
+  /**
+   * @brief 把内存中的页面列表保存到文件中
+   * @details 先写临时文件，再重命名，防止写一半时宕机把原来的文件破坏掉
+   */
+  RC dump();
+
+  /**
+   * @brief 从文件中读取页面列表，并加载到内存中
+   * @details 最多加载当前空闲页帧个数的页面，不会为了预热淘汰已经在内存中的页面
+   */
+  RC load();
+
+  /**
+   * @brief 预热加载的页面个数
+   */
+  int loaded_page_num() const { return loaded_page_num_.load(); }
+
+private:
+  void thread_func(bool need_load);
+
+  RC read_frame_ids(vector<FrameId> &frame_ids);
+
+  /**
+   * @brief 加载一个buffer pool中的页面
+   * @details 持有刷脏锁，防止加载过程中buffer pool被关闭
+   */
+  int load_pages(int32_t buffer_pool_id, vector<PageNum> &page_nums);
+
+private:
+  BufferPoolManager &bp_manager_;
+
+  string file_name_;
+  int    dump_interval_sec_ = 0;
+
+  atomic<int> loaded_page_num_{0};
+
+  mutex              lock_;
+  condition_variable cond_;
+  unique_ptr<thread> thread_;
+  atomic_bool        running_{false};
+};
@@ -17,6 +17,8 @@ See the Mulan PSL v2 for more details. */
 #include "common/io/io.h"
 #include "common/lang/mutex.h"
 #include "common/lang/algorithm.h"
+#include "common/lang/thread.h"
+#include "common/lang/tuple.h"
 #include "common/log/log.h"
 #include "common/math/crc.h"
 #include "storage/buffer/disk_buffer_pool.h"
@@ -27,6 +29,9 @@ using namespace common;
 
 static const int MEM_POOL_ITEM_NUM = 20;
 
+/// 预热时一次最少读取的连续页面个数。预读窗口更大时使用预读窗口
+static const int WARM_UP_READ_PAGES = 64;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 string BPFileHeader::to_string() const
@@ -38,30 +43,105 @@ string BPFileHeader::to_string() const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-BPFrameManager::BPFrameManager(const char *name) : allocator_(name) {}
+BPFrameManager::BPFrameManager(const char *name) : tag_(name) {}
 
-RC BPFrameManager::init(int pool_num)
+RC BPFrameManager::init(
+    int pool_num, int shard_num /* = 1 */, const char *replacer_name /* = "lru" */, bool huge_page /* = false */)
 {
-  int ret = allocator_.init(false, pool_num);
-  if (ret == 0) {
-    return RC::SUCCESS;
+  if (pool_num <= 0 || shard_num <= 0) {
+    LOG_WARN("invalid argument. pool_num=%d, shard_num=%d", pool_num, shard_num);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  // 每个分片至少有一个内存池大小的页帧，防止分片内的页帧太少，全部被pin住
+  const int total_item_num = pool_num * DEFAULT_ITEM_NUM_PER_POOL;
+  shard_num                = min(shard_num, pool_num);
+
+  shards_.clear();
+  shards_.reserve(shard_num);
+  for (int i = 0; i < shard_num; i++) {
+    auto shard = make_unique<FrameShard>();
+
+    // 总数不能整除时，前面的分片多分配一个页帧
+    const int item_num = total_item_num / shard_num + (i < total_item_num % shard_num ? 1 : 0);
+    RC rc = shard->allocator.init(item_num, huge_page);
+    if (OB_FAIL(rc)) {
+      LOG_ERROR("failed to init frame allocator. shard=%d, item num=%d, rc=%s", i, item_num, strrc(rc));
+      shards_.clear();
+      return rc;
+    }
+
+    FrameReplacer *replacer = nullptr;
+    rc                      = FrameReplacer::create(replacer_name, item_num, replacer);
+    if (OB_FAIL(rc)) {
+      LOG_ERROR("failed to create frame replacer. name=%s, rc=%s", replacer_name, strrc(rc));
+      shards_.clear();
+      return rc;
+    }
+    shard->replacer.reset(replacer);
+    shards_.push_back(std::move(shard));
   }
-  return RC::NOMEM;
+
+  LOG_INFO("frame manager init done. tag=%s, frame num=%d, shard num=%d, replacer=%s",
+           tag_.c_str(), total_item_num, shard_num, replacer_name);
+  return RC::SUCCESS;
 }
 
 RC BPFrameManager::cleanup()
 {
-  if (frames_.count() > 0) {
+  if (frame_num() > 0) {
     return RC::INTERNAL;
   }
 
-  frames_.destroy();
+  for (auto &shard : shards_) {
+    shard->frames.clear();
+  }
   return RC::SUCCESS;
 }
 
-int BPFrameManager::purge_frames(int count, function<RC(Frame *frame)> purger)
+size_t BPFrameManager::frame_num() const
+{
+  size_t num = 0;
+  for (const auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    num += shard->frames.size();
+  }
+  return num;
+}
+
+int64_t BPFrameManager::hit_count() const
+{
+  int64_t count = 0;
+  for (const auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    count += shard->hit_count;
+  }
+  return count;
+}
+
+int64_t BPFrameManager::miss_count() const
+{
+  int64_t count = 0;
+  for (const auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    count += shard->miss_count;
+  }
+  return count;
+}
+
+size_t BPFrameManager::total_frame_num() const
+{
+  size_t num = 0;
+  for (const auto &shard : shards_) {
+    num += shard->allocator.size();
+  }
+  return num;
+}
+
+int BPFrameManager::purge_frames(int buffer_pool_id, PageNum page_num, int count, function<RC(Frame *frame)> purger)
 {
-  lock_guard<mutex> lock_guard(lock_);
+  FrameShard       &shard = shard_of(FrameId(buffer_pool_id, page_num));
+  lock_guard<mutex> lock_guard(shard.lock);
 
   vector<Frame *> frames_can_purge;
   if (count <= 0) {
@@ -69,7 +149,7 @@ int BPFrameManager::purge_frames(int count, function<RC(Frame *frame)> purger)
   }
   frames_can_purge.reserve(count);
 
-  auto purge_finder = [&frames_can_purge, count](const FrameId &frame_id, Frame *const frame) {
+  auto purge_finder = [&frames_can_purge, count](Frame *frame) {
     if (frame->can_purge()) {
       frame->pin();
       frames_can_purge.push_back(frame);
@@ -80,16 +160,16 @@ int BPFrameManager::purge_frames(int count, function<RC(Frame *frame)> purger)
     return true;  // true continue to look up
   };
 
-  frames_.foreach_reverse(purge_finder);
+  shard.replacer->foreach_victim(purge_finder);
   LOG_INFO("purge frames find %ld pages total", frames_can_purge.size());
 
-  /// 当前还在frameManager的锁内，而 purger 是一个非常耗时的操作
-  /// 他需要把脏页数据刷新到磁盘上去，所以这里会极大地降低并发度
+  /// 当前还在分片的锁内，而 purger 是一个非常耗时的操作
+  /// 他需要把脏页数据刷新到磁盘上去，所以这里会降低当前分片的并发度
   int freed_count = 0;
   for (Frame *frame : frames_can_purge) {
     RC rc = purger(frame);
     if (RC::SUCCESS == rc) {
-      free_internal(frame->frame_id(), frame);
+      free_internal(shard, frame->frame_id(), frame);
       freed_count++;
     } else {
       frame->unpin();
@@ -103,17 +183,26 @@ int BPFrameManager::purge_frames(int count, function<RC(Frame *frame)> purger)
 
 Frame *BPFrameManager::get(int buffer_pool_id, PageNum page_num)
 {
-  FrameId frame_id(buffer_pool_id, page_num);
+  FrameId     frame_id(buffer_pool_id, page_num);
+  FrameShard &shard = shard_of(frame_id);
 
-  lock_guard<mutex> lock_guard(lock_);
-  return get_internal(frame_id);
+  lock_guard<mutex> lock_guard(shard.lock);
+  Frame *frame = get_internal(shard, frame_id);
+  if (frame != nullptr) {
+    shard.hit_count++;
+  } else {
+    shard.miss_count++;
+  }
+  return frame;
 }
 
-Frame *BPFrameManager::get_internal(const FrameId &frame_id)
+Frame *BPFrameManager::get_internal(FrameShard &shard, const FrameId &frame_id)
 {
   Frame *frame = nullptr;
-  (void)frames_.get(frame_id, frame);
-  if (frame != nullptr) {
+  auto   iter  = shard.frames.find(frame_id);
+  if (iter != shard.frames.end()) {
+    frame = iter->second;
+    shard.replacer->access(frame);
     frame->pin();
     LOG_DEBUG("got a frame. frame=%s", frame->to_string().c_str());
   }
@@ -122,23 +211,26 @@ Frame *BPFrameManager::get_internal(const FrameId &frame_id)
 
 Frame *BPFrameManager::alloc(int buffer_pool_id, PageNum page_num)
 {
-  FrameId frame_id(buffer_pool_id, page_num);
+  FrameId     frame_id(buffer_pool_id, page_num);
+  FrameShard &shard = shard_of(frame_id);
 
-  lock_guard<mutex> lock_guard(lock_);
+  lock_guard<mutex> lock_guard(shard.lock);
 
-  Frame *frame = get_internal(frame_id);
+  Frame *frame = get_internal(shard, frame_id);
   if (frame != nullptr) {
     return frame;
   }
 
-  frame = allocator_.alloc();
+  frame = shard.allocator.alloc();
   if (frame != nullptr) {
     ASSERT(frame->pin_count() == 0, "got an invalid frame that pin count is not 0. frame=%s", 
            frame->to_string().c_str());
     frame->set_buffer_pool_id(buffer_pool_id);
     frame->set_page_num(page_num);
+    frame->renew_version();
     frame->pin();
-    frames_.put(frame_id, frame);
+    shard.frames.emplace(frame_id, frame);
+    shard.replacer->insert(frame);
     LOG_DEBUG("allocate a new frame. frame=%s", frame->to_string().c_str());
   }
   return frame;
@@ -146,43 +238,98 @@ Frame *BPFrameManager::alloc(int buffer_pool_id, PageNum page_num)
 
 RC BPFrameManager::free(int buffer_pool_id, PageNum page_num, Frame *frame)
 {
-  FrameId frame_id(buffer_pool_id, page_num);
+  FrameId     frame_id(buffer_pool_id, page_num);
+  FrameShard &shard = shard_of(frame_id);
 
-  lock_guard<mutex> lock_guard(lock_);
-  return free_internal(frame_id, frame);
+  lock_guard<mutex> lock_guard(shard.lock);
+  return free_internal(shard, frame_id, frame);
 }
 
-RC BPFrameManager::free_internal(const FrameId &frame_id, Frame *frame)
+RC BPFrameManager::try_free(int buffer_pool_id, PageNum page_num, Frame *frame)
 {
-  Frame                *frame_source = nullptr;
-  [[maybe_unused]] bool found        = frames_.get(frame_id, frame_source);
+  FrameId     frame_id(buffer_pool_id, page_num);
+  FrameShard &shard = shard_of(frame_id);
+
+  lock_guard<mutex> lock_guard(shard.lock);
+  if (frame->pin_count() != 1) {
+    return RC::LOCKED_NEED_WAIT;
+  }
+  return free_internal(shard, frame_id, frame);
+}
+
+RC BPFrameManager::free_internal(FrameShard &shard, const FrameId &frame_id, Frame *frame)
+{
+  auto                   iter         = shard.frames.find(frame_id);
+  const bool             found        = iter != shard.frames.end();
+  [[maybe_unused]] Frame *frame_source = found ? iter->second : nullptr;
   ASSERT(found && frame == frame_source && frame->pin_count() == 1,
       "failed to free frame. found=%d, frameId=%s, frame_source=%p, frame=%p, pinCount=%d, lbt=%s",
       found, frame_id.to_string().c_str(), frame_source, frame, frame->pin_count(), lbt());
 
+  shard.replacer->remove(frame);
   frame->set_page_num(-1);
   frame->unpin();
-  frames_.remove(frame_id);
-  allocator_.free(frame);
+  if (found) {
+    shard.frames.erase(iter);
+  }
+  shard.allocator.free(frame);
   return RC::SUCCESS;
 }
 
 list<Frame *> BPFrameManager::find_list(int buffer_pool_id)
 {
-  lock_guard<mutex> lock_guard(lock_);
-
   list<Frame *> frames;
-  auto          fetcher = [&frames, buffer_pool_id](const FrameId &frame_id, Frame *const frame) -> bool {
-    if (buffer_pool_id == frame_id.buffer_pool_id()) {
-      frame->pin();
-      frames.push_back(frame);
+  for (auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    for (auto &[frame_id, frame] : shard->frames) {
+      if (buffer_pool_id == frame_id.buffer_pool_id()) {
+        frame->pin();
+        frames.push_back(frame);
+      }
     }
-    return true;
-  };
-  frames_.foreach (fetcher);
+  }
   return frames;
 }
 
+bool BPFrameManager::contains(int buffer_pool_id, PageNum page_num) const
+{
+  FrameId     frame_id(buffer_pool_id, page_num);
+  FrameShard &shard = shard_of(frame_id);
+
+  lock_guard<mutex> lock_guard(shard.lock);
+  return shard.frames.find(frame_id) != shard.frames.end();
+}
+
+void BPFrameManager::frame_num_by_buffer_pool(unordered_map<int32_t, int64_t> &frame_nums) const
+{
+  for (const auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    for (const auto &iter : shard->frames) {
+      frame_nums[iter.first.buffer_pool_id()]++;
+    }
+  }
+}
+
+void BPFrameManager::resident_frames(vector<FrameId> &frame_ids) const
+{
+  vector<pair<unsigned long, FrameId>> frames;
+  for (const auto &shard : shards_) {
+    lock_guard<mutex> lock_guard(shard->lock);
+    for (const auto &[frame_id, frame] : shard->frames) {
+      frames.emplace_back(frame->acc_time(), frame_id);
+    }
+  }
+
+  sort(frames.begin(), frames.end(), [](const pair<unsigned long, FrameId> &a, const pair<unsigned long, FrameId> &b) {
+    return a.first > b.first;
+  });
+
+  frame_ids.reserve(frame_ids.size() + frames.size());
+  for (const auto &frame : frames) {
+    frame_ids.push_back(frame.second);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 BufferPoolIterator::BufferPoolIterator() {}
 BufferPoolIterator::~BufferPoolIterator() {}
@@ -231,7 +378,7 @@ DiskBufferPool::~DiskBufferPool()
 
 RC DiskBufferPool::open_file(const char *file_name)
 {
-  int fd = open(file_name, O_RDWR);
+  int fd = common::open_file(file_name, O_RDWR, 0, bp_manager_.direct_io());
   if (fd < 0) {
     LOG_ERROR("Failed to open file %s, because %s.", file_name, strerror(errno));
     return RC::IOERR_ACCESS;
@@ -240,9 +387,10 @@ RC DiskBufferPool::open_file(const char *file_name)
 
   file_name_ = file_name;
   file_desc_ = fd;
+  read_ahead_.init(fd, bp_manager_.read_ahead_executor(), bp_manager_.read_ahead_window());
 
-  Page header_page;
-  int  ret = readn(file_desc_, &header_page, sizeof(header_page));
+  alignas(BP_IO_ALIGN) Page header_page;
+  int ret = preadn(file_desc_, &header_page, sizeof(header_page), 0);
   if (ret != 0) {
     LOG_ERROR("Failed to read first page of %s, due to %s.", file_name, strerror(errno));
     close(fd);
@@ -286,6 +434,9 @@ RC DiskBufferPool::close_file()
     return rc;
   }
 
+  // 等后台刷脏线程处理完当前这一轮，避免它访问已经关闭的文件
+  scoped_lock cleaner_guard(bp_manager_.page_cleaner_lock());
+
   hdr_frame_->unpin();
 
   // TODO: 理论上是在回放时回滚未提交事务，但目前没有undo log，因此不下刷数据page，只通过redo log回放
@@ -302,6 +453,8 @@ RC DiskBufferPool::close_file()
   }
 
   disposed_pages_.clear();
+  dirty_pages_.clear();
+  read_ahead_.stop();
 
   if (close(file_desc_) < 0) {
     LOG_ERROR("Failed to close fileId:%d, fileName:%s, error:%s", file_desc_, file_name_.c_str(), strerror(errno));
@@ -321,10 +474,12 @@ RC DiskBufferPool::get_this_page(PageNum page_num, Frame **frame)
 
   Frame *used_match_frame = frame_manager_.get(id(), page_num);
   if (used_match_frame != nullptr) {
+    stats_.add(BufferPoolStats::Counter::HIT);
     used_match_frame->access();
     *frame = used_match_frame;
     return RC::SUCCESS;
   }
+  stats_.add(BufferPoolStats::Counter::MISS);
 
   scoped_lock lock_guard(lock_);  // 直接加了一把大锁，其实可以根据访问的页面来细化提高并行度
 
@@ -444,15 +599,28 @@ RC DiskBufferPool::dispose_page(PageNum page_num)
     return RC::INTERNAL;
   }
 
-  scoped_lock lock_guard(lock_);
-  Frame      *used_frame = frame_manager_.get(id(), page_num);
-  if (used_frame != nullptr) {
-    ASSERT("the page try to dispose is in use. frame:%s", used_frame->to_string().c_str());
-    frame_manager_.free(id(), page_num, used_frame);
-  } else {
-    LOG_DEBUG("page not found in memory while disposing it. pageNum=%d", page_num);
+  // B+树乐观读的读者不加latch，只pin住页面，要等它们读完才能释放页帧。
+  // 它们读完会校验版本号，发现页面已经变化后就放弃，所以不会等太久
+  while (true) {
+    lock_.lock();
+    Frame *used_frame = frame_manager_.get(id(), page_num);
+    if (used_frame == nullptr) {
+      LOG_DEBUG("page not found in memory while disposing it. pageNum=%d", page_num);
+      break;
+    }
+
+    if (OB_SUCC(frame_manager_.try_free(id(), page_num, used_frame))) {
+      break;
+    }
+
+    used_frame->unpin();
+    lock_.unlock();
+    this_thread::yield();
   }
 
+  scoped_lock lock_guard(adopt_lock, lock_);
+  dirty_pages_.remove(page_num);
+
   LSN lsn = 0;
   RC  rc  = log_handler_.deallocate_page(page_num, lsn);
   if (OB_FAIL(rc)) {
@@ -564,6 +732,7 @@ RC DiskBufferPool::flush_page_internal(Frame &frame)
   }
 
   frame.clear_dirty();
+  dirty_pages_.remove(frame.page_num());
   LOG_DEBUG("Flush block. file desc=%d, frame=%s", file_desc_, frame.to_string().c_str());
 
   return RC::SUCCESS;
@@ -583,6 +752,30 @@ RC DiskBufferPool::flush_all_pages()
   return RC::SUCCESS;
 }
 
+RC DiskBufferPool::clean_page(PageNum page_num)
+{
+  Frame *frame = frame_manager_.get(id(), page_num);
+  if (frame == nullptr) {
+    dirty_pages_.remove(page_num);
+    return RC::SUCCESS;
+  }
+
+  RC rc = RC::SUCCESS;
+  if (frame->try_read_latch()) {
+    if (frame->dirty()) {
+      rc = flush_page(*frame);
+    } else {
+      dirty_pages_.remove(page_num);
+    }
+    frame->read_unlatch();
+  } else {
+    rc = RC::LOCKED_CONCURRENCY_CONFLICT;
+  }
+
+  frame->unpin();
+  return rc;
+}
+
 RC DiskBufferPool::recover_page(PageNum page_num)
 {
   int byte = 0, bit = 0;
@@ -599,19 +792,30 @@ RC DiskBufferPool::recover_page(PageNum page_num)
   return RC::SUCCESS;
 }
 
-RC DiskBufferPool::write_page(PageNum page_num, Page &page)
+Page *DiskBufferPool::aligned_page(Page &page, bool read)
 {
-  scoped_lock lock_guard(wr_lock_);
-  int64_t     offset = ((int64_t)page_num) * sizeof(Page);
-  if (lseek(file_desc_, offset, SEEK_SET) == -1) {
-    LOG_ERROR("Failed to write page %lld of %d due to failed to seek %s.", offset, file_desc_, strerror(errno));
-    return RC::IOERR_SEEK;
+  if (!bp_manager_.direct_io() || reinterpret_cast<uintptr_t>(&page) % BP_IO_ALIGN == 0) {
+    return &page;
   }
 
-  if (writen(file_desc_, &page, sizeof(Page)) != 0) {
+  // direct IO 要求内存地址对齐。比如double write buffer关闭文件时写入的页面，不在页帧中，需要复制一次
+  alignas(BP_IO_ALIGN) static thread_local Page bounce_page;
+  if (!read) {
+    bounce_page = page;
+  }
+  return &bounce_page;
+}
+
+RC DiskBufferPool::write_page(PageNum page_num, Page &page)
+{
+  // 使用pwrite，double write buffer的后台线程与前台线程可以同时读写文件
+  int64_t                offset = ((int64_t)page_num) * sizeof(Page);
+  BufferPoolStats::Timer timer(stats_, BufferPoolStats::Counter::WRITE, BufferPoolStats::Counter::WRITE_TIME);
+  if (pwriten(file_desc_, aligned_page(page, false /*read*/), sizeof(Page), offset) != 0) {
     LOG_ERROR("Failed to write page %lld of %d due to %s.", offset, file_desc_, strerror(errno));
     return RC::IOERR_WRITE;
   }
+  read_ahead_.invalidate(page_num);
 
   LOG_TRACE("write_page: buffer_pool_id:%d, page_num:%d, lsn=%d, check_sum=%d", id(), page_num, page.lsn, page.check_sum);
   return RC::SUCCESS;
@@ -702,6 +906,9 @@ RC DiskBufferPool::allocate_frame(PageNum page_num, Frame **buffer)
       rc = bp_manager_.flush_page(*frame);
     }
 
+    // 前台线程不得不自己刷脏页，说明后台刷脏跟不上了
+    bp_manager_.wakeup_page_cleaner();
+
     if (rc != RC::SUCCESS) {
       LOG_ERROR("Failed to aclloc block due to failed to flush old block. rc=%s", strrc(rc));
     }
@@ -711,17 +918,93 @@ RC DiskBufferPool::allocate_frame(PageNum page_num, Frame **buffer)
   while (true) {
     Frame *frame = frame_manager_.alloc(id(), page_num);
     if (frame != nullptr) {
+      frame->set_dirty_list(&dirty_pages_);
       *buffer = frame;
       LOG_DEBUG("allocate frame %p, page num %d, frame=%s", frame, page_num, frame->to_string().c_str());
       return RC::SUCCESS;
     }
 
     LOG_TRACE("frames are all allocated, so we should purge some frames to get one free frame");
-    (void)frame_manager_.purge_frames(1 /*count*/, purger);
+    int purged_num = frame_manager_.purge_frames(id(), page_num, 1 /*count*/, purger);
+    if (purged_num > 0) {
+      stats_.add(BufferPoolStats::Counter::EVICT, purged_num);
+    } else {
+      // 所有的页帧都被pin住了，只能等待其它线程释放
+      stats_.add(BufferPoolStats::Counter::PIN_WAIT);
+    }
   }
   return RC::BUFFERPOOL_NOBUF;
 }
 
+int DiskBufferPool::warm_up(vector<PageNum> &page_nums)
+{
+  scoped_lock lock_guard(lock_);
+
+  sort(page_nums.begin(), page_nums.end());
+
+  Bitmap          bitmap(file_header_->bitmap, file_header_->page_count);
+  vector<PageNum> pages;
+  pages.reserve(page_nums.size());
+  for (PageNum page_num : page_nums) {
+    if (page_num <= BP_HEADER_PAGE || page_num >= file_header_->page_count || !bitmap.get_bit(page_num) ||
+        (!pages.empty() && pages.back() == page_num) || frame_manager_.contains(id(), page_num)) {
+      continue;
+    }
+    pages.push_back(page_num);
+  }
+
+  const int max_run_pages = max(bp_manager_.read_ahead_window(), WARM_UP_READ_PAGES);
+  unique_ptr<char, decltype(&::free)> buffer(
+      static_cast<char *>(aligned_alloc(BP_IO_ALIGN, static_cast<size_t>(max_run_pages) * BP_PAGE_SIZE)), &::free);
+  if (!buffer) {
+    LOG_WARN("failed to allocate warm up buffer. page num=%d", max_run_pages);
+    return 0;
+  }
+
+  int loaded_num = 0;
+  for (size_t begin = 0; begin < pages.size();) {
+    // 连续的页面一次读取
+    size_t end = begin + 1;
+    while (end < pages.size() && end - begin < static_cast<size_t>(max_run_pages) && pages[end] == pages[end - 1] + 1) {
+      end++;
+    }
+
+    const int count = static_cast<int>(end - begin);
+    int       ret = preadn(file_desc_, buffer.get(), count * BP_PAGE_SIZE, static_cast<int64_t>(pages[begin]) * BP_PAGE_SIZE);
+    if (ret != 0) {
+      LOG_WARN("failed to read pages for warm up. file=%s, page num=%d, count=%d, ret=%d",
+               file_name_.c_str(), pages[begin], count, ret);
+      break;
+    }
+
+    for (size_t i = begin; i < end; i++) {
+      Frame *frame = nullptr;
+      RC     rc    = allocate_frame(pages[i], &frame);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to allocate frame for warm up. file=%s, page num=%d, rc=%s",
+                 file_name_.c_str(), pages[i], strrc(rc));
+        return loaded_num;
+      }
+
+      frame->set_buffer_pool_id(id());
+      frame->access();
+
+      // double write buffer中的页面可能还没有写回文件，比文件中的更新
+      Page &page = frame->page();
+      if (OB_FAIL(dblwr_manager_.read_page(this, pages[i], page))) {
+        memcpy(&page, buffer.get() + (i - begin) * BP_PAGE_SIZE, BP_PAGE_SIZE);
+      }
+      frame->unpin();
+      loaded_num++;
+    }
+    begin = end;
+  }
+
+  LOG_INFO("warm up buffer pool done. file=%s, candidates=%d, loaded=%d",
+           file_name_.c_str(), (int)page_nums.size(), loaded_num);
+  return loaded_num;
+}
+
 RC DiskBufferPool::check_page_num(PageNum page_num)
 {
   if (page_num >= file_header_->page_count) {
@@ -743,20 +1026,35 @@ RC DiskBufferPool::load_page(PageNum page_num, Frame *frame)
     return rc;
   }
 
-  scoped_lock lock_guard(wr_lock_);
-  int64_t     offset = ((int64_t)page_num) * BP_PAGE_SIZE;
-  if (lseek(file_desc_, offset, SEEK_SET) == -1) {
-    LOG_ERROR("Failed to load page %s:%d, due to failed to lseek:%s.", file_name_.c_str(), page_num, strerror(errno));
-
-    return RC::IOERR_SEEK;
+  if (read_ahead_.read_page(page_num, file_header_ != nullptr ? file_header_->page_count : 0, page)) {
+    frame->set_page_num(page_num);
+    LOG_DEBUG("Load page %s:%d from read ahead buffer", file_name_.c_str(), page_num);
+    return RC::SUCCESS;
   }
 
-  int ret = readn(file_desc_, &page, BP_PAGE_SIZE);
+  int64_t offset    = ((int64_t)page_num) * BP_PAGE_SIZE;
+  Page   *read_page = aligned_page(page, true /*read*/);
+  int     ret       = 0;
+  {
+    BufferPoolStats::Timer timer(stats_, BufferPoolStats::Counter::READ, BufferPoolStats::Counter::READ_TIME);
+    ret = preadn(file_desc_, read_page, BP_PAGE_SIZE, offset);
+  }
+  if (ret == -1) {
+    // 读到了文件末尾。文件只有在刷页面时才会变长，已经分配但是还没有刷过盘的页面在崩溃后是不存在的，
+    // 重做日志时会从一个空页面开始重新构造它
+    LOG_INFO("page is beyond the end of file, load it as an empty page. file=%s, page num=%d",
+             file_name_.c_str(), page_num);
+    memset(read_page, 0, BP_PAGE_SIZE);
+    ret = 0;
+  }
   if (ret != 0) {
     LOG_ERROR("Failed to load page %s, file_desc:%d, page num:%d, due to failed to read data:%s, ret=%d, page count=%d",
               file_name_.c_str(), file_desc_, page_num, strerror(errno), ret, file_header_->allocated_pages);
     return RC::IOERR_READ;
   }
+  if (read_page != &page) {
+    page = *read_page;
+  }
 
   frame->set_page_num(page_num);
 
@@ -768,19 +1066,29 @@ RC DiskBufferPool::load_page(PageNum page_num, Frame *frame)
 int DiskBufferPool::file_desc() const { return file_desc_; }
 
 ////////////////////////////////////////////////////////////////////////////////
-BufferPoolManager::BufferPoolManager(int memory_size /* = 0 */)
+BufferPoolManager::BufferPoolManager(int memory_size /* = 0 */, int frame_shard_num /* = 1 */,
+    const char *replacer_name /* = "lru" */, bool direct_io /* = false */, bool huge_page /* = false */)
+    : direct_io_(direct_io)
 {
   if (memory_size <= 0) {
     memory_size = MEM_POOL_ITEM_NUM * DEFAULT_ITEM_NUM_PER_POOL * BP_PAGE_SIZE;
   }
   const int pool_num = max(memory_size / BP_PAGE_SIZE / DEFAULT_ITEM_NUM_PER_POOL, 1);
-  frame_manager_.init(pool_num);
-  LOG_INFO("buffer pool manager init with memory size %d, page num: %d, pool num: %d",
-           memory_size, pool_num * DEFAULT_ITEM_NUM_PER_POOL, pool_num);
+  RC rc = frame_manager_.init(pool_num, frame_shard_num, replacer_name, huge_page);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to init frame manager, fall back to lru replacer. replacer=%s, rc=%s", replacer_name, strrc(rc));
+    frame_manager_.init(pool_num, frame_shard_num, "lru", huge_page);
+  }
+  LOG_INFO("buffer pool manager init with memory size %d, page num: %d, pool num: %d, frame shard num: %d, direct io: %d",
+           memory_size, pool_num * DEFAULT_ITEM_NUM_PER_POOL, pool_num, frame_manager_.shard_num(), direct_io_);
 }
 
 BufferPoolManager::~BufferPoolManager()
 {
+  // 需要在关闭文件之前保存页面列表
+  stop_warm_up();
+  stop_page_cleaner();
+
   unordered_map<string, DiskBufferPool *> tmp_bps;
   tmp_bps.swap(buffer_pools_);
 
@@ -923,3 +1231,141 @@ RC BufferPoolManager::get_buffer_pool(int32_t id, DiskBufferPool *&bp)
   bp = iter->second;
   return RC::SUCCESS;
 }
+
+RC BufferPoolManager::start_page_cleaner(int dirty_ratio, int batch_size)
+{
+  return page_cleaner_.start(dirty_ratio, batch_size);
+}
+
+void BufferPoolManager::stop_page_cleaner() { page_cleaner_.stop(); }
+
+RC BufferPoolManager::enable_read_ahead(int window, int thread_num)
+{
+  if (window <= 0) {
+    LOG_INFO("buffer pool read ahead is disabled");
+    return RC::SUCCESS;
+  }
+
+  if (read_ahead_window_ > 0) {
+    LOG_WARN("buffer pool read ahead has been enabled");
+    return RC::INTERNAL;
+  }
+
+  if (thread_num <= 0) {
+    LOG_WARN("invalid read ahead thread number. thread num=%d", thread_num);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  if (read_ahead_executor_.init("ReadAhead", thread_num, thread_num, 60 * 1000) != 0) {
+    LOG_WARN("failed to init read ahead thread pool");
+    return RC::INTERNAL;
+  }
+
+  read_ahead_window_ = window;
+  LOG_INFO("buffer pool read ahead enabled. window=%d, thread num=%d", window, thread_num);
+  return RC::SUCCESS;
+}
+
+RC BufferPoolManager::start_warm_up(const char *dump_file, int dump_interval_sec)
+{
+  return warmer_.start(dump_file, dump_interval_sec);
+}
+
+void BufferPoolManager::stop_warm_up() { warmer_.stop(); }
+
+void BufferPoolManager::collect_status(vector<BufferPoolStatus> &status_list)
+{
+  unordered_map<int32_t, int64_t> frame_nums;
+  frame_manager_.frame_num_by_buffer_pool(frame_nums);
+
+  scoped_lock lock_guard(lock_);
+  for (auto &[file_name, bp] : buffer_pools_) {
+    const BufferPoolStats &stats  = bp->stats();
+    BufferPoolStatus       status;
+    status.file_name      = file_name;
+    status.resident_pages = frame_nums[bp->id()];
+    status.dirty_pages    = bp->dirty_pages().size();
+    status.hits           = stats.get(BufferPoolStats::Counter::HIT);
+    status.misses         = stats.get(BufferPoolStats::Counter::MISS);
+    status.evictions      = stats.get(BufferPoolStats::Counter::EVICT);
+    status.pin_waits      = stats.get(BufferPoolStats::Counter::PIN_WAIT);
+    status.reads          = stats.get(BufferPoolStats::Counter::READ);
+    status.read_time_ns   = stats.get(BufferPoolStats::Counter::READ_TIME);
+    status.writes         = stats.get(BufferPoolStats::Counter::WRITE);
+    status.write_time_ns  = stats.get(BufferPoolStats::Counter::WRITE_TIME);
+    status_list.push_back(std::move(status));
+  }
+
+  sort(status_list.begin(), status_list.end(),
+      [](const BufferPoolStatus &a, const BufferPoolStatus &b) { return a.file_name < b.file_name; });
+}
+
+void BufferPoolManager::wakeup_page_cleaner() { page_cleaner_.wakeup(); }
+
+size_t BufferPoolManager::dirty_page_num()
+{
+  scoped_lock lock_guard(lock_);
+
+  size_t dirty_page_num = 0;
+  for (auto &iter : id_to_buffer_pools_) {
+    dirty_page_num += iter.second->dirty_pages().size();
+  }
+  return dirty_page_num;
+}
+
+bool BufferPoolManager::min_dirty_lsn(LSN &lsn)
+{
+  scoped_lock lock_guard(lock_);
+
+  bool found = false;
+  for (auto &iter : id_to_buffer_pools_) {
+    LSN oldest_lsn = 0;
+    if (iter.second->dirty_pages().oldest_lsn(oldest_lsn) && (!found || oldest_lsn < lsn)) {
+      lsn   = oldest_lsn;
+      found = true;
+    }
+  }
+  return found;
+}
+
+int BufferPoolManager::flush_dirty_pages(int max_count)
+{
+  scoped_lock cleaner_guard(page_cleaner_lock_);
+
+  // 每个buffer pool中最老的max_count个脏页，合并后再按照LSN排序
+  using DirtyPage = tuple<LSN, DiskBufferPool *, PageNum>;
+  vector<DirtyPage> dirty_pages;
+  {
+    scoped_lock lock_guard(lock_);
+
+    vector<pair<LSN, PageNum>> pages;
+    for (auto &iter : id_to_buffer_pools_) {
+      DiskBufferPool *bp = iter.second;
+      pages.clear();
+      bp->dirty_pages().oldest(max_count, pages);
+      for (auto &page : pages) {
+        dirty_pages.emplace_back(page.first, bp, page.second);
+      }
+    }
+  }
+
+  if (dirty_pages.size() > static_cast<size_t>(max_count)) {
+    partial_sort(dirty_pages.begin(), dirty_pages.begin() + max_count, dirty_pages.end());
+    dirty_pages.resize(max_count);
+  } else {
+    sort(dirty_pages.begin(), dirty_pages.end());
+  }
+
+  int flushed_count = 0;
+  for (auto &[lsn, bp, page_num] : dirty_pages) {
+    RC rc = bp->clean_page(page_num);
+    if (OB_SUCC(rc)) {
+      flushed_count++;
+    } else {
+      LOG_TRACE("failed to clean page. buffer pool=%d, page num=%d, lsn=%ld, rc=%s", bp->id(), page_num, lsn, strrc(rc));
+    }
+  }
+
+  LOG_DEBUG("flush dirty pages done. flushed=%d, candidates=%d", flushed_count, (int)dirty_pages.size());
+  return flushed_count;
+}
@@ -26,14 +26,20 @@ See the Mulan PSL v2 for more details. */
 #include <optional>
 
 #include "common/lang/bitmap.h"
-#include "common/lang/lru_cache.h"
 #include "common/lang/mutex.h"
 #include "common/lang/memory.h"
 #include "common/lang/unordered_map.h"
+#include "common/lang/vector.h"
 #include "common/mm/mem_pool.h"
 #include "common/sys/rc.h"
 #include "common/types.h"
+#include "storage/buffer/buffer_pool_stats.h"
+#include "storage/buffer/buffer_pool_warmer.h"
 #include "storage/buffer/frame.h"
+#include "storage/buffer/frame_arena.h"
+#include "storage/buffer/frame_replacer.h"
+#include "storage/buffer/page_cleaner.h"
+#include "storage/buffer/page_read_ahead.h"
 #include "storage/buffer/page.h"
 #include "storage/buffer/buffer_pool_log.h"
 
@@ -84,13 +90,26 @@ struct BPFileHeader
  * 当内存中的页帧不够用时，需要从内存中淘汰一些页帧，以便为新的页帧腾出空间。
  * 这个管理器负责为所有的BufferPool提供页帧管理服务，也就是所有的BufferPool磁盘文件
  * 在访问时都使用这个管理器映射到内存。
+ *
+ * 所有的页帧按照 FrameId::hash() 划分到多个分片(shard)中，每个分片有自己的置换策略(FrameReplacer)、
+ * 空闲页帧和锁，这样不同页面的访问就不会竞争同一把锁。分片个数为1时，与不分片的实现完全一致。
+ * 需要注意的是，淘汰页帧也只能在同一个分片内进行，因此每个分片的页帧个数不能太少，
+ * 否则某个分片中的页帧全部被pin住时，就无法再分配新的页帧。
  */
 class BPFrameManager
 {
 public:
   BPFrameManager(const char *tag);
 
-  RC init(int pool_num);
+  /**
+   * @brief 初始化
+   *
+   * @param pool_num 内存池的个数，每个内存池包含 DEFAULT_ITEM_NUM_PER_POOL 个页帧
+   * @param shard_num 分片个数。每个分片至少会分配一个内存池大小的页帧，所以实际分片个数可能会比这个值小
+   * @param replacer_name 页帧置换策略，参考 FrameReplacer::create
+   * @param huge_page 页面内存是否尝试使用大页，参考 FrameArena
+   */
+  RC init(int pool_num, int shard_num = 1, const char *replacer_name = "lru", bool huge_page = false);
   RC cleanup();
 
   /**
@@ -110,6 +129,23 @@ public:
    */
   list<Frame *> find_list(int buffer_pool_id);
 
+  /**
+   * @brief 页面是否在内存中
+   * @details 与 get 不同，不会pin页帧，也不会影响置换策略和命中率统计
+   */
+  bool contains(int buffer_pool_id, PageNum page_num) const;
+
+  /**
+   * @brief 列出内存中所有页面的编号，按照最近访问时间从新到旧排序
+   * @details buffer pool 预热时使用，参考 BufferPoolWarmer
+   */
+  void resident_frames(vector<FrameId> &frame_ids) const;
+
+  /**
+   * @brief 统计每个buffer pool在内存中的页面个数
+   */
+  void frame_num_by_buffer_pool(unordered_map<int32_t, int64_t> &frame_nums) const;
+
   /**
    * @brief 分配一个新的页面
    *
@@ -125,25 +161,41 @@ public:
    */
   RC free(int buffer_pool_id, PageNum page_num, Frame *frame);
 
+  /**
+   * @brief 只有调用者是唯一pin住页帧的人时才释放页帧
+   * @details 其它人还pin着页帧时返回 LOCKED_NEED_WAIT，比如B+树乐观读的读者正在读这个页面
+   */
+  RC try_free(int buffer_pool_id, PageNum page_num, Frame *frame);
+
   /**
    * 如果不能从空闲链表中分配新的页面，就使用这个接口，
-   * 尝试从pin count=0的页面中淘汰一些
+   * 按照置换策略给出的顺序，尝试从pin count=0的页面中淘汰一些
+   * @param buffer_pool_id 想要分配的页面所在的buffer pool，与page_num一起决定从哪个分片中淘汰
+   * @param page_num 想要分配的页面编号
    * @param count 想要purge多少个页面
    * @param purger 需要在释放frame之前，对页面做些什么操作。当前是刷新脏数据到磁盘
    * @return 返回本次清理了多少个页面
    */
-  int purge_frames(int count, function<RC(Frame *frame)> purger);
+  int purge_frames(int buffer_pool_id, PageNum page_num, int count, function<RC(Frame *frame)> purger);
 
-  size_t frame_num() const { return frames_.count(); }
+  size_t frame_num() const;
 
   /**
    * 测试使用。返回已经从内存申请的个数
    */
-  size_t total_frame_num() const { return allocator_.get_size(); }
+  size_t total_frame_num() const;
 
-private:
-  Frame *get_internal(const FrameId &frame_id);
-  RC     free_internal(const FrameId &frame_id, Frame *frame);
+  int shard_num() const { return static_cast<int>(shards_.size()); }
+
+  /**
+   * @brief 调用 get 时在内存中找到页面的次数
+   */
+  int64_t hit_count() const;
+
+  /**
+   * @brief 调用 get 时没有在内存中找到页面的次数
+   */
+  int64_t miss_count() const;
 
 private:
   class BPFrameIdHasher
@@ -152,12 +204,31 @@ private:
     size_t operator()(const FrameId &frame_id) const { return frame_id.hash(); }
   };
 
-  using FrameLruCache  = common::LruCache<FrameId, Frame *, BPFrameIdHasher>;
-  using FrameAllocator = common::MemPoolSimple<Frame>;
+  using FrameMap       = unordered_map<FrameId, Frame *, BPFrameIdHasher>;
+  using FrameAllocator = FrameArena;
+
+  /**
+   * @brief 页帧分片
+   * @details 每个分片管理一部分页帧，分片之间互不影响
+   */
+  struct FrameShard
+  {
+    mutable mutex             lock;
+    FrameMap                  frames;
+    unique_ptr<FrameReplacer> replacer;
+    FrameAllocator            allocator;
+    int64_t                   hit_count  = 0;
+    int64_t                   miss_count = 0;
+  };
+
+  FrameShard &shard_of(const FrameId &frame_id) const { return *shards_[frame_id.hash() % shards_.size()]; }
+
+  Frame *get_internal(FrameShard &shard, const FrameId &frame_id);
+  RC     free_internal(FrameShard &shard, const FrameId &frame_id, Frame *frame);
 
-  mutex          lock_;
-  FrameLruCache  frames_;
-  FrameAllocator allocator_;
+private:
+  string                         tag_;
+  vector<unique_ptr<FrameShard>> shards_;
 };
 
 /**
@@ -266,12 +337,32 @@ public:
    */
   RC write_page(PageNum page_num, Page &page);
 
+  /**
+   * @brief 把指定的页面加载到内存中
+   * @details buffer pool 预热时使用。已经在内存中或者没有分配的页面会被跳过，
+   * 连续的页面会合并成一次读取
+   * @param page_nums 要加载的页面，会被排序
+   * @return 加载的页面个数
+   */
+  int warm_up(vector<PageNum> &page_nums);
+
   RC redo_allocate_page(LSN lsn, PageNum page_num);
   RC redo_deallocate_page(LSN lsn, PageNum page_num);
 
+  /**
+   * @brief 后台刷脏时刷新一个脏页
+   * @details 页面已经不在内存中或者不是脏页时，直接从脏页列表中删除。
+   * 如果页面正在被其它线程修改，就跳过，下一轮再刷。
+   */
+  RC clean_page(PageNum page_num);
+
 public:
   int32_t id() const { return buffer_pool_id_; }
 
+  const DirtyPageList &dirty_pages() const { return dirty_pages_; }
+  const PageReadAhead &read_ahead() const { return read_ahead_; }
+  const BufferPoolStats &stats() const { return stats_; }
+
   const char *filename() const { return file_name_.c_str(); }
 
 protected:
@@ -293,6 +384,13 @@ protected:
    */
   RC flush_page_internal(Frame &frame);
 
+  /**
+   * @brief 返回可以直接用于读写文件的页面内存
+   * @details 使用 direct IO 并且页面内存没有对齐时，返回一个线程内的对齐页面。写文件时会先复制数据，
+   * 读文件时需要调用者把数据复制回来
+   */
+  Page *aligned_page(Page &page, bool read);
+
 private:
   BufferPoolManager   &bp_manager_;     /// BufferPool 管理器
   BPFrameManager      &frame_manager_;  /// Frame 管理器
@@ -301,15 +399,17 @@ private:
 
   int file_desc_ = -1;  /// 文件描述符
   /// 由于在最开始打开文件时，没有正确的buffer pool id不能加载header frame，所以单独从文件中读取此标识
-  int32_t       buffer_pool_id_ = -1;
-  Frame        *hdr_frame_      = nullptr;  /// 文件头页面
-  BPFileHeader *file_header_    = nullptr;  /// 文件头
-  set<PageNum>  disposed_pages_;            /// 已经释放的页面
+  int32_t         buffer_pool_id_ = -1;
+  Frame          *hdr_frame_      = nullptr;  /// 文件头页面
+  BPFileHeader   *file_header_    = nullptr;  /// 文件头
+  set<PageNum>    disposed_pages_;            /// 已经释放的页面
+  DirtyPageList   dirty_pages_;               /// 脏页列表，后台刷脏时使用
+  PageReadAhead   read_ahead_;                /// 顺序扫描时的预读
+  BufferPoolStats stats_;                     /// 统计信息，参考 SHOW BUFFER POOL STATUS
 
   string file_name_;  /// 文件名
 
   common::Mutex lock_;
-  common::Mutex wr_lock_;
 
 private:
   friend class BufferPoolIterator;
@@ -322,7 +422,15 @@ private:
 class BufferPoolManager final
 {
 public:
-  BufferPoolManager(int memory_size = 0);
+  /**
+   * @param memory_size 所有页帧使用的内存大小
+   * @param frame_shard_num 页帧管理器的分片个数，参考 BPFrameManager
+   * @param replacer_name 页帧置换策略，参考 FrameReplacer
+   * @param direct_io 读写页面时是否绕过操作系统的页缓存，避免数据在内存中缓存两份
+   * @param huge_page 页帧内存是否尝试使用大页
+   */
+  BufferPoolManager(int memory_size = 0, int frame_shard_num = 1, const char *replacer_name = "lru",
+      bool direct_io = false, bool huge_page = false);
   ~BufferPoolManager();
 
   RC init(unique_ptr<DoubleWriteBuffer> dblwr_buffer);
@@ -333,6 +441,64 @@ public:
 
   RC flush_page(Frame &frame);
 
+  /**
+   * @brief 启动后台刷脏线程，参考 PageCleaner
+   */
+  RC   start_page_cleaner(int dirty_ratio, int batch_size);
+  void stop_page_cleaner();
+  void wakeup_page_cleaner();
+
+  /**
+   * @brief 在所有的buffer pool中，按照LSN从小到大刷新最多max_count个脏页
+   * @return 刷新的页面个数
+   */
+  int flush_dirty_pages(int max_count);
+
+  /**
+   * @brief 所有buffer pool中脏页的个数
+   */
+  size_t dirty_page_num();
+
+  /**
+   * @brief 所有buffer pool的脏页中，最早变脏时的LSN
+   * @details 比这个LSN小的日志，对应的修改都已经写到了磁盘(或double write buffer)中，
+   * 做检查点时使用。没有脏页时返回false
+   */
+  bool min_dirty_lsn(LSN &lsn);
+
+  /**
+   * @brief 开启顺序预读，参考 PageReadAhead
+   * @details 需要在打开文件之前调用
+   * @param window 一次预读的页面个数，不大于0表示关闭预读
+   * @param thread_num 执行预读的线程个数
+   */
+  RC enable_read_ahead(int window, int thread_num);
+
+  int                         read_ahead_window() const { return read_ahead_window_; }
+  common::ThreadPoolExecutor *read_ahead_executor() { return read_ahead_window_ > 0 ? &read_ahead_executor_ : nullptr; }
+
+  /**
+   * @brief 刷脏时持有这把锁，关闭文件时也需要持有，防止刷脏时buffer pool对象被删除
+   */
+  mutex &page_cleaner_lock() { return page_cleaner_lock_; }
+
+  bool direct_io() const { return direct_io_; }
+
+  /**
+   * @brief 加载上次保存的热点页面，并定期保存内存中的页面列表，参考 BufferPoolWarmer
+   * @details 需要在打开所有文件并且完成恢复之后调用
+   * @param dump_file 保存页面列表的文件
+   * @param dump_interval_sec 保存页面列表的时间间隔(秒)，不大于0表示不做预热
+   */
+  RC   start_warm_up(const char *dump_file, int dump_interval_sec);
+  void stop_warm_up();
+  const BufferPoolWarmer &warmer() const { return warmer_; }
+
+  /**
+   * @brief 获取所有打开的buffer pool的统计信息，按照文件名排序
+   */
+  void collect_status(vector<BufferPoolStatus> &status_list);
+
   BPFrameManager    &get_frame_manager() { return frame_manager_; }
   DoubleWriteBuffer *get_dblwr_buffer() { return dblwr_buffer_.get(); }
 
@@ -346,6 +512,7 @@ public:
 
 private:
   BPFrameManager frame_manager_{"BufPool"};
+  bool           direct_io_ = false;
 
   unique_ptr<DoubleWriteBuffer> dblwr_buffer_;
 
@@ -353,4 +520,12 @@ private:
   unordered_map<string, DiskBufferPool *>  buffer_pools_;
   unordered_map<int32_t, DiskBufferPool *> id_to_buffer_pools_;
   atomic<int32_t> next_buffer_pool_id_{1};  // 系统启动时，会打开所有的表，这样就可以知道当前系统最大的ID是多少了
+
+  mutex       page_cleaner_lock_;
+  PageCleaner page_cleaner_{*this};
+
+  BufferPoolWarmer warmer_{*this};
+
+  int                        read_ahead_window_ = 0;
+  common::ThreadPoolExecutor read_ahead_executor_;
 };
@@ -16,42 +16,114 @@ See the Mulan PSL v2 for more details. */
 #include "storage/buffer/double_write_buffer.h"
 #include "storage/buffer/disk_buffer_pool.h"
 #include "common/io/io.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/vector.h"
 #include "common/log/log.h"
 #include "common/math/crc.h"
+#include "common/thread/thread_util.h"
 
 using namespace common;
 
-struct DoubleWritePage
+const int32_t DoubleWriteBufferHeader::SIZE = sizeof(DoubleWriteBufferHeader);
+
+/**
+ * @brief double write buffer 在内存中的一个批次
+ * @details 页面按照加入的顺序保存在一块对齐的连续内存中，在共享文件中的位置就是它的下标，
+ * 这样一个批次可以一次顺序写入共享文件。页面的标识记录在文件头中，与页面一起写入。
+ */
+struct DoubleWriteBatch
 {
-public:
-  DoubleWritePage() = default;
-  DoubleWritePage(int32_t buffer_pool_id, PageNum page_num, int32_t page_index, Page &page);
+  explicit DoubleWriteBatch(int capacity) { reserve(capacity); }
 
-public:
-  DoubleWritePageKey key;
-  int32_t            page_index = -1;  /// 页面在double write buffer文件中的页索引
-  bool valid = true;  /// 表示页面是否有效，在页面被删除时，需要同时标记磁盘上的值。
-  Page page;
+  DoubleWriteBufferHeader                                         header;  ///< 页面个数和页面标识
+  unique_ptr<Page, decltype(&::free)>                             pages{nullptr, &::free};
+  int                                                             capacity = 0;
+  unordered_map<DoubleWritePageKey, int, DoubleWritePageKeyHash> page_indexes;  ///< 页面在pages中的下标
+  unordered_map<int32_t, DiskBufferPool *>                        buffer_pools;  ///< 页面所属的buffer pool
 
-  static const int32_t SIZE;
-};
+  int  size() const { return header.page_cnt; }
+  bool empty() const { return header.page_cnt == 0; }
+  bool full() const { return header.page_cnt >= capacity; }
 
-DoubleWritePage::DoubleWritePage(int32_t buffer_pool_id, PageNum page_num, int32_t page_index, Page &_page)
-    : key{buffer_pool_id, page_num}, page_index(page_index), page(_page)
-{}
+  Page &page(int index) { return pages.get()[index]; }
 
-const int32_t DoubleWritePage::SIZE = sizeof(DoubleWritePage);
+  Page *find(const DoubleWritePageKey &key)
+  {
+    auto iter = page_indexes.find(key);
+    return iter == page_indexes.end() ? nullptr : &page(iter->second);
+  }
 
-const int32_t DoubleWriteBufferHeader::SIZE = sizeof(DoubleWriteBufferHeader);
+  void reserve(int new_capacity)
+  {
+    if (new_capacity <= capacity) {
+      return;
+    }
+
+    unique_ptr<Page, decltype(&::free)> new_pages(
+        static_cast<Page *>(aligned_alloc(BP_IO_ALIGN, static_cast<size_t>(new_capacity) * sizeof(Page))), &::free);
+    ASSERT(new_pages != nullptr, "failed to allocate memory for double write buffer. capacity=%d", new_capacity);
+    if (size() > 0) {
+      memcpy(new_pages.get(), pages.get(), static_cast<size_t>(size()) * sizeof(Page));
+    }
+    pages    = std::move(new_pages);
+    capacity = new_capacity;
+  }
+
+  void add(DiskBufferPool *bp, const DoubleWritePageKey &key, const Page &new_page)
+  {
+    Page *dblwr_page = find(key);
+    if (dblwr_page != nullptr) {
+      *dblwr_page = new_page;
+      return;
+    }
+
+    reserve(size() + 1);
+    const int32_t page_index = header.page_cnt++;
+    header.keys[page_index]  = key;
+    page(page_index)         = new_page;
+    page_indexes.emplace(key, page_index);
+    if (bp != nullptr) {
+      buffer_pools.emplace(key.buffer_pool_id, bp);
+    }
+  }
 
-DiskDoubleWriteBuffer::DiskDoubleWriteBuffer(BufferPoolManager &bp_manager, int max_pages /*=16*/)
-    : max_pages_(max_pages), bp_manager_(bp_manager)
+  void clear()
+  {
+    header.page_cnt = 0;
+    page_indexes.clear();
+    buffer_pools.clear();
+  }
+};
+
+DiskDoubleWriteBuffer::DiskDoubleWriteBuffer(
+    BufferPoolManager &bp_manager, int max_pages /*=16*/, int write_thread_num /*=4*/)
+    : max_pages_(min(max(max_pages, 1), DoubleWriteBufferHeader::MAX_PAGES)),
+      bp_manager_(bp_manager),
+      active_batch_(make_unique<DoubleWriteBatch>(max_pages_)),
+      flushing_batch_(make_unique<DoubleWriteBatch>(max_pages_)),
+      write_thread_num_(max(write_thread_num, 1))
 {}
 
 DiskDoubleWriteBuffer::~DiskDoubleWriteBuffer()
 {
-  flush_page();
-  close(file_desc_);
+  if (flush_thread_) {
+    flush_page();
+
+    {
+      lock_guard guard(lock_);
+      running_ = false;
+    }
+    flush_cond_.notify_all();
+    flush_thread_->join();
+    flush_thread_.reset();
+
+    write_executor_.shutdown();
+    write_executor_.await_termination();
+  }
+
+  if (file_desc_ >= 0) {
+    close(file_desc_);
+  }
 }
 
 RC DiskDoubleWriteBuffer::open_file(const char *filename)
@@ -61,127 +133,230 @@ RC DiskDoubleWriteBuffer::open_file(const char *filename)
     return RC::BUFFERPOOL_OPEN;
   }
 
-  int fd = open(filename, O_CREAT | O_RDWR, 0644);
+  int fd = common::open_file(filename, O_CREAT | O_RDWR, 0644, bp_manager_.direct_io());
   if (fd < 0) {
     LOG_ERROR("Failed to open or creat %s, due to %s.", filename, strerror(errno));
     return RC::SCHEMA_DB_EXIST;
   }
 
   file_desc_ = fd;
-  return load_pages();
+  RC rc      = load_pages();
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  if (write_executor_.init("DblWrWriter", write_thread_num_, write_thread_num_, 60 * 1000) != 0) {
+    LOG_ERROR("Failed to init double write buffer writer thread pool");
+    return RC::INTERNAL;
+  }
+
+  running_      = true;
+  flush_thread_ = make_unique<thread>(&DiskDoubleWriteBuffer::flush_thread_func, this);
+  return RC::SUCCESS;
 }
 
 RC DiskDoubleWriteBuffer::flush_page()
 {
-  sync();
+  unique_lock guard(lock_);
+  while (!active_batch_->empty() || flush_pending_) {
+    if (!active_batch_->empty()) {
+      submit_batch(guard);
+    }
+    wait_flush_done(guard);
 
-  for (const auto &pair : dblwr_pages_) {
-    RC rc = write_page(pair.second);
-    if (rc != RC::SUCCESS) {
+    if (OB_FAIL(flush_rc_)) {
+      RC rc     = flush_rc_;
+      flush_rc_ = RC::SUCCESS;
       return rc;
     }
-    pair.second->valid = false;
-    write_page_internal(pair.second);
-    delete pair.second;
   }
-
-  dblwr_pages_.clear();
-  header_.page_cnt = 0;
-
   return RC::SUCCESS;
 }
 
 RC DiskDoubleWriteBuffer::add_page(DiskBufferPool *bp, PageNum page_num, Page &page)
 {
-  scoped_lock        lock_guard(lock_);
+  unique_lock        guard(lock_);
   DoubleWritePageKey key{bp->id(), page_num};
-  auto               iter = dblwr_pages_.find(key);
-  if (iter != dblwr_pages_.end()) {
-    iter->second->page = page;
-    LOG_TRACE("[cache hit]add page into double write buffer. buffer_pool_id:%d,page_num:%d,lsn=%d, dwb size=%d",
-              bp->id(), page_num, page.lsn, static_cast<int>(dblwr_pages_.size()));
-    return write_page_internal(iter->second);
-  }
+  active_batch_->add(bp, key, page);
+  LOG_TRACE("add page into double write buffer. buffer_pool_id:%d,page_num:%d,lsn=%d, batch size=%d",
+            bp->id(), page_num, page.lsn, active_batch_->size());
 
-  int64_t          page_cnt   = dblwr_pages_.size();
-  DoubleWritePage *dblwr_page = new DoubleWritePage(bp->id(), page_num, page_cnt, page);
-  dblwr_pages_.insert(pair<DoubleWritePageKey, DoubleWritePage *>(key, dblwr_page));
-  LOG_TRACE("insert page into double write buffer. buffer_pool_id:%d,page_num:%d,lsn=%d, dwb size:%d",
-            bp->id(), page_num, page.lsn, static_cast<int>(dblwr_pages_.size()));
+  if (active_batch_->size() >= max_pages_) {
+    submit_batch(guard);
+  }
 
-  RC rc = write_page_internal(dblwr_page);
+  RC rc = flush_rc_;
   if (OB_FAIL(rc)) {
-    LOG_WARN("failed to write page into double write buffer. rc=%s buffer_pool_id:%d,page_num:%d,lsn=%d.",
-        strrc(rc), bp->id(), page_num, page.lsn);
-    return rc;
+    LOG_ERROR("Failed to flush pages in double write buffer. rc=%s", strrc(rc));
+    flush_rc_ = RC::SUCCESS;
   }
+  return rc;
+}
 
-  if (page_cnt + 1 > header_.page_cnt) {
-    header_.page_cnt = page_cnt + 1;
-    if (lseek(file_desc_, 0, SEEK_SET) == -1) {
-      LOG_ERROR("Failed to add page header due to failed to seek %s.", strerror(errno));
-      return RC::IOERR_SEEK;
-    }
+void DiskDoubleWriteBuffer::submit_batch(unique_lock<mutex> &guard)
+{
+  wait_flush_done(guard);
+
+  swap(active_batch_, flushing_batch_);
+  flush_pending_ = true;
+  flush_cond_.notify_one();
+}
+
+void DiskDoubleWriteBuffer::wait_flush_done(unique_lock<mutex> &guard)
+{
+  flush_done_cond_.wait(guard, [this]() { return !flush_pending_; });
+}
 
-    if (writen(file_desc_, &header_, sizeof(header_)) != 0) {
-      LOG_ERROR("Failed to add page header due to %s.", strerror(errno));
-      return RC::IOERR_WRITE;
+void DiskDoubleWriteBuffer::flush_thread_func()
+{
+  thread_set_name("DblWrFlusher");
+
+  unique_lock guard(lock_);
+  while (true) {
+    flush_cond_.wait(guard, [this]() { return flush_pending_ || !running_; });
+    if (!flush_pending_) {
+      break;  // stopped
     }
-  }
 
-  if (static_cast<int>(dblwr_pages_.size()) >= max_pages_) {
-    RC rc = flush_page();
-    if (rc != RC::SUCCESS) {
-      LOG_ERROR("Failed to flush pages in double write buffer");
-      return rc;
+    // 前台线程不会修改刷盘批次，可以不加锁访问
+    guard.unlock();
+    RC rc = flush_batch(*flushing_batch_);
+    guard.lock();
+
+    if (OB_FAIL(rc)) {
+      flush_rc_ = rc;
     }
+    flushing_batch_->clear();
+    flush_pending_ = false;
+    flush_done_cond_.notify_all();
   }
-
-  return RC::SUCCESS;
 }
 
-RC DiskDoubleWriteBuffer::write_page_internal(DoubleWritePage *page)
+RC DiskDoubleWriteBuffer::flush_batch(DoubleWriteBatch &batch)
 {
-  int32_t page_index = page->page_index;
-  int64_t offset     = page_index * DoubleWritePage::SIZE + DoubleWriteBufferHeader::SIZE;
-  if (lseek(file_desc_, offset, SEEK_SET) == -1) {
-    LOG_ERROR("Failed to add page %lld of %d due to failed to seek %s.", offset, file_desc_, strerror(errno));
-    return RC::IOERR_SEEK;
+  if (batch.empty()) {
+    return RC::SUCCESS;
   }
 
-  if (writen(file_desc_, page, DoubleWritePage::SIZE) != 0) {
-    LOG_ERROR("Failed to add page %lld of %d due to %s.", offset, file_desc_, strerror(errno));
+  // 1. 所有页面顺序写入共享文件，然后写入记录了页面标识的文件头，只需要一次fsync
+  const int64_t data_size = static_cast<int64_t>(batch.size()) * sizeof(Page);
+  if (pwriten(file_desc_, batch.pages.get(), static_cast<int>(data_size), DoubleWriteBufferHeader::SIZE) != 0) {
+    LOG_ERROR("Failed to write double write buffer pages. fd=%d, page count=%d, error=%s",
+              file_desc_, batch.size(), strerror(errno));
     return RC::IOERR_WRITE;
   }
 
-  return RC::SUCCESS;
+  RC rc = write_header(batch.header);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  if (fdatasync(file_desc_) != 0) {
+    LOG_ERROR("Failed to sync double write buffer. fd=%d, error=%s", file_desc_, strerror(errno));
+    return RC::IOERR_SYNC;
+  }
+
+  // 2. 页面写到真实的位置
+  rc = write_home_pages(batch);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  // 3. 共享文件中的页面已经不再需要了。这里不需要sync，下一个批次sync时会一起写入
+  DoubleWriteBufferHeader empty_header{};
+  return write_header(empty_header);
 }
 
-RC DiskDoubleWriteBuffer::write_page(DoubleWritePage *dblwr_page)
+RC DiskDoubleWriteBuffer::write_home_pages(DoubleWriteBatch &batch)
 {
-  DiskBufferPool *disk_buffer = nullptr;
-  // skip invalid page
-  if (!dblwr_page->valid) {
-    LOG_TRACE("double write buffer write page invalid. buffer_pool_id:%d,page_num:%d,lsn=%d",
-              dblwr_page->key.buffer_pool_id, dblwr_page->key.page_num, dblwr_page->page.lsn);
-    return RC::SUCCESS;
+  // 按照文件和页号排序，每个线程负责一段连续的页面
+  vector<int> indexes(batch.size());
+  for (int i = 0; i < batch.size(); i++) {
+    indexes[i] = i;
   }
-  RC rc = bp_manager_.get_buffer_pool(dblwr_page->key.buffer_pool_id, disk_buffer);
-  ASSERT(OB_SUCC(rc) && disk_buffer != nullptr, "failed to get disk buffer pool of %d", dblwr_page->key.buffer_pool_id);
+  const DoubleWritePageKey *keys = batch.header.keys;
+  sort(indexes.begin(), indexes.end(), [keys](int a, int b) {
+    return keys[a].buffer_pool_id < keys[b].buffer_pool_id ||
+           (keys[a].buffer_pool_id == keys[b].buffer_pool_id && keys[a].page_num < keys[b].page_num);
+  });
 
-  LOG_TRACE("double write buffer write page. buffer_pool_id:%d,page_num:%d,lsn=%d",
-            dblwr_page->key.buffer_pool_id, dblwr_page->key.page_num, dblwr_page->page.lsn);
+  const int          task_num = min(write_thread_num_, static_cast<int>(indexes.size()));
+  mutex              done_lock;
+  condition_variable done_cond;
+  int                running_tasks = task_num;
+  RC                 write_rc      = RC::SUCCESS;
+
+  for (int task_index = 0; task_index < task_num; task_index++) {
+    const size_t begin = indexes.size() * task_index / task_num;
+    const size_t end   = indexes.size() * (task_index + 1) / task_num;
+    write_executor_.execute([&, begin, end]() {
+      RC rc = RC::SUCCESS;
+      for (size_t i = begin; i < end && OB_SUCC(rc); i++) {
+        const DoubleWritePageKey &key     = keys[indexes[i]];
+        Page                     &page    = batch.page(indexes[i]);
+        auto                      bp_iter = batch.buffer_pools.find(key.buffer_pool_id);
+        if (bp_iter == batch.buffer_pools.end()) {
+          LOG_WARN("cannot find the buffer pool of page in double write buffer, skip it. buffer_pool_id:%d,page_num:%d",
+                   key.buffer_pool_id, key.page_num);
+          continue;
+        }
+
+        LOG_TRACE("double write buffer write page. buffer_pool_id:%d,page_num:%d,lsn=%d",
+                  key.buffer_pool_id, key.page_num, page.lsn);
+        rc = bp_iter->second->write_page(key.page_num, page);
+      }
+
+      lock_guard guard(done_lock);
+      if (OB_FAIL(rc)) {
+        write_rc = rc;
+      }
+      if (--running_tasks == 0) {
+        done_cond.notify_one();
+      }
+    });
+  }
 
-  return disk_buffer->write_page(dblwr_page->key.page_num, dblwr_page->page);
+  {
+    unique_lock guard(done_lock);
+    done_cond.wait(guard, [&running_tasks]() { return running_tasks == 0; });
+  }
+
+  if (OB_FAIL(write_rc)) {
+    LOG_WARN("failed to write pages of double write buffer. rc=%s", strrc(write_rc));
+    return write_rc;
+  }
+
+  for (const auto &[buffer_pool_id, disk_buffer] : batch.buffer_pools) {
+    if (fsync(disk_buffer->file_desc()) != 0) {
+      LOG_ERROR("Failed to sync buffer pool file %s, error=%s", disk_buffer->filename(), strerror(errno));
+      return RC::IOERR_SYNC;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC DiskDoubleWriteBuffer::write_header(const DoubleWriteBufferHeader &header)
+{
+  if (pwriten(file_desc_, &header, DoubleWriteBufferHeader::SIZE, 0) != 0) {
+    LOG_ERROR("Failed to write double write buffer header due to %s.", strerror(errno));
+    return RC::IOERR_WRITE;
+  }
+  return RC::SUCCESS;
 }
 
 RC DiskDoubleWriteBuffer::read_page(DiskBufferPool *bp, PageNum page_num, Page &page)
 {
-  scoped_lock        lock_guard(lock_);
+  lock_guard         guard(lock_);
   DoubleWritePageKey key{bp->id(), page_num};
-  auto               iter = dblwr_pages_.find(key);
-  if (iter != dblwr_pages_.end()) {
-    page = iter->second->page;
+
+  // 活跃批次中的页面更新
+  Page *dblwr_page = active_batch_->find(key);
+  if (dblwr_page == nullptr) {
+    dblwr_page = flushing_batch_->find(key);
+  }
+
+  if (dblwr_page != nullptr) {
+    page = *dblwr_page;
     LOG_TRACE("double write buffer read page success. bp id=%d, page_num:%d, lsn:%d", bp->id(), page_num, page.lsn);
     return RC::SUCCESS;
   }
@@ -191,43 +366,48 @@ RC DiskDoubleWriteBuffer::read_page(DiskBufferPool *bp, PageNum page_num, Page &
 
 RC DiskDoubleWriteBuffer::clear_pages(DiskBufferPool *buffer_pool)
 {
-  vector<DoubleWritePage *> spec_pages;
-
-  auto remove_pred = [&spec_pages, buffer_pool](const pair<DoubleWritePageKey, DoubleWritePage *> &pair) {
-    DoubleWritePage *dbl_page = pair.second;
-    if (buffer_pool->id() == dbl_page->key.buffer_pool_id) {
-      spec_pages.push_back(dbl_page);
-      return true;
+  unique_lock guard(lock_);
+  // 刷盘批次中可能也有这个buffer pool的页面，等它写完
+  wait_flush_done(guard);
+
+  vector<pair<PageNum, Page *>> spec_pages;
+  auto                          remain_batch = make_unique<DoubleWriteBatch>(max_pages_);
+  for (int i = 0; i < active_batch_->size(); i++) {
+    const DoubleWritePageKey &key = active_batch_->header.keys[i];
+    if (buffer_pool->id() != key.buffer_pool_id) {
+      auto bp_iter = active_batch_->buffer_pools.find(key.buffer_pool_id);
+      remain_batch->add(
+          bp_iter == active_batch_->buffer_pools.end() ? nullptr : bp_iter->second, key, active_batch_->page(i));
     }
-    return false;
-  };
+  }
+
+  // 这些页面没有写入共享文件，buffer pool 关闭前需要同步写入
+  unique_ptr<DoubleWriteBatch> spec_batch = std::move(active_batch_);
+  active_batch_                           = std::move(remain_batch);
+  guard.unlock();
 
-  lock_.lock();
-  erase_if(dblwr_pages_, remove_pred);
-  lock_.unlock();
+  for (int i = 0; i < spec_batch->size(); i++) {
+    const DoubleWritePageKey &key = spec_batch->header.keys[i];
+    if (buffer_pool->id() == key.buffer_pool_id) {
+      spec_pages.emplace_back(key.page_num, &spec_batch->page(i));
+    }
+  }
 
   LOG_DEBUG("clear pages in double write buffer. file name=%s, page count=%d",
            buffer_pool->filename(), spec_pages.size());
 
   // 页面从小到大排序，防止出现小页面还没有写入，而页面编号更大的seek失败的情况
-  sort(spec_pages.begin(), spec_pages.end(), [](DoubleWritePage *a, DoubleWritePage *b) {
-    return a->key.page_num < b->key.page_num;
-  });
+  sort(spec_pages.begin(), spec_pages.end());
 
-  RC rc = RC::SUCCESS;
-  for (DoubleWritePage *dbl_page : spec_pages) {
-    rc = buffer_pool->write_page(dbl_page->key.page_num, dbl_page->page);
+  for (auto &[page_num, page] : spec_pages) {
+    RC rc = buffer_pool->write_page(page_num, *page);
     if (OB_FAIL(rc)) {
       LOG_WARN("Failed to write page %s:%d to disk buffer pool. rc=%s",
-               buffer_pool->filename(), dbl_page->key.page_num, strrc(rc));
-      break;
+               buffer_pool->filename(), page_num, strrc(rc));
+      return rc;
     }
-    dbl_page->valid = false;
-    write_page_internal(dbl_page);
   }
 
-  for_each(spec_pages.begin(), spec_pages.end(), [](DoubleWritePage *dbl_page) { delete dbl_page; });
-
   return RC::SUCCESS;
 }
 
@@ -238,56 +418,74 @@ RC DiskDoubleWriteBuffer::load_pages()
     return RC::BUFFERPOOL_OPEN;
   }
 
-  if (!dblwr_pages_.empty()) {
+  if (!active_batch_->empty()) {
     LOG_ERROR("Failed to load pages, due to double write buffer is not empty. opened?");
     return RC::BUFFERPOOL_OPEN;
   }
 
-  if (lseek(file_desc_, 0, SEEK_SET) == -1) {
-    LOG_ERROR("Failed to load page header, due to failed to lseek:%s.", strerror(errno));
-    return RC::IOERR_SEEK;
-  }
-
-  int ret = readn(file_desc_, &header_, sizeof(header_));
+  auto header = make_unique<DoubleWriteBufferHeader>();
+  int  ret    = preadn(file_desc_, header.get(), DoubleWriteBufferHeader::SIZE, 0);
   if (ret != 0 && ret != -1) {
     LOG_ERROR("Failed to load page header, file_desc:%d, due to failed to read data:%s, ret=%d",
                 file_desc_, strerror(errno), ret);
     return RC::IOERR_READ;
   }
 
-  for (int page_num = 0; page_num < header_.page_cnt; page_num++) {
-    int64_t offset = ((int64_t)page_num) * DoubleWritePage::SIZE + DoubleWriteBufferHeader::SIZE;
+  if (ret == -1 || header->page_cnt < 0 || header->page_cnt > DoubleWriteBufferHeader::MAX_PAGES) {
+    LOG_INFO("double write buffer is empty or has an invalid header. page count=%d", ret == -1 ? 0 : header->page_cnt);
+    return RC::SUCCESS;
+  }
 
-    if (lseek(file_desc_, offset, SEEK_SET) == -1) {
-      LOG_ERROR("Failed to load page %d, offset=%ld, due to failed to lseek:%s.", page_num, offset, strerror(errno));
-      return RC::IOERR_SEEK;
-    }
+  active_batch_->reserve(header->page_cnt);
 
-    auto  dblwr_page = make_unique<DoubleWritePage>();
-    Page &page       = dblwr_page->page;
-    page.check_sum   = (CheckSum)-1;
+  alignas(BP_IO_ALIGN) Page page;
+  for (int page_index = 0; page_index < header->page_cnt; page_index++) {
+    int64_t offset = ((int64_t)page_index) * sizeof(Page) + DoubleWriteBufferHeader::SIZE;
 
-    ret = readn(file_desc_, dblwr_page.get(), DoubleWritePage::SIZE);
+    page.check_sum = (CheckSum)-1;
+    ret = preadn(file_desc_, &page, sizeof(Page), offset);
     if (ret != 0) {
-      LOG_ERROR("Failed to load page, file_desc:%d, page num:%d, due to failed to read data:%s, ret=%d, page count=%d",
-                file_desc_, page_num, strerror(errno), ret, page_num);
+      LOG_ERROR("Failed to load page, file_desc:%d, page index:%d, due to failed to read data:%s, ret=%d",
+                file_desc_, page_index, strerror(errno), ret);
       return RC::IOERR_READ;
     }
 
     const CheckSum check_sum = crc32(page.data, BP_PAGE_DATA_SIZE);
     if (check_sum == page.check_sum) {
-      DoubleWritePageKey key = dblwr_page->key;
-      dblwr_pages_.insert(pair<DoubleWritePageKey, DoubleWritePage *>(key, dblwr_page.release()));
+      // 启动时还没有打开buffer pool，写盘时再查找
+      active_batch_->add(nullptr, header->keys[page_index], page);
     } else {
       LOG_TRACE("got a page with an invalid checksum. on disk:%d, in memory:%d", page.check_sum, check_sum);
     }
   }
 
-  LOG_INFO("double write buffer load pages done. page num=%d", dblwr_pages_.size());
+  LOG_INFO("double write buffer load pages done. page num=%d", active_batch_->size());
   return RC::SUCCESS;
 }
 
-RC DiskDoubleWriteBuffer::recover() { return flush_page(); }
+RC DiskDoubleWriteBuffer::recover()
+{
+  {
+    // 从文件中加载的页面还不知道属于哪个buffer pool
+    lock_guard guard(lock_);
+    for (int i = 0; i < active_batch_->size(); i++) {
+      const int32_t buffer_pool_id = active_batch_->header.keys[i].buffer_pool_id;
+      if (active_batch_->buffer_pools.find(buffer_pool_id) != active_batch_->buffer_pools.end()) {
+        continue;
+      }
+
+      DiskBufferPool *disk_buffer = nullptr;
+      RC              rc          = bp_manager_.get_buffer_pool(buffer_pool_id, disk_buffer);
+      if (OB_FAIL(rc) || disk_buffer == nullptr) {
+        LOG_WARN("failed to get disk buffer pool of %d. rc=%s", buffer_pool_id, strrc(rc));
+        continue;
+      }
+      active_batch_->buffer_pools.emplace(buffer_pool_id, disk_buffer);
+    }
+  }
+
+  return flush_page();
+}
 
 ////////////////////////////////////////////////////////////////
 RC VacuousDoubleWriteBuffer::add_page(DiskBufferPool *bp, PageNum page_num, Page &page)
@@ -14,14 +14,17 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "common/lang/condition_variable.h"
+#include "common/lang/memory.h"
 #include "common/lang/mutex.h"
+#include "common/lang/thread.h"
 #include "common/lang/unordered_map.h"
+#include "common/thread/thread_pool_executor.h"
 #include "common/types.h"
 #include "common/sys/rc.h"
 #include "storage/buffer/page.h"
 
 class DiskBufferPool;
-struct DoubleWritePage;
 class BufferPoolManager;
 
 class DoubleWriteBuffer
@@ -43,13 +46,6 @@ public:
   virtual RC clear_pages(DiskBufferPool *bp) = 0;
 };
 
-struct DoubleWriteBufferHeader
-{
-  int32_t page_cnt = 0;
-
-  static const int32_t SIZE;
-};
-
 // TODO change to FrameId
 struct DoubleWritePageKey
 {
@@ -62,6 +58,22 @@ struct DoubleWritePageKey
   }
 };
 
+/**
+ * @brief double write buffer 的文件头
+ * @details 文件头占用一个 BP_IO_ALIGN 大小的块，记录页面个数和每个页面的标识，后面紧跟着页面数据。
+ * 这样文件中的所有读写都是对齐的，可以使用 direct IO。
+ */
+struct alignas(BP_IO_ALIGN) DoubleWriteBufferHeader
+{
+  /// 文件头中最多可以记录的页面个数
+  static constexpr int MAX_PAGES = (BP_IO_ALIGN - sizeof(int32_t)) / sizeof(DoubleWritePageKey);
+
+  int32_t            page_cnt = 0;
+  DoubleWritePageKey keys[MAX_PAGES];
+
+  static const int32_t SIZE;
+};
+
 struct DoubleWritePageKeyHash
 {
   size_t operator()(const DoubleWritePageKey &key) const
@@ -70,6 +82,8 @@ struct DoubleWritePageKeyHash
   }
 };
 
+struct DoubleWriteBatch;
+
 /**
  * @brief 页面二次缓冲区，为了解决页面原子写入的问题
  * @ingroup BufferPool
@@ -80,7 +94,11 @@ struct DoubleWritePageKeyHash
  * 当我们从磁盘中读取页面时，会校验页面的checksum，如果校验失败，则说明页面写入不完整，这时候可以从
  * DoubleWriteBuffer中读取数据。
  *
- * @note 每次都要保证，不管在内存中还是在文件中，这里的数据都是最新的，都比Buffer pool中的数据要新
+ * 内存中有两个批次(batch)。前台线程调用add_page时只是把页面复制到活跃批次中，不做任何IO。
+ * 活跃批次满了之后，与刷盘批次交换，由后台线程把刷盘批次顺序写入共享文件并执行一次fsync，
+ * 然后再使用线程池并行地把页面写到各自的位置。只有后台线程还没有处理完上一个批次时，前台线程才需要等待。
+ *
+ * @note 页面在写入真实位置之前，一直保存在某个批次中，所以这里的数据都比Buffer pool文件中的数据要新
  */
 class DiskDoubleWriteBuffer : public DoubleWriteBuffer
 {
@@ -89,24 +107,26 @@ public:
    * @brief 构造函数
    *
    * @param bp_manager 关联的buffer pool manager
-   * @param max_pages  内存中保存的最大页面数
+   * @param max_pages  每个批次最多保存的页面数，不能超过 DoubleWriteBufferHeader::MAX_PAGES
+   * @param write_thread_num 并行写页面时使用的线程数
    */
-  DiskDoubleWriteBuffer(BufferPoolManager &bp_manager, int max_pages = 16);
+  DiskDoubleWriteBuffer(BufferPoolManager &bp_manager, int max_pages = 16, int write_thread_num = 4);
   virtual ~DiskDoubleWriteBuffer();
 
   /**
-   * 打开磁盘中的共享表空间文件
+   * 打开磁盘中的共享表空间文件，并启动后台刷盘线程
    */
   RC open_file(const char *filename);
 
   /**
-   * 将buffer中的页全部写入磁盘，并且清空buffer
-   * TODO 目前的解决方案是等buffer装满后再刷盘，可能会导致程序卡住一段时间
+   * @brief 将所有批次中的页面写入磁盘，并且清空buffer
+   * @details 同步等待后台线程把所有页面写到真实的位置
    */
   RC flush_page();
 
   /**
-   * 将页面加入buffer，并且写入磁盘中的共享表空间
+   * @brief 将页面加入活跃批次
+   * @details 活跃批次满了之后，交给后台线程写入磁盘
    */
   RC add_page(DiskBufferPool *bp, PageNum page_num, Page &page) override;
 
@@ -118,22 +138,39 @@ public:
   RC clear_pages(DiskBufferPool *bp) override;
 
   /**
-   * 将共享表空间的页读入buffer
+   * 将共享表空间中的页面写入真实的位置
    */
   RC recover();
 
 private:
   /**
-   * 将buffer中的页面写入对应的磁盘
+   * @brief 后台刷盘线程
    */
-  RC write_page(DoubleWritePage *page);
+  void flush_thread_func();
 
   /**
-   * 将页面写到当前double write buffer文件中
-   * @details 每次页面更新都应该写入到磁盘中。保证double write buffer
-   * 内存和文件中的数据都是最新的。
+   * @brief 把活跃批次交给后台线程
+   * @details 调用前需要加锁。如果后台线程还在处理上一个批次，就等待它完成
    */
-  RC write_page_internal(DoubleWritePage *page);
+  void submit_batch(unique_lock<mutex> &guard);
+
+  /**
+   * @brief 等待后台线程处理完当前的批次。调用前需要加锁
+   */
+  void wait_flush_done(unique_lock<mutex> &guard);
+
+  /**
+   * @brief 写入一个批次的页面
+   * @details 先顺序写入共享文件并fsync，再并行写到真实位置
+   */
+  RC flush_batch(DoubleWriteBatch &batch);
+
+  /**
+   * @brief 将批次中的页面写到真实的位置，并fsync相关的buffer pool文件
+   */
+  RC write_home_pages(DoubleWriteBatch &batch);
+
+  RC write_header(const DoubleWriteBufferHeader &header);
 
   /**
    * @brief 将磁盘文件中的内容加载到内存中。在启动时调用
@@ -141,13 +178,22 @@ private:
   RC load_pages();
 
 private:
-  int                     file_desc_ = -1;
-  int                     max_pages_ = 0;
-  common::Mutex           lock_;
-  BufferPoolManager      &bp_manager_;
-  DoubleWriteBufferHeader header_;
-
-  unordered_map<DoubleWritePageKey, DoubleWritePage *, DoubleWritePageKeyHash> dblwr_pages_;
+  int                file_desc_ = -1;
+  int                max_pages_ = 0;
+  BufferPoolManager &bp_manager_;
+
+  mutex                        lock_;
+  condition_variable           flush_cond_;       ///< 通知后台线程有新的批次
+  condition_variable           flush_done_cond_;  ///< 通知前台线程批次已经处理完成
+  unique_ptr<DoubleWriteBatch> active_batch_;     ///< 接收新页面的批次
+  unique_ptr<DoubleWriteBatch> flushing_batch_;   ///< 正在写盘的批次
+  bool                         flush_pending_ = false;        ///< flushing_batch_ 是否还没有处理完
+  RC                           flush_rc_      = RC::SUCCESS;  ///< 后台刷盘的错误，返回给下一次调用
+
+  int                        write_thread_num_ = 0;
+  common::ThreadPoolExecutor write_executor_;  ///< 并行写页面的线程池
+  unique_ptr<thread>         flush_thread_;
+  bool                       running_ = false;
 };
 
 class VacuousDoubleWriteBuffer : public DoubleWriteBuffer
@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "storage/buffer/frame.h"
+#include "storage/buffer/page_cleaner.h"
 #include "session/session.h"
 #include "session/thread_data.h"
 
@@ -38,6 +39,15 @@ string FrameId::to_string() const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+/// 所有页帧共用一个版本号生成器，保证版本号不会重复
+static atomic<uint64_t> frame_version_generator{0};
+
+static uint64_t next_frame_version() { return frame_version_generator.fetch_add(2, memory_order_relaxed) + 2; }
+
+Frame::Frame() : owned_page_(make_unique<Page>()), page_(owned_page_.get()) {}
+
+Frame::Frame(Page *page) : page_(page) {}
+
 intptr_t get_default_debug_xid()
 {
 #if 0
@@ -76,6 +86,12 @@ void Frame::write_latch(intptr_t xid)
 
   lock_.lock();
 
+  if (write_depth_++ == 0) {
+    // 先让版本号变成奇数，再修改页面，乐观读的读者就能发现页面正在被修改
+    version_.store(version_.load(memory_order_relaxed) | 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+  }
+
 #ifdef DEBUG
   write_locker_ = xid;
   ++write_recursive_count_;
@@ -120,9 +136,21 @@ void Frame::write_unlatch(intptr_t xid)
   }
   debug_lock_.unlock();
 
+  if (--write_depth_ == 0) {
+    version_.store(next_frame_version(), memory_order_release);
+  }
   lock_.unlock();
 }
 
+bool Frame::validate_version(uint64_t version) const
+{
+  // 保证前面读取页面数据的动作不会重排到读取版本号之后
+  atomic_thread_fence(memory_order_acquire);
+  return version_.load(memory_order_relaxed) == version;
+}
+
+void Frame::renew_version() { version_.store(next_frame_version(), memory_order_release); }
+
 void Frame::read_latch() { read_latch(get_default_debug_xid()); }
 
 void Frame::read_latch(intptr_t xid)
@@ -290,7 +318,15 @@ unsigned long current_time()
   return tp.tv_sec * 1000 * 1000 * 1000UL + tp.tv_nsec;
 }
 
-void Frame::access() { acc_time_ = current_time(); }
+void Frame::access() { acc_time_.store(current_time(), memory_order_relaxed); }
+
+void Frame::mark_dirty()
+{
+  if (!dirty_ && dirty_list_ != nullptr) {
+    dirty_list_->add(page_num(), lsn());
+  }
+  dirty_ = true;
+}
 
 string Frame::to_string() const
 {
@@ -17,6 +17,7 @@ See the Mulan PSL v2 for more details. */
 #include <pthread.h>
 #include <string.h>
 
+#include "common/lang/memory.h"
 #include "common/lang/mutex.h"
 #include "common/lang/string.h"
 #include "common/lang/atomic.h"
@@ -25,6 +26,8 @@ See the Mulan PSL v2 for more details. */
 #include "common/types.h"
 #include "storage/buffer/page.h"
 
+class DirtyPageList;
+
 /**
  * @brief 页帧标识符
  * @ingroup BufferPool
@@ -65,20 +68,30 @@ private:
 class Frame
 {
 public:
+  /**
+   * @brief 单独使用的页帧，自己申请页面内存
+   */
+  Frame();
+
+  /**
+   * @brief 页面内存由外部管理，参考 FrameArena
+   */
+  explicit Frame(Page *page);
+
   ~Frame()
   {
     // LOG_DEBUG("deallocate frame. this=%p, lbt=%s", this, common::lbt());
   }
 
   /**
-   * @brief reinit 和 reset 在 MemPoolSimple 中使用
-   * @details 在 MemPoolSimple 分配和释放一个Frame对象时，不会调用构造函数和析构函数，
+   * @brief reinit 和 reset 在 FrameArena 中使用
+   * @details 在 FrameArena 分配和释放一个Frame对象时，不会调用构造函数和析构函数，
    * 而是调用reinit和reset。
    */
   void reinit() {}
-  void reset() {}
+  void reset() { dirty_list_ = nullptr; }
 
-  void clear_page() { memset(&page_, 0, sizeof(page_)); }
+  void clear_page() { memset(page_, 0, sizeof(Page)); }
 
   int  buffer_pool_id() const { return frame_id_.buffer_pool_id(); }
   void set_buffer_pool_id(int id) { frame_id_.set_buffer_pool_id(id); }
@@ -88,7 +101,7 @@ public:
    * @details 磁盘文件划分为一个个页面，每次从磁盘加载到内存中，也是一个页面，就是 Page。
    * frame 是为了管理这些页面而维护的一个数据结构。
    */
-  Page &page() { return page_; }
+  Page &page() { return *page_; }
 
   /**
    * @brief 每个页面都有一个编号
@@ -103,15 +116,15 @@ public:
    * @details 如果当前页面从磁盘中加载出来时，它的日志序列号比当前WAL(Write-Ahead-Logging)中的一些
    * 序列号要小，那就可以从日志中读取这些更大序列号的日志，做重做操作，将页面恢复到最新状态，也就是redo。
    */
-  LSN  lsn() const { return page_.lsn; }
-  void set_lsn(LSN lsn) { page_.lsn = lsn; }
+  LSN  lsn() const { return page_->lsn; }
+  void set_lsn(LSN lsn) { page_->lsn = lsn; }
 
   /**
    * @brief 页面校验和
    * @details 用于校验页面完整性。如果页面写入一半时出现异常，可以通过校验和检测出来。
    */
-  CheckSum check_sum() const { return page_.check_sum; }
-  void     set_check_sum(CheckSum check_sum) { page_.check_sum = check_sum; }
+  CheckSum check_sum() const { return page_->check_sum; }
+  void     set_check_sum(CheckSum check_sum) { page_->check_sum = check_sum; }
 
   /**
    * @brief 刷新当前内存页面的访问时间
@@ -120,13 +133,20 @@ public:
    * 最近最少使用，采用的依据就是访问时间。所以每次访问某个页面时，我们都要刷新一下访问时间。
    */
   void access();
+  unsigned long acc_time() const { return acc_time_.load(memory_order_relaxed); }
 
   /**
    * @brief 标记指定页面为“脏”页。
    * @details 如果修改了页面的内容，则应调用此函数，
-   * 以便该页面被淘汰出缓冲区时系统将新的页面数据写入磁盘文件
+   * 以便该页面被淘汰出缓冲区时系统将新的页面数据写入磁盘文件。
+   * 页面第一次变脏时，会记录到所属buffer pool的脏页列表中。
+   */
+  void mark_dirty();
+
+  /**
+   * @brief 设置页帧所属buffer pool的脏页列表
    */
-  void mark_dirty() { dirty_ = true; }
+  void set_dirty_list(DirtyPageList *dirty_list) { dirty_list_ = dirty_list; }
 
   /**
    * @brief 重置“脏”标记
@@ -135,7 +155,7 @@ public:
   void clear_dirty() { dirty_ = false; }
   bool dirty() const { return dirty_; }
 
-  char *data() { return page_.data; }
+  char *data() { return page_->data; }
 
   bool can_purge() { return pin_count_.load() == 0; }
 
@@ -166,6 +186,29 @@ public:
   void read_unlatch();
   void read_unlatch(intptr_t xid);
 
+  /**
+   * @brief 乐观读使用的版本号
+   * @details 加写锁时版本号变成奇数，释放写锁时换成一个新的偶数。
+   * 读者不加锁读取页面数据，读之前和读之后的版本号相同并且是偶数，说明读的过程中没有人修改页面。
+   * 版本号是全局递增分配的，不同页帧、同一个页帧先后存放的不同页面，版本号都不会相同。
+   */
+  uint64_t version() const { return version_.load(memory_order_acquire); }
+
+  /**
+   * @brief 读完页面数据后，校验页面在读取过程中没有被修改
+   * @param version 读取页面数据之前获取的版本号
+   */
+  bool validate_version(uint64_t version) const;
+
+  /// @brief 版本号是否表示当前有人加着写锁
+  static bool is_write_latched(uint64_t version) { return (version & 1) != 0; }
+
+  /**
+   * @brief 分配一个新的版本号
+   * @details 页帧用来存放另一个页面时调用，之前拿到的版本号都会失效
+   */
+  void renew_version();
+
   string to_string() const;
 
 private:
@@ -173,13 +216,20 @@ private:
 
   bool          dirty_ = false;
   atomic<int>   pin_count_{0};
-  unsigned long acc_time_ = 0;
+  atomic<unsigned long> acc_time_{0};  ///< 预热线程会并发读取
   FrameId       frame_id_;
-  Page          page_;
+
+  unique_ptr<Page> owned_page_;      ///< 单独使用时自己申请的页面内存
+  Page            *page_ = nullptr;  ///< 页面数据。由 FrameArena 分配时按照 BP_IO_ALIGN 对齐
+
+  DirtyPageList *dirty_list_ = nullptr;  ///< 页帧所属buffer pool的脏页列表
 
   /// 在非并发编译时，加锁解锁动作将什么都不做
   common::RecursiveSharedMutex lock_;
 
+  atomic<uint64_t> version_{0};      ///< 乐观读使用的版本号
+  int              write_depth_ = 0;  ///< 写锁重入的次数，只有加着写锁的线程会访问
+
   /// 使用一些手段来做测试，提前检测出头疼的死锁问题
   /// 如果编译时没有增加调试选项，这些代码什么都不做
   common::DebugMutex           debug_lock_;
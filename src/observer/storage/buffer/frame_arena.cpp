@@ -0,0 +1,108 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <sys/mman.h>
+
+#include "storage/buffer/frame_arena.h"
+#include "common/log/log.h"
+
+/// 大页的大小，申请大页时内存大小需要是它的整数倍
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+FrameArena::~FrameArena() { cleanup(); }
+
+RC FrameArena::init(int frame_num, bool huge_page /*= false*/)
+{
+  if (memory_ != nullptr) {
+    LOG_WARN("frame arena has been initialized");
+    return RC::INTERNAL;
+  }
+
+  if (frame_num <= 0) {
+    LOG_WARN("invalid frame num: %d", frame_num);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  // mmap 返回的内存按照系统页面大小对齐，满足 BP_IO_ALIGN 的要求
+  static_assert(BP_PAGE_SIZE % BP_IO_ALIGN == 0, "page size should be aligned to BP_IO_ALIGN");
+  const size_t page_memory_size = static_cast<size_t>(frame_num) * BP_PAGE_SIZE;
+
+#ifdef MAP_HUGETLB
+  if (huge_page) {
+    const size_t size = (page_memory_size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED) {
+      memory_      = memory;
+      memory_size_ = size;
+      huge_page_   = true;
+    } else {
+      LOG_WARN("failed to allocate huge pages, fall back to normal pages. size=%ld, error=%s", size, strerror(errno));
+    }
+  }
+#else
+  if (huge_page) {
+    LOG_WARN("huge page is not supported on this platform");
+  }
+#endif
+
+  if (memory_ == nullptr) {
+    void *memory = mmap(nullptr, page_memory_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+      LOG_ERROR("failed to allocate memory for frames. size=%ld, error=%s", page_memory_size, strerror(errno));
+      return RC::NOMEM;
+    }
+    memory_      = memory;
+    memory_size_ = page_memory_size;
+  }
+
+  Page *pages = static_cast<Page *>(memory_);
+  frames_.reserve(frame_num);
+  free_frames_.reserve(frame_num);
+  for (int i = 0; i < frame_num; i++) {
+    frames_.push_back(make_unique<Frame>(&pages[i]));
+  }
+  // 从后往前放，先分配地址小的页帧
+  for (int i = frame_num - 1; i >= 0; i--) {
+    free_frames_.push_back(frames_[i].get());
+  }
+
+  LOG_INFO("frame arena initialized. frame num=%d, memory size=%ld, huge page=%d", frame_num, memory_size_, huge_page_);
+  return RC::SUCCESS;
+}
+
+void FrameArena::cleanup()
+{
+  free_frames_.clear();
+  frames_.clear();
+  if (memory_ != nullptr) {
+    munmap(memory_, memory_size_);
+    memory_      = nullptr;
+    memory_size_ = 0;
+    huge_page_   = false;
+  }
+}
+
+Frame *FrameArena::alloc()
+{
+  if (free_frames_.empty()) {
+    return nullptr;
+  }
+
+  Frame *frame = free_frames_.back();
+  free_frames_.pop_back();
+  frame->reinit();
+  return frame;
+}
+
+void FrameArena::free(Frame *frame)
+{
+  frame->reset();
+  free_frames_.push_back(frame);
+}
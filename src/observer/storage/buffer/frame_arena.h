@@ -0,0 +1,68 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/memory.h"
+#include "common/lang/vector.h"
+#include "common/sys/rc.h"
+#include "storage/buffer/frame.h"
+
+/**
+ * @brief 页帧的内存池
+ * @ingroup BufferPool
+ * @details 所有页面的内存是一整块按照 BP_IO_ALIGN 对齐的连续内存，可以直接用于 direct IO 的读写。
+ * 页帧的其它信息(锁、引用计数等)单独申请，这样页面之间没有空隙，不会因为对齐浪费内存。
+ * 可以选择使用大页(huge page)来减少TLB miss，申请大页失败时使用普通的内存。
+ *
+ * 与 MemPoolSimple 不同，这里不加锁，由调用者(BPFrameManager 的分片锁)保护。
+ */
+class FrameArena
+{
+public:
+  FrameArena() = default;
+  ~FrameArena();
+
+  /**
+   * @brief 申请内存
+   * @param frame_num 页帧个数，之后不会再扩展
+   * @param huge_page 是否尝试使用大页
+   */
+  RC init(int frame_num, bool huge_page = false);
+
+  /**
+   * @brief 分配一个页帧，没有空闲页帧时返回空
+   */
+  Frame *alloc();
+  void   free(Frame *frame);
+
+  /**
+   * @brief 页帧总数
+   */
+  int size() const { return static_cast<int>(frames_.size()); }
+
+  /**
+   * @brief 已经分配出去的页帧个数
+   */
+  int used_num() const { return size() - static_cast<int>(free_frames_.size()); }
+
+  bool huge_page() const { return huge_page_; }
+
+private:
+  void cleanup();
+
+private:
+  void  *memory_      = nullptr;  ///< 页面内存
+  size_t memory_size_ = 0;
+  bool   huge_page_   = false;  ///< 页面内存是否使用了大页
+
+  vector<unique_ptr<Frame>> frames_;
+  vector<Frame *>           free_frames_;
+};
@@ -0,0 +1,241 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/buffer/frame_replacer.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/string.h"
+#include "common/log/log.h"
+
+RC FrameReplacer::create(const char *name, int capacity, FrameReplacer *&replacer)
+{
+  if (name == nullptr || common::is_blank(name)) {
+    name = "lru";
+  }
+
+  if (strcasecmp(name, "lru") == 0) {
+    replacer = new LruFrameReplacer();
+  } else if (strcasecmp(name, "2q") == 0) {
+    replacer = new TwoQueueFrameReplacer(capacity);
+  } else if (strcasecmp(name, "clock") == 0) {
+    replacer = new ClockFrameReplacer();
+  } else {
+    LOG_WARN("unknown frame replacer: %s", name);
+    return RC::INVALID_ARGUMENT;
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void LruFrameReplacer::insert(Frame *frame)
+{
+  lru_list_.push_front(frame);
+  nodes_[frame] = lru_list_.begin();
+}
+
+void LruFrameReplacer::access(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter == nodes_.end()) {
+    return;
+  }
+
+  lru_list_.splice(lru_list_.begin(), lru_list_, iter->second);
+}
+
+void LruFrameReplacer::remove(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter == nodes_.end()) {
+    return;
+  }
+
+  lru_list_.erase(iter->second);
+  nodes_.erase(iter);
+}
+
+void LruFrameReplacer::foreach_victim(function<bool(Frame *frame)> func)
+{
+  for (auto iter = lru_list_.rbegin(); iter != lru_list_.rend(); ++iter) {
+    if (!func(*iter)) {
+      break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TwoQueueFrameReplacer::TwoQueueFrameReplacer(int capacity)
+{
+  // 论文中推荐 A1in 占用 1/4 的页帧，A1out 记录 1/2 页帧个数的页面
+  a1in_max_size_  = max(capacity / 4, 1);
+  a1out_max_size_ = max(capacity / 2, 1);
+}
+
+void TwoQueueFrameReplacer::insert(Frame *frame)
+{
+  Node node;
+
+  auto ghost_iter = a1out_nodes_.find(frame->frame_id());
+  if (ghost_iter != a1out_nodes_.end()) {
+    a1out_list_.erase(ghost_iter->second);
+    a1out_nodes_.erase(ghost_iter);
+
+    am_list_.push_front(frame);
+    node.in_am = true;
+    node.iter  = am_list_.begin();
+  } else {
+    a1in_list_.push_front(frame);
+    node.in_am = false;
+    node.iter  = a1in_list_.begin();
+  }
+
+  nodes_[frame] = node;
+}
+
+void TwoQueueFrameReplacer::access(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter == nodes_.end()) {
+    return;
+  }
+
+  // A1in 中的页面再次访问时不做任何处理，这样短时间内多次访问同一个页面(比如扫描时逐条读取记录)
+  // 不会让页面进入 Am
+  if (iter->second.in_am) {
+    am_list_.splice(am_list_.begin(), am_list_, iter->second.iter);
+  }
+}
+
+void TwoQueueFrameReplacer::remove(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter == nodes_.end()) {
+    return;
+  }
+
+  if (iter->second.in_am) {
+    am_list_.erase(iter->second.iter);
+  } else {
+    a1in_list_.erase(iter->second.iter);
+
+    const FrameId frame_id = frame->frame_id();
+    if (a1out_nodes_.find(frame_id) == a1out_nodes_.end()) {
+      a1out_list_.push_front(frame_id);
+      a1out_nodes_[frame_id] = a1out_list_.begin();
+    }
+    while (a1out_list_.size() > a1out_max_size_) {
+      a1out_nodes_.erase(a1out_list_.back());
+      a1out_list_.pop_back();
+    }
+  }
+  nodes_.erase(iter);
+}
+
+void TwoQueueFrameReplacer::foreach_victim(function<bool(Frame *frame)> func)
+{
+  auto visit = [&func](list<Frame *> &frames) {
+    for (auto iter = frames.rbegin(); iter != frames.rend(); ++iter) {
+      if (!func(*iter)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  if (a1in_list_.size() > a1in_max_size_) {
+    if (visit(a1in_list_)) {
+      visit(am_list_);
+    }
+  } else {
+    if (visit(am_list_)) {
+      visit(a1in_list_);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ClockFrameReplacer::insert(Frame *frame)
+{
+  // 插入到指针的前面，也就是转一圈后最后才会检查到它
+  Node node;
+  node.iter     = ring_.insert(hand_, frame);
+  nodes_[frame] = node;
+}
+
+void ClockFrameReplacer::access(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter != nodes_.end()) {
+    iter->second.referenced = true;
+  }
+}
+
+void ClockFrameReplacer::remove(Frame *frame)
+{
+  auto iter = nodes_.find(frame);
+  if (iter == nodes_.end()) {
+    return;
+  }
+
+  if (hand_ == iter->second.iter) {
+    advance_hand();
+  }
+  ring_.erase(iter->second.iter);
+  nodes_.erase(iter);
+
+  if (ring_.empty()) {
+    hand_ = ring_.end();
+  }
+}
+
+void ClockFrameReplacer::advance_hand()
+{
+  if (ring_.empty()) {
+    hand_ = ring_.end();
+    return;
+  }
+
+  if (hand_ != ring_.end()) {
+    ++hand_;
+  }
+  if (hand_ == ring_.end()) {
+    hand_ = ring_.begin();
+  }
+}
+
+void ClockFrameReplacer::foreach_victim(function<bool(Frame *frame)> func)
+{
+  if (ring_.empty()) {
+    return;
+  }
+
+  if (hand_ == ring_.end()) {
+    hand_ = ring_.begin();
+  }
+
+  // 最多转两圈：第一圈清除所有的访问标识，第二圈一定能遍历到所有的页帧
+  const size_t max_steps = ring_.size() * 2;
+  for (size_t step = 0; step < max_steps; step++) {
+    Frame *frame = *hand_;
+    Node  &node  = nodes_[frame];
+    advance_hand();
+
+    if (node.referenced) {
+      node.referenced = false;
+      continue;
+    }
+
+    if (!func(frame)) {
+      break;
+    }
+  }
+}
@@ -0,0 +1,161 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/functional.h"
+#include "common/lang/list.h"
+#include "common/lang/unordered_map.h"
+#include "common/sys/rc.h"
+#include "storage/buffer/frame.h"
+
+/**
+ * @brief 页帧置换策略
+ * @ingroup BufferPool
+ * @details 当内存中的页帧不够用时，BPFrameManager 需要选择一些页帧淘汰掉。选择哪些页帧淘汰，
+ * 就由置换策略来决定。置换策略只负责维护页帧的淘汰顺序，页帧的分配、释放和pin count等都由
+ * BPFrameManager 来管理。
+ * 置换策略不是线程安全的，调用者需要加锁保护。
+ */
+class FrameReplacer
+{
+public:
+  FrameReplacer()          = default;
+  virtual ~FrameReplacer() = default;
+
+  /**
+   * @brief 一个新的页面放到了页帧中
+   */
+  virtual void insert(Frame *frame) = 0;
+
+  /**
+   * @brief 访问了一个已经在内存中的页帧
+   */
+  virtual void access(Frame *frame) = 0;
+
+  /**
+   * @brief 页帧被释放，不再参与置换
+   * @details 调用时页帧中的页面信息(frame_id)还是有效的
+   */
+  virtual void remove(Frame *frame) = 0;
+
+  /**
+   * @brief 按照淘汰的优先顺序遍历页帧
+   * @details 遍历时不能修改置换策略中的页帧。可能会遍历到pin住的页帧，由调用者自己判断能否淘汰。
+   * @param func 返回false时停止遍历
+   */
+  virtual void foreach_victim(function<bool(Frame *frame)> func) = 0;
+
+  /**
+   * @brief 创建置换策略
+   *
+   * @param name 策略名称，当前支持 lru、2q 和 clock，为空时使用lru
+   * @param capacity 最多管理多少个页帧
+   * @param replacer 创建的置换策略对象
+   */
+  static RC create(const char *name, int capacity, FrameReplacer *&replacer);
+};
+
+/**
+ * @brief 最近最少使用(LRU)置换策略
+ * @ingroup BufferPool
+ * @details 一次全表扫描就可以把所有的热点页面都淘汰出去。
+ */
+class LruFrameReplacer : public FrameReplacer
+{
+public:
+  LruFrameReplacer()          = default;
+  virtual ~LruFrameReplacer() = default;
+
+  void insert(Frame *frame) override;
+  void access(Frame *frame) override;
+  void remove(Frame *frame) override;
+  void foreach_victim(function<bool(Frame *frame)> func) override;
+
+private:
+  list<Frame *>                                   lru_list_;  ///< 头部是最近访问的页帧
+  unordered_map<Frame *, list<Frame *>::iterator> nodes_;
+};
+
+/**
+ * @brief 2Q 置换策略
+ * @ingroup BufferPool
+ * @details 参考 Theodore Johnson, Dennis Shasha. 2Q: A Low Overhead High Performance Buffer Management
+ * Replacement Algorithm. 新加载的页面先放到一个FIFO队列(A1in)中，从A1in中淘汰的页面只在A1out中记录页面
+ * 标识。如果一个页面在A1out中时再次被加载，说明这个页面不止被访问一次，就放到LRU队列(Am)中。
+ * 全表扫描的页面通常只会访问一次，只会在A1in中流转，不会把Am中的热点页面淘汰掉。
+ */
+class TwoQueueFrameReplacer : public FrameReplacer
+{
+public:
+  explicit TwoQueueFrameReplacer(int capacity);
+  virtual ~TwoQueueFrameReplacer() = default;
+
+  void insert(Frame *frame) override;
+  void access(Frame *frame) override;
+  void remove(Frame *frame) override;
+  void foreach_victim(function<bool(Frame *frame)> func) override;
+
+private:
+  class FrameIdHasher
+  {
+  public:
+    size_t operator()(const FrameId &frame_id) const { return frame_id.hash(); }
+  };
+
+  struct Node
+  {
+    bool                    in_am = false;  ///< 在Am还是A1in中
+    list<Frame *>::iterator iter;
+  };
+
+private:
+  size_t a1in_max_size_  = 0;  ///< A1in 超过这个大小时，优先从A1in中淘汰
+  size_t a1out_max_size_ = 0;  ///< A1out 最多记录多少个页面
+
+  list<Frame *>                                                  a1in_list_;   ///< FIFO，头部是最新加载的页帧
+  list<Frame *>                                                  am_list_;     ///< LRU，头部是最近访问的页帧
+  unordered_map<Frame *, Node>                                   nodes_;
+  list<FrameId>                                                  a1out_list_;  ///< 头部是最近从A1in中淘汰的页面
+  unordered_map<FrameId, list<FrameId>::iterator, FrameIdHasher> a1out_nodes_;
+};
+
+/**
+ * @brief CLOCK 置换策略
+ * @ingroup BufferPool
+ * @details 所有的页帧组成一个环，每个页帧有一个访问标识。淘汰时从当前指针位置开始转动，
+ * 遇到访问标识为true的页帧时，清除标识并跳过，遇到标识为false的页帧时就选择淘汰它。
+ * 访问页帧时只需要设置标识，不需要移动链表节点。
+ */
+class ClockFrameReplacer : public FrameReplacer
+{
+public:
+  ClockFrameReplacer()          = default;
+  virtual ~ClockFrameReplacer() = default;
+
+  void insert(Frame *frame) override;
+  void access(Frame *frame) override;
+  void remove(Frame *frame) override;
+  void foreach_victim(function<bool(Frame *frame)> func) override;
+
+private:
+  struct Node
+  {
+    bool                    referenced = true;
+    list<Frame *>::iterator iter;
+  };
+
+  void advance_hand();
+
+private:
+  list<Frame *>                ring_;
+  list<Frame *>::iterator      hand_ = ring_.end();  ///< 下一个检查的页帧
+  unordered_map<Frame *, Node> nodes_;
+};
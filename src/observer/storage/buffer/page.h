@@ -26,6 +26,9 @@ static constexpr PageNum BP_HEADER_PAGE = 0;
 static constexpr const int BP_PAGE_SIZE      = (1 << 13);
 static constexpr const int BP_PAGE_DATA_SIZE = (BP_PAGE_SIZE - sizeof(LSN) - sizeof(CheckSum));
 
+/// 使用 direct IO 时，读写的内存地址、文件偏移和数据长度都需要按照这个值对齐
+static constexpr const int BP_IO_ALIGN = 4096;
+
 /**
  * @brief 表示一个页面，可能放在内存或磁盘上
  * @ingroup BufferPool
@@ -0,0 +1,160 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/buffer/page_cleaner.h"
+#include "common/lang/chrono.h"
+#include "common/log/log.h"
+#include "common/thread/thread_util.h"
+#include "storage/buffer/disk_buffer_pool.h"
+
+using namespace common;
+
+void DirtyPageList::add(PageNum page_num, LSN lsn)
+{
+  lock_guard guard(lock_);
+  if (pages_.emplace(page_num, lsn).second) {
+    ordered_pages_.emplace(lsn, page_num);
+  }
+}
+
+void DirtyPageList::remove(PageNum page_num)
+{
+  lock_guard guard(lock_);
+  auto       iter = pages_.find(page_num);
+  if (iter == pages_.end()) {
+    return;
+  }
+
+  ordered_pages_.erase(pair<LSN, PageNum>(iter->second, page_num));
+  pages_.erase(iter);
+}
+
+void DirtyPageList::clear()
+{
+  lock_guard guard(lock_);
+  ordered_pages_.clear();
+  pages_.clear();
+}
+
+size_t DirtyPageList::size() const
+{
+  lock_guard guard(lock_);
+  return pages_.size();
+}
+
+void DirtyPageList::oldest(int count, vector<pair<LSN, PageNum>> &pages) const
+{
+  lock_guard guard(lock_);
+  for (auto iter = ordered_pages_.begin(); iter != ordered_pages_.end() && count > 0; ++iter, --count) {
+    pages.push_back(*iter);
+  }
+}
+
+bool DirtyPageList::oldest_lsn(LSN &lsn) const
+{
+  lock_guard guard(lock_);
+  if (ordered_pages_.empty()) {
+    return false;
+  }
+
+  lsn = ordered_pages_.begin()->first;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+PageCleaner::PageCleaner(BufferPoolManager &bp_manager) : bp_manager_(bp_manager) {}
+
+PageCleaner::~PageCleaner() { stop(); }
+
+RC PageCleaner::start(int dirty_ratio, int batch_size)
+{
+  if (thread_) {
+    LOG_WARN("page cleaner has been started");
+    return RC::INTERNAL;
+  }
+
+  if (dirty_ratio < 0 || dirty_ratio > 100 || batch_size <= 0) {
+    LOG_WARN("invalid page cleaner arguments. dirty ratio=%d, batch size=%d", dirty_ratio, batch_size);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  dirty_ratio_ = dirty_ratio;
+  batch_size_  = batch_size;
+
+#ifndef CONCURRENCY
+  LOG_INFO("page cleaner is disabled without CONCURRENCY");
+  return RC::SUCCESS;
+#endif
+
+  running_.store(true);
+  thread_ = make_unique<thread>(&PageCleaner::thread_func, this);
+  LOG_INFO("page cleaner started. dirty ratio=%d, batch size=%d", dirty_ratio_, batch_size_);
+  return RC::SUCCESS;
+}
+
+void PageCleaner::stop()
+{
+  if (!thread_) {
+    return;
+  }
+
+  {
+    lock_guard guard(lock_);
+    running_.store(false);
+    notified_ = true;
+  }
+  cond_.notify_all();
+
+  thread_->join();
+  thread_.reset();
+  LOG_INFO("page cleaner stopped");
+}
+
+void PageCleaner::wakeup()
+{
+  if (!running_.load()) {
+    return;
+  }
+
+  {
+    lock_guard guard(lock_);
+    notified_ = true;
+  }
+  cond_.notify_one();
+}
+
+int PageCleaner::clean_once()
+{
+  const size_t total_frame_num = bp_manager_.get_frame_manager().total_frame_num();
+  const size_t dirty_page_num  = bp_manager_.dirty_page_num();
+  if (dirty_page_num * 100 <= total_frame_num * dirty_ratio_) {
+    return 0;
+  }
+
+  return bp_manager_.flush_dirty_pages(batch_size_);
+}
+
+void PageCleaner::thread_func()
+{
+  thread_set_name("PageCleaner");
+
+  while (running_.load()) {
+    int flushed_num = clean_once();
+    if (flushed_num >= batch_size_) {
+      // 脏页比例可能还在阈值之上，继续刷
+      continue;
+    }
+
+    unique_lock guard(lock_);
+    cond_.wait_for(guard, chrono::milliseconds(100), [this]() { return notified_; });
+    notified_ = false;
+  }
+}
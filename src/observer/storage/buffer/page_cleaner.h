@@ -0,0 +1,115 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/atomic.h"
+#include "common/lang/condition_variable.h"
+#include "common/lang/memory.h"
+#include "common/lang/mutex.h"
+#include "common/lang/set.h"
+#include "common/lang/thread.h"
+#include "common/lang/unordered_map.h"
+#include "common/lang/utility.h"
+#include "common/lang/vector.h"
+#include "common/sys/rc.h"
+#include "common/types.h"
+
+class BufferPoolManager;
+
+/**
+ * @brief 一个buffer pool中的脏页列表
+ * @ingroup BufferPool
+ * @details 按照页面变脏时的LSN排序。LSN越小，说明页面越早被修改，对应的日志也越老，
+ * 后台刷脏时优先刷新这些页面。
+ * 页帧第一次被标记为脏页时加入列表，刷新到磁盘后从列表中删除。
+ */
+class DirtyPageList
+{
+public:
+  DirtyPageList()  = default;
+  ~DirtyPageList() = default;
+
+  /**
+   * @brief 记录一个脏页
+   * @details 如果页面已经在列表中，保留原来的LSN
+   */
+  void add(PageNum page_num, LSN lsn);
+  void remove(PageNum page_num);
+  void clear();
+
+  size_t size() const;
+
+  /**
+   * @brief 按照LSN从小到大取出最多count个脏页，不会从列表中删除
+   */
+  void oldest(int count, vector<pair<LSN, PageNum>> &pages) const;
+
+  /**
+   * @brief 最早变脏的页面的LSN，没有脏页时返回false
+   */
+  bool oldest_lsn(LSN &lsn) const;
+
+private:
+  mutable mutex               lock_;
+  set<pair<LSN, PageNum>>     ordered_pages_;  ///< 按照LSN排序的脏页
+  unordered_map<PageNum, LSN> pages_;          ///< 脏页变脏时的LSN
+};
+
+/**
+ * @brief 后台刷脏线程
+ * @ingroup BufferPool
+ * @details 如果只在淘汰页面时才刷脏，前台线程就需要等待页面写入磁盘(包括double write buffer)。
+ * 后台刷脏线程定期检查脏页的比例，超过阈值时就按照LSN从小到大批量刷新脏页，
+ * 这样前台线程淘汰页面时，大部分时候都可以直接拿到干净的页帧。
+ * 非 CONCURRENCY 编译模式下，buffer pool的锁都不生效，所以不会启动后台线程。
+ */
+class PageCleaner
+{
+public:
+  explicit PageCleaner(BufferPoolManager &bp_manager);
+  ~PageCleaner();
+
+  /**
+   * @brief 启动后台线程
+   * @param dirty_ratio 脏页占所有页帧的百分比超过这个值时开始刷脏
+   * @param batch_size 每一轮最多刷新多少个页面
+   */
+  RC   start(int dirty_ratio, int batch_size);
+  void stop();
+
+  /**
+   * @brief 唤醒后台线程
+   * @details 前台线程淘汰页面时如果遇到了脏页，可以调用这个函数让后台线程尽快刷脏
+   */
+  void wakeup();
+
+  /**
+   * @brief 执行一轮刷脏
+   * @details 脏页比例没有超过阈值时不做任何事情
+   * @return 刷新的页面个数
+   */
+  int clean_once();
+
+private:
+  void thread_func();
+
+private:
+  BufferPoolManager &bp_manager_;
+
+  int dirty_ratio_ = 10;
+  int batch_size_  = 64;
+
+  mutex              lock_;
+  condition_variable cond_;
+  bool               notified_ = false;
+  unique_ptr<thread> thread_;
+  atomic_bool        running_{false};
+};
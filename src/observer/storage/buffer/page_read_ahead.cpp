@@ -0,0 +1,162 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "storage/buffer/page_read_ahead.h"
+#include "common/lang/algorithm.h"
+#include "common/log/log.h"
+
+using namespace common;
+
+PageReadAhead::~PageReadAhead() { stop(); }
+
+void PageReadAhead::init(int file_desc, ThreadPoolExecutor *executor, int window)
+{
+  lock_guard guard(lock_);
+  file_desc_        = file_desc;
+  executor_         = executor;
+  window_           = window;
+  last_page_        = -1;
+  sequential_count_ = 0;
+  prefetch_end_     = 0;
+}
+
+void PageReadAhead::stop()
+{
+  unique_lock guard(lock_);
+  cond_.wait(guard, [this]() { return inflight_tasks_ == 0; });
+  pages_.clear();
+  inflight_pages_.clear();
+  executor_ = nullptr;
+}
+
+bool PageReadAhead::read_page(PageNum page_num, PageNum page_count, Page &page)
+{
+  if (!enabled()) {
+    return false;
+  }
+
+  unique_lock guard(lock_);
+
+  // 中间跳过的页面可能已经在内存中，不会再加载，所以只要是向前且在预读窗口内，就认为是顺序访问
+  if (page_num > last_page_ && page_num <= last_page_ + window_) {
+    sequential_count_++;
+  } else {
+    sequential_count_ = 0;
+    prefetch_end_     = 0;
+  }
+  last_page_ = page_num;
+
+  // 扫描已经越过的页面不会再用到了
+  pages_.erase(pages_.begin(), pages_.lower_bound(page_num));
+
+  if (sequential_count_ >= SEQUENTIAL_THRESHOLD) {
+    const PageNum begin = max(prefetch_end_, page_num + 1);
+    const PageNum end   = min(page_num + 1 + window_, page_count);
+    // 剩余的预读页面少于半个窗口时，再预读下一批，这样每次都是比较大的顺序IO
+    if (end - begin >= window_ / 2 || (end == page_count && end > begin)) {
+      schedule(begin, end);
+    }
+  }
+
+  cond_.wait(guard, [this, page_num]() { return inflight_pages_.find(page_num) == inflight_pages_.end(); });
+
+  auto iter = pages_.find(page_num);
+  if (iter == pages_.end()) {
+    return false;
+  }
+
+  page = *iter->second;
+  pages_.erase(iter);
+  hit_count_++;
+  return true;
+}
+
+void PageReadAhead::invalidate(PageNum page_num)
+{
+  if (!enabled()) {
+    return;
+  }
+
+  lock_guard guard(lock_);
+  pages_.erase(page_num);
+
+  auto iter = inflight_pages_.find(page_num);
+  if (iter != inflight_pages_.end()) {
+    iter->second = true;
+  }
+}
+
+void PageReadAhead::schedule(PageNum begin, PageNum end)
+{
+  for (PageNum page_num = begin; page_num < end; page_num++) {
+    inflight_pages_.emplace(page_num, false);
+  }
+  prefetch_end_ = end;
+  inflight_tasks_++;
+
+  int ret = executor_->execute([this, begin, end]() { read_pages(begin, end); });
+  if (ret != 0) {
+    LOG_WARN("failed to submit read ahead task. begin=%d, end=%d", begin, end);
+    for (PageNum page_num = begin; page_num < end; page_num++) {
+      inflight_pages_.erase(page_num);
+    }
+    inflight_tasks_--;
+  }
+}
+
+void PageReadAhead::read_pages(PageNum begin, PageNum end)
+{
+  // 连续的页面一次读取。最后的页面可能还在double write buffer中，没有写入文件，只保留完整读到的页面
+  // 内存按照 BP_IO_ALIGN 对齐，文件使用 direct IO 打开时也可以读取
+  const int     page_num   = end - begin;
+  const int64_t total_size = static_cast<int64_t>(page_num) * sizeof(Page);
+  unique_ptr<Page, decltype(&::free)> pages(static_cast<Page *>(aligned_alloc(BP_IO_ALIGN, total_size)), &::free);
+  if (!pages) {
+    LOG_WARN("failed to allocate memory for read ahead. begin=%d, end=%d", begin, end);
+  }
+
+  char   *buf       = reinterpret_cast<char *>(pages.get());
+  int64_t read_size = 0;
+  while (pages && read_size < total_size) {
+    ssize_t ret = ::pread(file_desc_, buf + read_size, total_size - read_size, static_cast<int64_t>(begin) * sizeof(Page) + read_size);
+    if (ret > 0) {
+      read_size += ret;
+    } else if (ret < 0 && (errno == EINTR || errno == EAGAIN)) {
+      continue;
+    } else {
+      if (ret < 0) {
+        LOG_WARN("failed to read ahead pages. fd=%d, begin=%d, end=%d, error=%s", file_desc_, begin, end, strerror(errno));
+      }
+      break;
+    }
+  }
+  const PageNum read_end = begin + static_cast<PageNum>(read_size / sizeof(Page));
+
+  lock_guard guard(lock_);
+  for (PageNum i = begin; i < end; i++) {
+    auto iter = inflight_pages_.find(i);
+    if (iter == inflight_pages_.end()) {
+      continue;
+    }
+    if (i < read_end && !iter->second) {
+      pages_[i] = make_unique<Page>(pages.get()[i - begin]);
+      read_count_++;
+    }
+    inflight_pages_.erase(iter);
+  }
+
+  inflight_tasks_--;
+  cond_.notify_all();
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/lang/atomic.h"
+#include "common/lang/condition_variable.h"
+#include "common/lang/map.h"
+#include "common/lang/memory.h"
+#include "common/lang/mutex.h"
+#include "common/thread/thread_pool_executor.h"
+#include "common/types.h"
+#include "storage/buffer/page.h"
+
+/**
+ * @brief 一个buffer pool文件的顺序预读
+ * @ingroup BufferPool
+ * @details 全表扫描时，BufferPoolIterator 按照页号从小到大访问页面，每个不在内存中的页面都需要
+ * 同步读一次磁盘，扫描的速度受限于磁盘的延迟。
+ * 这里在加载页面时检测访问是否是顺序的，如果是，就在后台线程中一次读取后面连续的多个页面，
+ * 放在预读缓存中。之后加载这些页面时直接从预读缓存中复制，这样扫描的速度取决于磁盘的带宽。
+ *
+ * 预读的页面不在页帧中，也不会修改buffer pool的任何状态，所以没有 CONCURRENCY 时也可以在后台读取。
+ * 页面写回磁盘时需要调用 invalidate，丢弃预读的旧数据。
+ */
+class PageReadAhead
+{
+public:
+  PageReadAhead() = default;
+  ~PageReadAhead();
+
+  /**
+   * @brief 初始化
+   * @param file_desc 文件描述符，只使用pread读取
+   * @param executor 执行预读的线程池，为空时不预读
+   * @param window 一次预读的页面个数，不大于0时不预读
+   */
+  void init(int file_desc, common::ThreadPoolExecutor *executor, int window);
+
+  /**
+   * @brief 等待正在执行的预读任务结束，并清空预读缓存。关闭文件前调用
+   */
+  void stop();
+
+  /**
+   * @brief 从磁盘加载页面前调用
+   * @details 检测是否是顺序访问，如果是就提交后面页面的预读任务。
+   * 如果这个页面正在预读，会等待预读完成。
+   * @param page_num 要加载的页面
+   * @param page_count 文件中的页面个数，预读不会超过这个范围
+   * @param page 如果页面已经预读，就将数据复制到这里
+   * @return 页面是否已经预读
+   */
+  bool read_page(PageNum page_num, PageNum page_count, Page &page);
+
+  /**
+   * @brief 页面写入磁盘时调用，丢弃预读的数据
+   */
+  void invalidate(PageNum page_num);
+
+  bool    enabled() const { return executor_ != nullptr && window_ > 0; }
+  int64_t hit_count() const { return hit_count_.load(); }
+  int64_t read_count() const { return read_count_.load(); }
+
+private:
+  /**
+   * @brief 提交预读任务。调用前需要加锁
+   */
+  void schedule(PageNum begin, PageNum end);
+
+  /**
+   * @brief 在后台线程中读取 [begin, end) 范围的页面
+   */
+  void read_pages(PageNum begin, PageNum end);
+
+private:
+  /// 连续这么多次顺序访问后才开始预读
+  static constexpr int SEQUENTIAL_THRESHOLD = 2;
+
+  int                         file_desc_ = -1;
+  common::ThreadPoolExecutor *executor_  = nullptr;
+  int                         window_    = 0;
+
+  mutex              lock_;
+  condition_variable cond_;  ///< 预读任务完成时通知
+
+  PageNum last_page_        = -1;  ///< 上次加载的页面
+  int     sequential_count_ = 0;   ///< 连续顺序访问的次数
+  PageNum prefetch_end_     = 0;   ///< 已经提交预读的页面范围的结束位置
+
+  map<PageNum, unique_ptr<Page>> pages_;           ///< 预读完成的页面
+  map<PageNum, bool>             inflight_pages_;  ///< 正在预读的页面，value表示在读取期间是否被写过
+  int                            inflight_tasks_ = 0;
+
+  atomic<int64_t> hit_count_{0};   ///< 从预读缓存中加载的页面个数
+  atomic<int64_t> read_count_{0};  ///< 预读的页面个数
+};
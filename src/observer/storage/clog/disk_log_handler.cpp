@@ -25,8 +25,10 @@ using namespace common;
 
 RC DiskLogHandler::init(const char *path)
 {
-  const int max_entry_number_per_file = 1000;
-  return file_manager_.init(path, max_entry_number_per_file);
+  const int     max_entry_number_per_file = 1000;
+  const int64_t log_file_size             = 4 * 1024 * 1024;  // 新的日志文件预先分配的大小
+  const int     max_recycled_files        = 4;                // 检查点之前的日志文件最多回收几个
+  return file_manager_.init(path, max_entry_number_per_file, log_file_size, max_recycled_files);
 }
 
 RC DiskLogHandler::start()
@@ -50,6 +52,12 @@ RC DiskLogHandler::stop()
   }
 
   running_.store(false);
+  {
+    // 刷盘线程退出前会把缓冲区中的日志都写到磁盘，但是不再保证等待者能看到
+    lock_guard guard(wait_mutex_);
+    flusher_cond_.notify_one();
+  }
+  notify_all_waiters();
 
   LOG_INFO("log handler stopped");
   return RC::SUCCESS;
@@ -94,6 +102,7 @@ RC DiskLogHandler::replay(LogReplayer &replayer, LSN start_lsn)
     LOG_WARN("failed to init log entry buffer. rc=%s", strrc(rc));
     return rc;
   }
+  durable_lsn_.store(max_lsn);
 
   LOG_INFO("replay clog files done. start lsn=%ld, max_lsn=%ld", start_lsn, max_lsn);
   return rc;
@@ -134,25 +143,46 @@ RC DiskLogHandler::iterate(function<RC(LogEntry &)> consumer, LSN start_lsn)
 }
 
 RC DiskLogHandler::_append(LSN &lsn, LogModule module, vector<char> &&data)
+{
+  return _append(lsn, module, static_cast<int32_t>(data.size()), [&data](LogPayloadWriter &writer) {
+    writer.write(data);
+  });
+}
+
+RC DiskLogHandler::_append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer)
 {
   ASSERT(running_.load(), "log handler is not running. lsn=%ld, module=%s, size=%d", 
-        lsn, module.name(), data.size());
+        lsn, module.name(), size);
 
-  RC rc = entry_buffer_.append(lsn, module, std::move(data));
+  RC rc = entry_buffer_.append(lsn, module, size, serializer);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to append log entry to buffer. rc=%s", strrc(rc));
     return rc;
   }
 
+  // 缓冲区快满了，不等提交者，直接叫醒刷盘线程
+  if (entry_buffer_.bytes() >= entry_buffer_.capacity() / 2) {
+    flusher_cond_.notify_one();
+  }
   return RC::SUCCESS;
 }
 
 RC DiskLogHandler::wait_lsn(LSN lsn)
 {
-  // 直接强制等待。在生产系统中，我们可能会使用条件变量来等待。
-  while (running_.load() && current_flushed_lsn() < lsn) {
-    this_thread::sleep_for(chrono::milliseconds(100));
+  if (current_flushed_lsn() >= lsn) {
+    return RC::SUCCESS;
+  }
+
+  LsnWaiter   waiter;
+  unique_lock lock(wait_mutex_);
+  if (running_.load()) {
+    waiters_.emplace(lsn, &waiter);
+    flush_requested_ = true;
+    flusher_cond_.notify_one();
+
+    waiter.cond.wait(lock, [&waiter]() { return waiter.done; });
   }
+  lock.unlock();
 
   if (current_flushed_lsn() >= lsn) {
     return RC::SUCCESS;
@@ -161,21 +191,70 @@ RC DiskLogHandler::wait_lsn(LSN lsn)
   }
 }
 
+RC DiskLogHandler::truncate(LSN check_point_lsn)
+{
+  int removed_num = 0;
+  RC  rc          = file_manager_.truncate(check_point_lsn, removed_num);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to truncate log files. check point lsn=%ld, rc=%s", check_point_lsn, strrc(rc));
+    return rc;
+  }
+
+  if (removed_num > 0) {
+    LOG_INFO("truncate log files done. check point lsn=%ld, removed=%d, remain=%d",
+             check_point_lsn, removed_num, (int)file_manager_.file_num());
+  }
+  return RC::SUCCESS;
+}
+
+void DiskLogHandler::wait_for_work()
+{
+  unique_lock lock(wait_mutex_);
+  if (!flush_requested_ && running_.load()) {
+    // 没有提交者在等待时，后台也会定期刷盘，避免缓冲区中的日志停留太久
+    flusher_cond_.wait_for(lock, chrono::milliseconds(100), [this]() { return flush_requested_ || !running_.load(); });
+  }
+  flush_requested_ = false;
+}
+
+void DiskLogHandler::notify_waiters(LSN durable_lsn)
+{
+  lock_guard guard(wait_mutex_);
+  auto       end_iter = waiters_.upper_bound(durable_lsn);
+  for (auto iter = waiters_.begin(); iter != end_iter; ++iter) {
+    iter->second->done = true;
+    iter->second->cond.notify_one();
+  }
+  waiters_.erase(waiters_.begin(), end_iter);
+}
+
+void DiskLogHandler::notify_all_waiters()
+{
+  lock_guard guard(wait_mutex_);
+  for (auto &[lsn, waiter] : waiters_) {
+    waiter->done = true;
+    waiter->cond.notify_one();
+  }
+  waiters_.clear();
+}
+
 void DiskLogHandler::thread_func()
 {
   /*
-  这个线程一直不停的循环，检查日志缓冲区中是否有日志在内存中，如果在内存中就刷新到磁盘。
-  这种做法很粗暴简单，与生产数据库的做法不同。生产数据库通常会在内存达到一定量，或者一定时间
-  之后，会刷新一下磁盘。这样做的好处是减少磁盘的IO次数，提高性能。
+  这个线程一直不停的循环，把日志缓冲区中的日志刷新到磁盘。
+  每一轮把缓冲区中所有已经准备好的日志一次性写到文件中，然后只sync一次，这一批日志对应的所有
+  提交者都可以被唤醒，这就是组提交。sync的过程中新来的日志会在下一轮一起处理。
+  没有提交者等待时，最多等待100ms也会刷一次盘。
   */
   thread_set_name("LogHandler");
   LOG_INFO("log handler thread started");
 
   LogFileWriter file_writer;
 
-  RC rc = RC::SUCCESS;
-  while (running_.load() || entry_buffer_.entry_number() > 0) {
-    if (!file_writer.valid() || rc == RC::LOG_FILE_FULL) {
+  RC   rc        = RC::SUCCESS;
+  bool need_sync = false;  // 已经写入文件但是还没有sync
+  while (running_.load() || entry_buffer_.entry_number() > 0 || need_sync) {
+    if (!need_sync && (!file_writer.valid() || rc == RC::LOG_FILE_FULL)) {
       if (rc == RC::LOG_FILE_FULL) {
         // 我们在这里判断日志文件是否写满了。
         rc = file_manager_.next_file(file_writer);
@@ -193,16 +272,35 @@ void DiskLogHandler::thread_func()
     }
 
     int flush_count = 0;
-    rc              = entry_buffer_.flush(file_writer, flush_count);
-    if (OB_FAIL(rc) && RC::LOG_FILE_FULL != rc) {
-      LOG_WARN("failed to flush log entry buffer. rc=%s", strrc(rc));
+    if (!need_sync) {
+      rc = entry_buffer_.flush(file_writer, flush_count);
+      if (OB_FAIL(rc) && RC::LOG_FILE_FULL != rc) {
+        LOG_WARN("failed to flush log entry buffer. rc=%s", strrc(rc));
+      }
+      need_sync = flush_count > 0;
     }
 
-    if (flush_count == 0 && rc == RC::SUCCESS) {
-      this_thread::sleep_for(chrono::milliseconds(100));
+    if (need_sync) {
+      // 切换文件之前也要先把当前文件sync掉
+      RC sync_rc = file_writer.sync();
+      if (OB_FAIL(sync_rc)) {
+        LOG_WARN("failed to sync log file. rc=%s", strrc(sync_rc));
+        this_thread::sleep_for(chrono::milliseconds(100));
+        continue;
+      }
+      need_sync = false;
+
+      const LSN durable_lsn = entry_buffer_.flushed_lsn();
+      durable_lsn_.store(durable_lsn);
+      notify_waiters(durable_lsn);
       continue;
     }
+
+    if (rc == RC::SUCCESS) {
+      wait_for_work();
+    }
   }
 
+  notify_all_waiters();
   LOG_INFO("log handler thread stopped");
 }
@@ -18,7 +18,9 @@ See the Mulan PSL v2 for more details. */
 #include "common/sys/rc.h"
 #include "common/lang/vector.h"
 #include "common/lang/deque.h"
+#include "common/lang/map.h"
 #include "common/lang/memory.h"
+#include "common/lang/mutex.h"
 #include "common/lang/thread.h"
 #include "storage/clog/log_module.h"
 #include "storage/clog/log_file.h"
@@ -33,6 +35,8 @@ class LogReplayer;
  * @details 该模块负责日志的写入、读取、回放等功能。
  * 会在后台开启一个线程，一直尝试刷新内存中的日志到磁盘。
  * 所有的CLog日志文件都存放在指定的目录下，每个日志文件按照日志条数来划分。
+ * 事务提交时使用组提交(group commit)：提交者调用 wait_lsn 登记自己要等待的LSN并唤醒刷盘线程，
+ * 刷盘线程把缓冲区中所有的日志写入文件后只sync一次，然后唤醒那些LSN已经落盘的等待者。
  * 调用的顺序应该是：
  * @code {.cpp}
  * DiskLogHandler handler;
@@ -92,15 +96,20 @@ public:
 
   /**
    * @brief 等待指定的日志刷盘
-   *
+   * @details 会立即唤醒刷盘线程，当前线程在自己的条件变量上等待，直到这个LSN已经sync到磁盘
    * @param lsn 想要等待的日志
    */
   RC wait_lsn(LSN lsn) override;
 
+  /**
+   * @brief 删除所有日志都在检查点之前的文件
+   */
+  RC truncate(LSN check_point_lsn) override;
+
   /// @brief 当前的LSN
   LSN current_lsn() const override { return entry_buffer_.current_lsn(); }
-  /// @brief 当前刷新到哪个日志
-  LSN current_flushed_lsn() const { return entry_buffer_.flushed_lsn(); }
+  /// @brief 当前刷新到哪个日志。这个LSN之前(包括)的日志都已经sync到磁盘
+  LSN current_flushed_lsn() const { return durable_lsn_.load(); }
 
 private:
   /**
@@ -112,12 +121,44 @@ private:
    */
   RC _append(LSN &lsn, LogModule module, vector<char> &&data) override;
 
+  /**
+   * @brief 在缓存中预留一条日志的空间，由serializer直接把日志数据写到缓存中
+   */
+  RC _append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer) override;
+
 private:
   /**
    * @brief 刷新日志的线程函数
    */
   void thread_func();
 
+  /**
+   * @brief 刷盘线程等待新的日志
+   * @details 有事务在等待提交、缓冲区快满了或者超时都会醒过来
+   */
+  void wait_for_work();
+
+  /**
+   * @brief 日志已经sync到durable_lsn，唤醒所有LSN不超过它的等待者
+   */
+  void notify_waiters(LSN durable_lsn);
+
+  /**
+   * @brief 唤醒所有的等待者，不管日志是否已经落盘
+   */
+  void notify_all_waiters();
+
+private:
+  /**
+   * @brief 等待日志落盘的提交者
+   * @details 每个等待者都有自己的条件变量，刷盘线程只唤醒日志已经落盘的等待者，避免惊群
+   */
+  struct LsnWaiter
+  {
+    bool               done = false;
+    condition_variable cond;
+  };
+
 private:
   unique_ptr<thread> thread_;          /// 刷新日志的线程
   atomic_bool        running_{false};  /// 是否还要继续运行
@@ -125,5 +166,13 @@ private:
   LogFileManager file_manager_;  /// 管理所有的日志文件
   LogEntryBuffer entry_buffer_;  /// 缓存日志
 
+  atomic<LSN> durable_lsn_{0};  /// 已经sync到磁盘的最大LSN
+
+  /// 提交者和刷盘线程之间同步使用。一定会在多线程中访问，所以使用std::mutex
+  mutex                      wait_mutex_;
+  multimap<LSN, LsnWaiter *> waiters_;                  /// 按照LSN排序的等待者
+  condition_variable         flusher_cond_;             /// 刷盘线程在这里等待
+  bool                       flush_requested_ = false;  /// 有提交者在等待，需要立即刷盘
+
   string path_;  /// 日志文件存放的目录
 };
@@ -12,9 +12,119 @@ See the Mulan PSL v2 for more details. */
 // Created by wangyunlai on 2024/02/04
 //
 
+#include <string.h>
+
 #include "storage/clog/integrated_log_replayer.h"
+#include "common/lang/deque.h"
+#include "common/lang/mutex.h"
+#include "common/lang/thread.h"
+#include "common/thread/thread_util.h"
+#include "storage/buffer/page.h"
 #include "storage/clog/log_entry.h"
 
+using namespace common;
+
+/**
+ * @brief 并行回放线程
+ * @details 每个线程有自己的日志队列，按照放入的顺序回放。队列有长度限制，避免读日志太快占用太多内存。
+ * 回放出错后会丢弃剩余的日志，并在下一次 push 或者 finish 时把错误返回给分发线程。
+ */
+class IntegratedLogReplayer::ReplayWorker
+{
+public:
+  static constexpr size_t MAX_QUEUE_SIZE = 1024;
+
+  ReplayWorker(IntegratedLogReplayer &owner, int index) : owner_(owner), index_(index)
+  {
+    thread_ = make_unique<thread>(&ReplayWorker::thread_func, this);
+  }
+
+  ~ReplayWorker() { (void)finish(); }
+
+  /// @brief 放入一条日志，队列满了会等待
+  RC push(LogEntry &&entry)
+  {
+    unique_lock lock(mutex_);
+    not_full_.wait(lock, [this]() { return queue_.size() < MAX_QUEUE_SIZE || OB_FAIL(rc_); });
+    if (OB_FAIL(rc_)) {
+      return rc_;
+    }
+
+    queue_.push_back(std::move(entry));
+    not_empty_.notify_one();
+    return RC::SUCCESS;
+  }
+
+  /// @brief 回放完队列中所有的日志后退出线程
+  RC finish()
+  {
+    if (!thread_) {
+      return rc_;
+    }
+
+    {
+      lock_guard guard(mutex_);
+      stopping_ = true;
+      not_empty_.notify_one();
+    }
+
+    thread_->join();
+    thread_.reset();
+    return rc_;
+  }
+
+private:
+  void thread_func()
+  {
+    thread_set_name("LogReplayer");
+    LOG_INFO("log replay worker started. index=%d", index_);
+
+    int64_t count = 0;
+    while (true) {
+      LogEntry entry;
+      {
+        unique_lock lock(mutex_);
+        not_empty_.wait(lock, [this]() { return !queue_.empty() || stopping_; });
+        if (queue_.empty()) {
+          break;
+        }
+
+        entry = std::move(queue_.front());
+        queue_.pop_front();
+        not_full_.notify_one();
+      }
+
+      RC rc = owner_.dispatch(entry);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to replay log entry. worker=%d, entry=%s, rc=%s", index_, entry.to_string().c_str(), strrc(rc));
+        lock_guard guard(mutex_);
+        rc_ = rc;
+        queue_.clear();
+        not_full_.notify_all();
+        break;
+      }
+      count++;
+    }
+
+    LOG_INFO("log replay worker stopped. index=%d, replayed=%ld, rc=%s", index_, count, strrc(rc_));
+  }
+
+private:
+  IntegratedLogReplayer &owner_;
+  int                    index_ = 0;
+
+  mutex              mutex_;
+  condition_variable not_empty_;
+  condition_variable not_full_;
+  deque<LogEntry>    queue_;
+  bool               stopping_ = false;
+  RC                 rc_       = RC::SUCCESS;
+
+  unique_ptr<thread> thread_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 IntegratedLogReplayer::IntegratedLogReplayer(BufferPoolManager &bpm)
     : buffer_pool_log_replayer_(bpm),
       record_log_replayer_(bpm),
@@ -29,7 +139,95 @@ IntegratedLogReplayer::IntegratedLogReplayer(BufferPoolManager &bpm, unique_ptr<
       trx_log_replayer_(std::move(trx_log_replayer))
 {}
 
+IntegratedLogReplayer::~IntegratedLogReplayer() { (void)stop_workers(); }
+
+RC IntegratedLogReplayer::start_workers(int worker_num)
+{
+  if (!workers_.empty()) {
+    LOG_WARN("log replay workers have been started");
+    return RC::INTERNAL;
+  }
+
+  if (worker_num <= 0) {
+    return RC::SUCCESS;
+  }
+
+#ifndef CONCURRENCY
+  LOG_INFO("parallel log replay is disabled without CONCURRENCY");
+  return RC::SUCCESS;
+#endif
+
+  for (int i = 0; i < worker_num; i++) {
+    workers_.push_back(make_unique<ReplayWorker>(*this, i));
+  }
+  LOG_INFO("log replay workers started. worker num=%d", worker_num);
+  return RC::SUCCESS;
+}
+
+RC IntegratedLogReplayer::stop_workers()
+{
+  RC rc = RC::SUCCESS;
+  for (auto &worker : workers_) {
+    RC worker_rc = worker->finish();
+    if (OB_FAIL(worker_rc) && OB_SUCC(rc)) {
+      rc = worker_rc;
+    }
+  }
+  workers_.clear();
+  return rc;
+}
+
+int IntegratedLogReplayer::partition(const LogEntry &entry) const
+{
+  int32_t buffer_pool_id = 0;
+  PageNum page_num       = BP_HEADER_PAGE;
+  switch (entry.module().id()) {
+    case LogModule::Id::BUFFER_POOL: {
+      // 分配和释放页面修改的都是文件头页面
+      if (entry.payload_size() >= static_cast<int32_t>(sizeof(BufferPoolLogEntry))) {
+        buffer_pool_id = reinterpret_cast<const BufferPoolLogEntry *>(entry.data())->buffer_pool_id;
+      }
+    } break;
+    case LogModule::Id::RECORD_MANAGER: {
+      if (entry.payload_size() >= RecordLogHeader::SIZE) {
+        auto log_header = reinterpret_cast<const RecordLogHeader *>(entry.data());
+        buffer_pool_id  = log_header->buffer_pool_id;
+        page_num        = log_header->page_num;
+      }
+    } break;
+    case LogModule::Id::BPLUS_TREE: {
+      // 日志的开头是buffer pool id，参考 BplusTreeLogger::redo
+      if (entry.payload_size() >= static_cast<int32_t>(sizeof(buffer_pool_id))) {
+        memcpy(&buffer_pool_id, entry.data(), sizeof(buffer_pool_id));
+      }
+    } break;
+    default: break;
+  }
+
+  const uint64_t key =
+      static_cast<uint64_t>(static_cast<uint32_t>(buffer_pool_id)) * 131 + static_cast<uint32_t>(page_num);
+  return static_cast<int>(key % workers_.size());
+}
+
 RC IntegratedLogReplayer::replay(const LogEntry &entry)
+{
+  if (workers_.empty() || entry.module().id() == LogModule::Id::TRANSACTION) {
+    return dispatch(entry);
+  }
+
+  // 读日志时使用的LogEntry对象会被复用，这里需要拷贝一份交给回放线程
+  LogEntry     worker_entry;
+  vector<char> data(entry.data(), entry.data() + entry.payload_size());
+  RC           rc = worker_entry.init(entry.lsn(), entry.module(), std::move(data));
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to copy log entry. entry=%s, rc=%s", entry.to_string().c_str(), strrc(rc));
+    return rc;
+  }
+
+  return workers_[partition(entry)]->push(std::move(worker_entry));
+}
+
+RC IntegratedLogReplayer::dispatch(const LogEntry &entry)
 {
   switch (entry.module().id()) {
     case LogModule::Id::BUFFER_POOL: return buffer_pool_log_replayer_.replay(entry);
@@ -42,7 +240,14 @@ RC IntegratedLogReplayer::replay(const LogEntry &entry)
 
 RC IntegratedLogReplayer::on_done()
 {
-  RC rc = buffer_pool_log_replayer_.on_done();
+  // 回滚未提交的事务会修改页面，必须等页面相关的日志都回放完成
+  RC rc = stop_workers();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to replay logs in workers. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = buffer_pool_log_replayer_.on_done();
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to do buffer pool log replay. rc=%s", strrc(rc));
     return rc;
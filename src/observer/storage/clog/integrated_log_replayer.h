@@ -14,6 +14,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "common/lang/memory.h"
+#include "common/lang/vector.h"
 #include "storage/clog/log_replayer.h"
 #include "storage/buffer/buffer_pool_log.h"
 #include "storage/record/record_log.h"
@@ -25,7 +27,9 @@ class BufferPoolManager;
 /**
  * @brief 整体日志回放类
  * @ingroup Clog
- * @details 负责回放所有日志，是其它各模块日志回放的分发器
+ * @details 负责回放所有日志，是其它各模块日志回放的分发器。
+ * 默认在调用 replay 的线程中串行回放。调用 start_workers 之后，页面相关的日志(buffer pool、record、B+树)
+ * 会按照页面分配给多个回放线程并行回放，参考 start_workers。
  */
 class IntegratedLogReplayer : public LogReplayer
 {
@@ -44,7 +48,20 @@ public:
    * 区别于另一个构造函数，这个构造函数可以指定不同的事务日志回放器。比如进程启动时可以指定选择使用VacuousTrx还是MvccTrx。
    */
   IntegratedLogReplayer(BufferPoolManager &bpm, unique_ptr<LogReplayer> trx_log_replayer);
-  virtual ~IntegratedLogReplayer() = default;
+  virtual ~IntegratedLogReplayer();
+
+  /**
+   * @brief 开启并行回放
+   * @details 页面相关的日志按照(buffer_pool_id, page_num)分配到回放线程上，同一个页面的日志总是由同一个线程
+   * 按照LSN的顺序回放，不同页面之间没有顺序要求。
+   * - buffer pool 的分配/释放页面日志修改的是文件头页面，按照(buffer_pool_id, BP_HEADER_PAGE)分配；
+   * - B+树的一条日志是一个mini transaction，会修改多个页面，所以同一个索引文件的日志都在一个线程中回放；
+   * - 事务日志只是在内存中重建事务的状态，不访问页面，由调用 replay 的线程直接回放。
+   * on_done 会先等待所有的回放线程结束(barrier)，然后再回滚未提交的事务。
+   * 回放线程会并发访问buffer pool，所以只有开启CONCURRENCY时才会生效，否则仍然串行回放。
+   * @param worker_num 回放线程的个数，小于等于0时串行回放
+   */
+  RC start_workers(int worker_num);
 
   //! @copydoc LogReplayer::replay
   RC replay(const LogEntry &entry) override;
@@ -52,9 +69,24 @@ public:
   //! @copydoc LogReplayer::on_done
   RC on_done() override;
 
+private:
+  /// @brief 把日志交给对应模块的回放器
+  RC dispatch(const LogEntry &entry);
+
+  /// @brief 计算页面相关的日志应该由哪个回放线程处理
+  int partition(const LogEntry &entry) const;
+
+  /// @brief 等待所有回放线程把已经分配的日志回放完成并退出，返回第一个遇到的错误
+  RC stop_workers();
+
+private:
+  class ReplayWorker;
+
 private:
   BufferPoolLogReplayer   buffer_pool_log_replayer_;  ///< 缓冲池日志回放器
   RecordLogReplayer       record_log_replayer_;       ///< record manager 日志回放器
   BplusTreeLogReplayer    bplus_tree_log_replayer_;   ///< bplus tree 日志回放器
   unique_ptr<LogReplayer> trx_log_replayer_;          ///< trx 日志回放器
+
+  vector<unique_ptr<ReplayWorker>> workers_;  ///< 并行回放线程，为空时串行回放
 };
\ No newline at end of file
@@ -12,50 +12,100 @@ See the Mulan PSL v2 for more details. */
 // Created by wangyunlai on 2024/01/31
 //
 
+#include <string.h>
+
 #include "storage/clog/log_buffer.h"
 #include "storage/clog/log_file.h"
-#include "common/lang/chrono.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/thread.h"
 
 using namespace common;
 
+LogEntryBuffer::LogEntryBuffer() { buffer_ = make_unique<char[]>(capacity_); }
+
 RC LogEntryBuffer::init(LSN lsn, int32_t max_bytes /*= 0*/)
 {
+  // 保证最大的一条日志也能放得下
+  const int64_t capacity = max<int64_t>(max_bytes, LogEntry::max_size());
+  if (max_bytes > 0 && capacity != capacity_) {
+    capacity_ = capacity;
+    buffer_   = make_unique<char[]>(capacity_);
+  }
+
+  reserved_offset_ = 0;
+  ready_offset_.store(0);
+  flushed_offset_.store(0);
+
   current_lsn_.store(lsn);
   flushed_lsn_.store(lsn);
-
-  if (max_bytes > 0) {
-    max_bytes_ = max_bytes;
-  }
   return RC::SUCCESS;
 }
 
 RC LogEntryBuffer::append(LSN &lsn, LogModule::Id module_id, vector<char> &&data)
 {
-  return append(lsn, LogModule(module_id), std::move(data));
+  return append(lsn, LogModule(module_id), span<const char>(data));
 }
 
 RC LogEntryBuffer::append(LSN &lsn, LogModule module, vector<char> &&data)
 {
-  /// 控制当前buffer使用的内存
-  /// 简单粗暴，强制原地等待
-  /// 但是如果当前想要新插入的日志比较大，不会做控制。所以理论上容纳的最大buffer内存是2*max_bytes_
-  while (bytes_.load() >= max_bytes_) {
-    this_thread::sleep_for(chrono::milliseconds(10));
+  return append(lsn, module, span<const char>(data));
+}
+
+RC LogEntryBuffer::append(LSN &lsn, LogModule module, span<const char> data)
+{
+  if (static_cast<int64_t>(data.size()) > LogEntry::max_payload_size()) {
+    LOG_DEBUG("log entry size is too large. size=%d, max_payload_size=%d", data.size(), LogEntry::max_payload_size());
+    return RC::INVALID_ARGUMENT;
   }
 
-  LogEntry entry;
-  RC       rc = entry.init(lsn, module, std::move(data));
-  if (OB_FAIL(rc)) {
-    LOG_WARN("failed to init log entry. rc=%s", strrc(rc));
-    return rc;
+  return append(lsn, module, static_cast<int32_t>(data.size()), [data](LogPayloadWriter &writer) { writer.write(data); });
+}
+
+RC LogEntryBuffer::append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer)
+{
+  if (size < 0 || size > LogEntry::max_payload_size()) {
+    LOG_DEBUG("invalid log entry size. size=%d, max_payload_size=%d", size, LogEntry::max_payload_size());
+    return RC::INVALID_ARGUMENT;
   }
 
-  lock_guard guard(mutex_);
-  lsn = ++current_lsn_;
-  entry.set_lsn(lsn);
+  const int64_t entry_size = LogHeader::SIZE + size;
+  int64_t       offset     = 0;
+  {
+    lock_guard guard(reserve_mutex_);
+    lsn    = current_lsn_.load() + 1;
+    offset = reserved_offset_;
+    reserved_offset_ += entry_size;
+    current_lsn_.store(lsn);
+  }
+
+  /// 控制当前buffer使用的内存
+  /// 简单粗暴，强制原地等待刷盘线程把前面的日志写到文件中
+  while (offset + entry_size - flushed_offset_.load(memory_order_acquire) > capacity_) {
+    this_thread::yield();
+  }
+
+  LogHeader header;
+  header.lsn       = lsn;
+  header.size      = size;
+  header.module_id = module.index();
+  copy_in(offset, &header, LogHeader::SIZE);
+
+  const int64_t    payload_pos = (offset + LogHeader::SIZE) % capacity_;
+  const int64_t    first_size  = min<int64_t>(size, capacity_ - payload_pos);
+  LogPayloadWriter writer(span<char>(buffer_.get() + payload_pos, first_size), span<char>(buffer_.get(), size - first_size));
+  serializer(writer);
+  if (writer.size() != size) {
+    // LSN已经分配出去了，不能撤回，只能把没写的部分补成0
+    LOG_ERROR("log payload size mismatch. lsn=%ld, module=%s, reserved=%d, written=%d",
+              lsn, module.name(), size, writer.size());
+    writer.fill_zero();
+  }
 
-  entries_.push_back(std::move(entry));
-  bytes_ += entry.total_size();
+  // 按照LSN的顺序发布，前面的日志还没有拷贝完成时需要等一下
+  while (ready_offset_.load(memory_order_acquire) != offset) {
+    this_thread::yield();
+  }
+  ready_offset_.store(offset + entry_size, memory_order_release);
   return RC::SUCCESS;
 }
 
@@ -63,38 +113,73 @@ RC LogEntryBuffer::flush(LogFileWriter &writer, int &count)
 {
   count = 0;
 
-  while (entry_number() > 0) {
-    LogEntry entry;
-    {
-      lock_guard guard(mutex_);
-      if (entries_.empty()) {
-        break;
-      }
-
-      LogEntry &front_entry = entries_.front();
-      ASSERT(front_entry.lsn() > 0 && front_entry.payload_size() > 0, "invalid log entry");
-      entry = std::move(entries_.front());
-      ASSERT(entry.payload_size() > 0 && entry.lsn() > 0, "invalid log entry");
-      entries_.pop_front();
-      bytes_ -= entry.total_size();
+  const int64_t begin = flushed_offset_.load();
+  const int64_t ready = ready_offset_.load(memory_order_acquire);
+
+  // 找到当前文件能够容纳的最后一条日志
+  int64_t   end       = begin;
+  const LSN first_lsn = flushed_lsn_.load() + 1;
+  LSN       last_lsn  = first_lsn - 1;
+  while (end < ready) {
+    LogHeader header;
+    copy_out(end, &header, LogHeader::SIZE);
+    ASSERT(header.lsn == last_lsn + 1 && header.size >= 0, "invalid log entry. %s", header.to_string().c_str());
+    if (header.lsn > writer.end_lsn()) {
+      break;
     }
 
-    RC rc = writer.write(entry);
-    if (OB_FAIL(rc)) {
-      lock_guard guard(mutex_);
-      entries_.emplace_front(std::move(entry));
-      LogEntry &front_entry = entries_.front();
-      ASSERT(front_entry.lsn() > 0 && front_entry.payload_size() > 0, "invalid log entry");
-      return rc;
-    } else {
-      ++count;
-      flushed_lsn_ = entry.lsn();
-    }
+    end += LogHeader::SIZE + header.size;
+    last_lsn = header.lsn;
+    ++count;
+  }
+
+  if (end == begin) {
+    count = 0;
+    return ready > begin ? RC::LOG_FILE_FULL : RC::SUCCESS;
   }
 
+  const int64_t begin_pos  = begin % capacity_;
+  const int64_t first_size = min(end - begin, capacity_ - begin_pos);
+  span<const char> first_part(buffer_.get() + begin_pos, first_size);
+  span<const char> second_part(buffer_.get(), end - begin - first_size);
+
+  RC rc = writer.write(first_lsn, last_lsn, first_part, second_part);
+  if (OB_FAIL(rc)) {
+    count = 0;
+    return rc;
+  }
+
+  flushed_lsn_.store(last_lsn);
+  flushed_offset_.store(end, memory_order_release);
   return RC::SUCCESS;
 }
 
-int64_t LogEntryBuffer::bytes() const { return bytes_.load(); }
+int64_t LogEntryBuffer::bytes() const
+{
+  return ready_offset_.load() - flushed_offset_.load();
+}
 
-int32_t LogEntryBuffer::entry_number() const { return entries_.size(); }
+int32_t LogEntryBuffer::entry_number() const
+{
+  return static_cast<int32_t>(current_lsn_.load() - flushed_lsn_.load());
+}
+
+void LogEntryBuffer::copy_in(int64_t offset, const void *data, int64_t size)
+{
+  const int64_t pos        = offset % capacity_;
+  const int64_t first_size = min(size, capacity_ - pos);
+  memcpy(buffer_.get() + pos, data, first_size);
+  if (first_size < size) {
+    memcpy(buffer_.get(), static_cast<const char *>(data) + first_size, size - first_size);
+  }
+}
+
+void LogEntryBuffer::copy_out(int64_t offset, void *data, int64_t size) const
+{
+  const int64_t pos        = offset % capacity_;
+  const int64_t first_size = min(size, capacity_ - pos);
+  memcpy(data, buffer_.get() + pos, first_size);
+  if (first_size < size) {
+    memcpy(static_cast<char *>(data) + first_size, buffer_.get(), size - first_size);
+  }
+}
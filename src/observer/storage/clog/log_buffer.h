@@ -17,8 +17,9 @@ See the Mulan PSL v2 for more details. */
 #include "common/sys/rc.h"
 #include "common/types.h"
 #include "common/lang/mutex.h"
+#include "common/lang/memory.h"
+#include "common/lang/span.h"
 #include "common/lang/vector.h"
-#include "common/lang/deque.h"
 #include "common/lang/atomic.h"
 #include "storage/clog/log_module.h"
 #include "storage/clog/log_entry.h"
@@ -29,15 +30,27 @@ class LogFileWriter;
  * @brief 日志数据缓冲区
  * @ingroup CLog
  * @details 缓存一部分日志在内存中而不是直接写入磁盘。
- * 这里的缓存没有考虑高性能操作，比如使用预分配内存、环形缓冲池等。
- * 在生产数据库中，通常会使用预分配内存形式的缓存来提高性能，并且可以减少内存碎片。
+ * 缓冲区是一块预先分配好的连续内存，当作环形缓冲区使用，日志按照写到文件中的格式(日志头+数据)
+ * 依次排列，中间没有额外的内存分配。
+ * 追加日志分成三步：
+ * 1. 分配LSN和缓冲区中的一段空间。只有这一步是互斥的，临界区里只有两个加法；
+ * 2. 等待缓冲区有足够的空闲空间后，把日志拷贝到自己的空间中。多个线程可以同时拷贝；
+ * 3. 按照LSN的顺序发布，发布之后刷盘线程才能看到这条日志。
+ * 刷盘时直接把已经发布的一段连续内存写到文件中，绕到缓冲区开头时最多分成两段。
+ * 这里的偏移量(offset)都是逻辑上的，单调递增，对缓冲区大小取模才是在内存中的位置。
  */
 class LogEntryBuffer
 {
 public:
-  LogEntryBuffer()  = default;
+  LogEntryBuffer();
   ~LogEntryBuffer() = default;
 
+  /**
+   * @brief 初始化
+   * @details 不调用这个函数也可以使用，日志从LSN 1开始
+   * @param lsn 当前最大的LSN，新的日志从lsn+1开始
+   * @param max_bytes 缓冲区大小，不能小于一条日志的最大大小
+   */
   RC init(LSN lsn, int32_t max_bytes = 0);
 
   /**
@@ -45,10 +58,19 @@ public:
    */
   RC append(LSN &lsn, LogModule::Id module_id, vector<char> &&data);
   RC append(LSN &lsn, LogModule module, vector<char> &&data);
+  RC append(LSN &lsn, LogModule module, span<const char> data);
+
+  /**
+   * @brief 在缓冲区中预留一条日志的空间，由serializer直接把日志数据写到缓冲区中
+   * @details 省去了先把日志数据放到临时内存中再拷贝的过程
+   * @param size 日志数据的大小，不包含日志头
+   * @param serializer 必须正好写入size个字节
+   */
+  RC append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer);
 
   /**
    * @brief 刷新缓冲区中的日志到磁盘
-   *
+   * @details 只刷新当前文件能够容纳的日志，文件写满时返回 LOG_FILE_FULL
    * @param file_handle 使用它来写文件
    * @param count 刷了多少条日志
    */
@@ -59,8 +81,12 @@ public:
    */
   int64_t bytes() const;
 
+  /// @brief 缓冲区的大小
+  int64_t capacity() const { return capacity_; }
+
   /**
    * @brief 当前缓冲区中有多少条日志
+   * @details 包括已经分配了LSN但是还没有发布的日志
    */
   int32_t entry_number() const;
 
@@ -68,12 +94,22 @@ public:
   LSN flushed_lsn() const { return flushed_lsn_.load(); }
 
 private:
-  mutex mutex_;  /// 当前数据结构一定会在多线程中访问，所以强制使用有效的锁，而不是有条件生效的common::Mutex
-  deque<LogEntry> entries_;  /// 日志缓冲区
-  atomic<int64_t> bytes_;    /// 当前缓冲区中的日志数据大小
+  /// @brief 把数据拷贝到缓冲区中，可能会绕到缓冲区开头
+  void copy_in(int64_t offset, const void *data, int64_t size);
+  /// @brief 从缓冲区中拷贝数据，可能会绕到缓冲区开头
+  void copy_out(int64_t offset, void *data, int64_t size) const;
+
+private:
+  unique_ptr<char[]> buffer_;
+  int64_t            capacity_ = 4 * 1024 * 1024;  /// 缓冲区大小
+
+  /// 分配LSN和空间时使用。当前数据结构一定会在多线程中访问，所以强制使用有效的锁，而不是有条件生效的common::Mutex
+  mutex   reserve_mutex_;
+  int64_t reserved_offset_ = 0;  /// 已经分配出去的空间
+
+  atomic<int64_t> ready_offset_{0};    /// 在这之前的日志都已经拷贝完成，可以刷盘
+  atomic<int64_t> flushed_offset_{0};  /// 在这之前的日志都已经写到文件中，空间可以重新使用
 
   atomic<LSN> current_lsn_{0};
   atomic<LSN> flushed_lsn_{0};
-
-  int32_t max_bytes_ = 4 * 1024 * 1024;  /// 缓冲区最大字节数
 };
@@ -12,7 +12,10 @@ See the Mulan PSL v2 for more details. */
 // Created by wangyunlai on 2024/01/31
 //
 
+#include <string.h>
+
 #include "storage/clog/log_entry.h"
+#include "common/lang/algorithm.h"
 #include "common/log/log.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -80,3 +83,40 @@ RC LogEntry::init(LSN lsn, LogModule module, vector<char> &&data)
 }
 
 string LogEntry::to_string() const { return header_.to_string(); }
+
+////////////////////////////////////////////////////////////////////////////////
+// class LogPayloadWriter
+int LogPayloadWriter::write(span<const char> data)
+{
+  if (static_cast<int64_t>(data.size()) > capacity() - size_) {
+    return -1;
+  }
+
+  const char *src    = data.data();
+  int64_t     remain = data.size();
+  if (size_ < static_cast<int64_t>(first_.size())) {
+    const int64_t first_size = min<int64_t>(remain, first_.size() - size_);
+    memcpy(first_.data() + size_, src, first_size);
+    src += first_size;
+    remain -= first_size;
+    size_ += first_size;
+  }
+  if (remain > 0) {
+    memcpy(second_.data() + (size_ - first_.size()), src, remain);
+    size_ += remain;
+  }
+  return 0;
+}
+
+void LogPayloadWriter::fill_zero()
+{
+  if (size_ < static_cast<int64_t>(first_.size())) {
+    memset(first_.data() + size_, 0, first_.size() - size_);
+    size_ = static_cast<int32_t>(first_.size());
+  }
+  const int64_t second_offset = size_ - first_.size();
+  if (second_offset < static_cast<int64_t>(second_.size())) {
+    memset(second_.data() + second_offset, 0, second_.size() - second_offset);
+  }
+  size_ = capacity();
+}
@@ -20,6 +20,8 @@ See the Mulan PSL v2 for more details. */
 #include "common/lang/vector.h"
 #include "common/lang/string.h"
 #include "common/lang/memory.h"
+#include "common/lang/span.h"
+#include "common/lang/functional.h"
 
 /**
  * @brief 描述一条日志头
@@ -87,3 +89,43 @@ private:
   LogHeader    header_;  /// 日志头
   vector<char> data_;    /// 日志数据
 };
+
+/**
+ * @brief 把日志数据直接写到日志缓冲区预留出来的空间中
+ * @ingroup CLog
+ * @details 日志缓冲区是一个环形缓冲区，预留的空间可能从缓冲区末尾绕回到开头，所以最多分成两段。
+ * 使用者不需要关心这个细节，按照顺序写入数据即可。写入的数据不能超过预留的大小。
+ */
+class LogPayloadWriter final
+{
+public:
+  explicit LogPayloadWriter(span<char> first, span<char> second = span<char>()) : first_(first), second_(second) {}
+  ~LogPayloadWriter() = default;
+
+  /// @brief 写入指定长度的数据，剩余空间不够时返回-1
+  int write(span<const char> data);
+  /// @brief 写入指定长度的数据，剩余空间不够时返回-1
+  int write(const void *data, int32_t size) { return write(span<const char>(static_cast<const char *>(data), size)); }
+  /// @brief 写入一个int32整数
+  int write_int32(int32_t value) { return write(&value, sizeof(value)); }
+
+  /// @brief 已经写入了多少数据
+  int32_t size() const { return size_; }
+  /// @brief 预留的空间大小
+  int32_t capacity() const { return static_cast<int32_t>(first_.size() + second_.size()); }
+
+  /// @brief 把剩余的空间都填成0
+  void fill_zero();
+
+private:
+  span<char> first_;
+  span<char> second_;
+  int32_t    size_ = 0;
+};
+
+/**
+ * @brief 序列化一条日志的数据
+ * @details 必须正好写入预留的字节数，并且不能失败：调用它的时候LSN已经分配出去了，日志无法撤回。
+ * 捕获的变量尽量不要超过两个指针的大小，这样构造function时不会分配内存。
+ */
+using LogPayloadSerializer = function<void(LogPayloadWriter &)>;
@@ -13,9 +13,12 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "common/lang/string_view.h"
 #include "common/lang/charconv.h"
+#include "common/lang/limits.h"
 #include "common/log/log.h"
 #include "storage/clog/log_file.h"
 #include "storage/clog/log_entry.h"
@@ -67,6 +70,10 @@ RC LogFileReader::iterate(function<RC(LogEntry &)> callback, LSN start_lsn /*=0*
       return RC::IOERR_READ;
     }
 
+    if (end_of_log(header)) {
+      break;
+    }
+
     if (header.size < 0 || header.size > LogEntry::max_payload_size()) {
       LOG_WARN("invalid log entry size. filename=%s, size=%d", filename_.c_str(), header.size);
       return RC::IOERR_READ;
@@ -75,10 +82,18 @@ RC LogFileReader::iterate(function<RC(LogEntry &)> callback, LSN start_lsn /*=0*
     vector<char> data(header.size);
     ret = readn(fd_, data.data(), header.size);
     if (0 != ret) {
+      if (-1 == ret) {
+        // 最后一条日志没有写完整
+        LOG_WARN("incomplete log entry at the end of file. filename=%s, header=%s", 
+                 filename_.c_str(), header.to_string().c_str());
+        break;
+      }
       LOG_WARN("read file failed. filename=%s, size=%d, ret=%d, error=%s", filename_.c_str(), header.size, ret, strerror(errno));
       return RC::IOERR_READ;
     }
 
+    last_lsn_ = header.lsn;
+
     LogEntry entry;
     entry.init(header.lsn, LogModule(header.module_id), std::move(data));
     rc = callback(entry);
@@ -92,36 +107,50 @@ RC LogFileReader::iterate(function<RC(LogEntry &)> callback, LSN start_lsn /*=0*
   return RC::SUCCESS;
 }
 
+RC LogFileReader::find_end(int64_t &offset, LSN &last_lsn)
+{
+  RC rc = skip_to(numeric_limits<LSN>::max());
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  offset   = lseek(fd_, 0, SEEK_CUR);
+  last_lsn = last_lsn_;
+  return RC::SUCCESS;
+}
+
+bool LogFileReader::end_of_log(const LogHeader &header) const
+{
+  // 预分配的空间都是0；回收的文件中残留的老日志LSN比较小，不会和前面的日志连续
+  return header.lsn <= 0 || (last_lsn_ > 0 && header.lsn != last_lsn_ + 1);
+}
+
 RC LogFileReader::skip_to(LSN start_lsn)
 {
   if (fd_ < 0) {
     return RC::FILE_NOT_OPENED;
   }
 
-  off_t pos = lseek(fd_, 0, SEEK_SET);
-  if (off_t(-1) == pos) {
-    LOG_WARN("seek file failed. seek to the beginning. filename=%s, error=%s", filename_.c_str(), strerror(errno));
-    return RC::IOERR_SEEK;
+  struct stat st;
+  if (fstat(fd_, &st) != 0) {
+    LOG_WARN("stat file failed. filename=%s, error=%s", filename_.c_str(), strerror(errno));
+    return RC::IOERR_ACCESS;
   }
+  const int64_t file_size = st.st_size;
+
+  // 使用pread按照偏移量读取，结束时文件位置总是停在一条完整日志的开头
+  int64_t offset = 0;
+  last_lsn_      = 0;
 
   LogHeader header;
-  while (true) {
-    int ret = readn(fd_, reinterpret_cast<char *>(&header), LogHeader::SIZE);
+  while (offset + LogHeader::SIZE <= file_size) {
+    int ret = preadn(fd_, reinterpret_cast<char *>(&header), LogHeader::SIZE, offset);
     if (0 != ret) {
-      if (-1 == ret) {
-        // EOF
-        break;
-      }
       LOG_WARN("read file failed. filename=%s, ret = %d, error=%s", filename_.c_str(), ret, strerror(errno));
       return RC::IOERR_READ;
     }
 
-    if (header.lsn >= start_lsn) {
-      off_t pos = lseek(fd_, -LogHeader::SIZE, SEEK_CUR);
-      if (off_t(-1) == pos) {
-        LOG_WARN("seek file failed. skip back log header. filename=%s, error=%s", filename_.c_str(), strerror(errno));
-        return RC::IOERR_SEEK;
-      }
+    if (end_of_log(header) || header.lsn >= start_lsn) {
       break;
     }
 
@@ -130,11 +159,19 @@ RC LogFileReader::skip_to(LSN start_lsn)
       return RC::IOERR_READ;
     }
 
-    pos = lseek(fd_, header.size, SEEK_CUR);
-    if (off_t(-1) == pos) {
-      LOG_WARN("seek file failed. skip log entry payload. filename=%s, error=%s", filename_.c_str(), strerror(errno));
-      return RC::IOERR_SEEK;
+    if (offset + LogHeader::SIZE + header.size > file_size) {
+      // 最后一条日志没有写完整
+      break;
     }
+
+    offset += LogHeader::SIZE + header.size;
+    last_lsn_ = header.lsn;
+  }
+
+  off_t pos = lseek(fd_, offset, SEEK_SET);
+  if (off_t(-1) == pos) {
+    LOG_WARN("seek file failed. filename=%s, offset=%ld, error=%s", filename_.c_str(), offset, strerror(errno));
+    return RC::IOERR_SEEK;
   }
 
   return RC::SUCCESS;
@@ -152,13 +189,36 @@ RC LogFileWriter::open(const char *filename, int end_lsn)
   filename_ = filename;
   end_lsn_  = end_lsn;
 
-  fd_ = ::open(filename, O_WRONLY | O_APPEND | O_CREAT | O_SYNC, 0644);
+  // 文件可能是预先分配了空间的，或者是回收的老文件，所以不能使用O_APPEND，
+  // 而是要从最后一条有效日志的后面开始覆盖写
+  fd_ = ::open(filename, O_WRONLY | O_CREAT, 0644);
   if (fd_ < 0) {
     LOG_WARN("open file failed. filename=%s, error=%s", filename, strerror(errno));
     return RC::FILE_OPEN;
   }
 
-  LOG_INFO("open file success. filename=%s, fd=%d", filename, fd_);
+  LogFileReader reader;
+  int64_t       offset   = 0;
+  LSN           last_lsn = 0;
+  RC            rc       = reader.open(filename);
+  if (OB_SUCC(rc)) {
+    rc = reader.find_end(offset, last_lsn);
+    reader.close();
+  }
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to find the end of log file. filename=%s, rc=%s", filename, strrc(rc));
+    close();
+    return rc;
+  }
+
+  if (lseek(fd_, offset, SEEK_SET) == off_t(-1)) {
+    LOG_WARN("seek file failed. filename=%s, offset=%ld, error=%s", filename, offset, strerror(errno));
+    close();
+    return RC::IOERR_SEEK;
+  }
+  last_lsn_ = last_lsn;
+
+  LOG_INFO("open file success. filename=%s, fd=%d, offset=%ld, last lsn=%ld", filename, fd_, offset, last_lsn);
   return RC::SUCCESS;
 }
 
@@ -211,6 +271,55 @@ RC LogFileWriter::write(LogEntry &entry)
   return RC::SUCCESS;
 }
 
+RC LogFileWriter::write(LSN first_lsn, LSN last_lsn, span<const char> data, span<const char> more_data)
+{
+  if (last_lsn > end_lsn_) {
+    return RC::LOG_FILE_FULL;
+  }
+
+  if (fd_ < 0) {
+    return RC::FILE_NOT_OPENED;
+  }
+
+  if (first_lsn <= last_lsn_ || first_lsn > last_lsn) {
+    LOG_WARN("write log entries failed. invalid lsn. filename=%s, last_lsn=%ld, first_lsn=%ld, last_lsn=%ld", 
+             filename_.c_str(), last_lsn_, first_lsn, last_lsn);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  /// WARNING 这里需要处理日志写一半的情况
+  for (span<const char> part : {data, more_data}) {
+    if (part.empty()) {
+      continue;
+    }
+
+    int ret = writen(fd_, part.data(), static_cast<int>(part.size()));
+    if (0 != ret) {
+      LOG_WARN("write log entries failed. filename=%s, ret = %d, error=%s, lsn=[%ld, %ld]", 
+               filename_.c_str(), ret, strerror(errno), first_lsn, last_lsn);
+      return RC::IOERR_WRITE;
+    }
+  }
+
+  last_lsn_ = last_lsn;
+  LOG_TRACE("write log entries success. filename=%s, lsn=[%ld, %ld], size=%d", 
+            filename_.c_str(), first_lsn, last_lsn, static_cast<int>(data.size() + more_data.size()));
+  return RC::SUCCESS;
+}
+
+RC LogFileWriter::sync()
+{
+  if (fd_ < 0) {
+    return RC::FILE_NOT_OPENED;
+  }
+
+  if (fdatasync(fd_) != 0) {
+    LOG_WARN("sync log file failed. filename=%s, error=%s", filename_.c_str(), strerror(errno));
+    return RC::IOERR_SYNC;
+  }
+  return RC::SUCCESS;
+}
+
 bool LogFileWriter::valid() const { return fd_ >= 0; }
 
 bool LogFileWriter::full() const { return last_lsn_ >= end_lsn_; }
@@ -220,10 +329,13 @@ string LogFileWriter::to_string() const { return filename_; }
 ////////////////////////////////////////////////////////////////////////////////
 // LogFileManager
 
-RC LogFileManager::init(const char *directory, int max_entry_number_per_file)
+RC LogFileManager::init(
+    const char *directory, int max_entry_number_per_file, int64_t file_size /*= 0*/, int max_recycled_files /*= 0*/)
 {
   directory_                 = filesystem::absolute(filesystem::path(directory));
   max_entry_number_per_file_ = max_entry_number_per_file;
+  file_size_                 = file_size;
+  max_recycled_files_        = max_recycled_files;
 
   // 检查目录是否存在，不存在就创建出来
   if (!filesystem::is_directory(directory_)) {
@@ -244,8 +356,14 @@ RC LogFileManager::init(const char *directory, int max_entry_number_per_file)
     }
 
     string filename = dir_entry.path().filename().string();
-    LSN    lsn      = 0;
-    RC     rc       = get_lsn_from_filename(filename, lsn);
+    if (filename.starts_with(recycle_file_prefix_) && filename.ends_with(file_suffix_)) {
+      // 回收池中的文件，上次运行时留下来的
+      recycled_files_.push_back(dir_entry.path());
+      continue;
+    }
+
+    LSN lsn = 0;
+    RC  rc  = get_lsn_from_filename(filename, lsn);
     if (OB_FAIL(rc)) {
       LOG_TRACE("invalid log file name. filename=%s", filename.c_str());
       continue;
@@ -260,8 +378,19 @@ RC LogFileManager::init(const char *directory, int max_entry_number_per_file)
     log_files_.emplace(lsn, dir_entry.path());
   }
 
-  LOG_INFO("init log file manager success. directory=%s, log files=%d", 
-           directory_.c_str(), static_cast<int>(log_files_.size()));
+  // 回收池中文件的编号接着已有的文件往后排
+  for (const filesystem::path &file_path : recycled_files_) {
+    const string filename = file_path.filename().string();
+    const char  *id_begin = filename.data() + strlen(recycle_file_prefix_);
+    const char  *id_end   = filename.data() + filename.length() - strlen(file_suffix_);
+    int64_t      id       = 0;
+    if (from_chars(id_begin, id_end, id).ec == errc() && id >= next_recycle_file_id_) {
+      next_recycle_file_id_ = id + 1;
+    }
+  }
+
+  LOG_INFO("init log file manager success. directory=%s, log files=%d, recycled files=%d", 
+           directory_.c_str(), static_cast<int>(log_files_.size()), static_cast<int>(recycled_files_.size()));
   return RC::SUCCESS;
 }
 
@@ -287,6 +416,7 @@ RC LogFileManager::list_files(vector<string> &files, LSN start_lsn)
 {
   files.clear();
 
+  lock_guard guard(lock_);
   // 这里的代码是AI自动生成的
   // 其实写的不好，我们只需要找到比start_lsn相等或者小的第一个日志文件就可以了
   for (auto &file : log_files_) {
@@ -300,7 +430,9 @@ RC LogFileManager::list_files(vector<string> &files, LSN start_lsn)
 
 RC LogFileManager::last_file(LogFileWriter &file_writer)
 {
+  unique_lock guard(lock_);
   if (log_files_.empty()) {
+    guard.unlock();
     return next_file(file_writer);
   }
 
@@ -314,14 +446,163 @@ RC LogFileManager::next_file(LogFileWriter &file_writer)
 {
   file_writer.close();
 
-  LSN lsn = 0;
+  lock_guard guard(lock_);
+  LSN        lsn = 0;
   if (!log_files_.empty()) {
     lsn = log_files_.rbegin()->first + max_entry_number_per_file_;
   }
 
   string           filename  = file_prefix_ + to_string(lsn) + file_suffix_;
   filesystem::path file_path = directory_ / filename;
+
+  if (!recycled_files_.empty()) {
+    error_code ec;
+    filesystem::rename(recycled_files_.front(), file_path, ec);
+    if (ec) {
+      LOG_WARN("failed to reuse recycled log file. file=%s, new file=%s, error=%s", 
+               recycled_files_.front().c_str(), file_path.c_str(), ec.message().c_str());
+    } else {
+      LOG_INFO("reuse recycled log file. file=%s, new file=%s", recycled_files_.front().c_str(), file_path.c_str());
+    }
+    recycled_files_.pop_front();
+  }
+
+  if (file_size_ > 0) {
+    RC rc = preallocate_file(file_path, file_size_);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to preallocate log file. file=%s, size=%ld, rc=%s", file_path.c_str(), file_size_, strrc(rc));
+      return rc;
+    }
+  }
+
   log_files_.emplace(lsn, file_path);
 
   return file_writer.open(file_path.c_str(), lsn + max_entry_number_per_file_ - 1);
 }
+
+RC LogFileManager::truncate(LSN lsn, int &removed_num)
+{
+  removed_num = 0;
+
+  lock_guard guard(lock_);
+  while (log_files_.size() > 1) {
+    auto      iter     = log_files_.begin();
+    const LSN last_lsn = iter->first + max_entry_number_per_file_ - 1;
+    if (last_lsn >= lsn) {
+      break;
+    }
+
+    if (static_cast<int>(recycled_files_.size()) < max_recycled_files_) {
+      RC rc = recycle_file(iter->second);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      LOG_INFO("recycle log file before checkpoint. file=%s, checkpoint lsn=%ld", iter->second.c_str(), lsn);
+    } else {
+      error_code ec;
+      filesystem::remove(iter->second, ec);
+      if (ec) {
+        LOG_WARN("failed to remove log file. file=%s, error=%s", iter->second.c_str(), ec.message().c_str());
+        return RC::FILE_REMOVE;
+      }
+      LOG_INFO("remove log file before checkpoint. file=%s, checkpoint lsn=%ld", iter->second.c_str(), lsn);
+    }
+
+    log_files_.erase(iter);
+    removed_num++;
+  }
+
+  return RC::SUCCESS;
+}
+
+size_t LogFileManager::file_num() const
+{
+  lock_guard guard(lock_);
+  return log_files_.size();
+}
+
+size_t LogFileManager::recycled_file_num() const
+{
+  lock_guard guard(lock_);
+  return recycled_files_.size();
+}
+
+RC LogFileManager::recycle_file(const filesystem::path &file_path)
+{
+  int fd = ::open(file_path.c_str(), O_WRONLY);
+  if (fd < 0) {
+    LOG_WARN("open file failed. filename=%s, error=%s", file_path.c_str(), strerror(errno));
+    return RC::FILE_OPEN;
+  }
+
+  LogHeader zero_header{};
+  int       ret = pwriten(fd, &zero_header, LogHeader::SIZE, 0);
+  if (0 == ret && fdatasync(fd) != 0) {
+    ret = errno;
+  }
+  ::close(fd);
+  if (0 != ret) {
+    LOG_WARN("failed to clear the first log header. filename=%s, error=%s", file_path.c_str(), strerror(ret));
+    return RC::IOERR_WRITE;
+  }
+
+  filesystem::path recycle_path =
+      directory_ / (string(recycle_file_prefix_) + to_string(next_recycle_file_id_++) + file_suffix_);
+
+  error_code ec;
+  filesystem::rename(file_path, recycle_path, ec);
+  if (ec) {
+    LOG_WARN("failed to rename log file. file=%s, new file=%s, error=%s", 
+             file_path.c_str(), recycle_path.c_str(), ec.message().c_str());
+    return RC::FILE_REMOVE;
+  }
+
+  recycled_files_.push_back(recycle_path);
+  return RC::SUCCESS;
+}
+
+RC LogFileManager::preallocate_file(const filesystem::path &file_path, int64_t size)
+{
+  int fd = ::open(file_path.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd < 0) {
+    LOG_WARN("open file failed. filename=%s, error=%s", file_path.c_str(), strerror(errno));
+    return RC::FILE_CREATE;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    LOG_WARN("stat file failed. filename=%s, error=%s", file_path.c_str(), strerror(errno));
+    ::close(fd);
+    return RC::IOERR_ACCESS;
+  }
+
+  if (st.st_size >= size) {
+    // 回收的文件已经足够大了
+    ::close(fd);
+    return RC::SUCCESS;
+  }
+
+#ifdef __linux__
+  int ret = fallocate(fd, 0 /*mode*/, 0, size);
+#else
+  int ret = -1;
+  errno   = EOPNOTSUPP;
+#endif
+  if (ret != 0) {
+    // 文件系统不支持时退化成修改文件大小，至少写日志时不需要再修改文件大小
+    LOG_INFO("fallocate is not supported, use ftruncate instead. filename=%s, error=%s", 
+             file_path.c_str(), strerror(errno));
+    ret = ftruncate(fd, size);
+  }
+
+  // 文件大小的变化要落盘，之后写日志时只需要fdatasync
+  if (ret != 0 || fsync(fd) != 0) {
+    LOG_WARN("failed to preallocate file. filename=%s, size=%ld, error=%s", file_path.c_str(), size, strerror(errno));
+    ::close(fd);
+    return RC::IOERR_WRITE;
+  }
+
+  ::close(fd);
+  LOG_INFO("preallocate log file. filename=%s, size=%ld", file_path.c_str(), size);
+  return RC::SUCCESS;
+}
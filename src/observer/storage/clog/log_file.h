@@ -16,18 +16,25 @@ See the Mulan PSL v2 for more details. */
 
 #include "common/sys/rc.h"
 #include "common/types.h"
+#include "common/lang/deque.h"
 #include "common/lang/map.h"
+#include "common/lang/mutex.h"
 #include "common/lang/functional.h"
 #include "common/lang/filesystem.h"
 #include "common/lang/fstream.h"
+#include "common/lang/span.h"
 #include "common/lang/string.h"
 
+struct LogHeader;
 class LogEntry;
 
 /**
  * @brief 负责处理一个日志文件，包括读取和写入
  * @ingroup CLog
- * @details 日志文件中的日志是按照LSN从小到大排列的
+ * @details 日志文件中的日志是按照LSN从小到大排列的，并且LSN是连续的。
+ * 日志文件可能是预先分配好空间的，或者是回收再利用的老文件，所以读到文件末尾之前也可能遇到无效的数据：
+ * 全是0的日志头(预分配的空间)、LSN不连续的日志头(老文件中残留的日志)或者没有写完整的日志，
+ * 这些都认为是日志的结尾。
  */
 class LogFileReader
 {
@@ -40,6 +47,14 @@ public:
 
   RC iterate(function<RC(LogEntry &)> callback, LSN start_lsn = 0);
 
+  /**
+   * @brief 找到有效日志的结尾
+   * @details 写日志时从这个位置接着写
+   * @param[out] offset 最后一条有效日志之后的位置
+   * @param[out] last_lsn 最后一条有效日志的LSN，没有日志时是0
+   */
+  RC find_end(int64_t &offset, LSN &last_lsn);
+
 private:
   /**
    * @brief 跳到第一条不小于start_lsn的日志
@@ -48,9 +63,13 @@ private:
    */
   RC skip_to(LSN start_lsn);
 
+  /// @brief 是否已经到了有效日志的结尾
+  bool end_of_log(const LogHeader &header) const;
+
 private:
   int    fd_ = -1;
   string filename_;
+  LSN    last_lsn_ = 0;  /// 上一条读到的日志的LSN，用来检查LSN是否连续
 };
 
 /**
@@ -65,6 +84,7 @@ public:
 
   /**
    * @brief 打开一个日志文件
+   * @details 从文件中最后一条有效日志的后面开始写，文件中剩下的空间会被覆盖
    * @param filename 日志文件名
    * @param end_lsn 当前日志文件允许的最大LSN（包含）
    */
@@ -74,8 +94,24 @@ public:
   RC close();
 
   /// @brief 写入一条日志
+  /// @details 文件没有使用O_SYNC打开，写入后需要调用 sync 才能保证日志落盘
   RC write(LogEntry &entry);
 
+  /**
+   * @brief 写入一批连续的日志
+   * @details 数据已经按照文件中的格式排列好了，参考 LogEntryBuffer。数据在环形缓冲区中
+   * 可能被分成两段，依次写入
+   * @param first_lsn 第一条日志的LSN
+   * @param last_lsn 最后一条日志的LSN，不能超过 end_lsn
+   */
+  RC write(LSN first_lsn, LSN last_lsn, span<const char> data, span<const char> more_data = {});
+
+  /**
+   * @brief 把已经写入的日志刷到磁盘
+   * @details 一批日志只需要sync一次，这是组提交(group commit)能够减少IO次数的关键
+   */
+  RC sync();
+
   /**
    * @brief 当前文件是否已经打开
    */
@@ -89,6 +125,7 @@ public:
   string to_string() const;
 
   const char *filename() const { return filename_.c_str(); }
+  LSN         end_lsn() const { return end_lsn_; }
 
 private:
   string filename_;       /// 日志文件名
@@ -102,6 +139,9 @@ private:
  * @ingroup CLog
  * @details 日志文件都在某个目录下，使用固定的前缀加上日志文件的第一个LSN作为文件名。
  * 每个日志文件没有最大字节数要求，但是以固定条数的日志为一个文件，这样方便查找。
+ * 新的日志文件会预先分配好空间(fallocate)，写日志时就不需要频繁地修改文件大小。
+ * 检查点之前的日志文件不会直接删除，而是改名放到回收池中，下次需要新文件时直接拿来覆盖写，
+ * 这样稳定运行时写日志都是在已经分配好的磁盘块上覆盖写。
  */
 class LogFileManager
 {
@@ -114,8 +154,10 @@ public:
    *
    * @param directory 日志文件目录
    * @param max_entry_number_per_file 一个文件最多存储多少条日志
+   * @param file_size 新日志文件预先分配的大小，0表示不预先分配。日志超过这个大小时文件会继续变大
+   * @param max_recycled_files 回收池中最多保留多少个文件，0表示不回收，直接删除
    */
-  RC init(const char *directory, int max_entry_number_per_file);
+  RC init(const char *directory, int max_entry_number_per_file, int64_t file_size = 0, int max_recycled_files = 0);
 
   /**
    * @brief 列出所有的日志文件，第一个日志文件包含大于等于start_lsn最小的日志
@@ -133,11 +175,42 @@ public:
 
   /**
    * @brief 获取一个新的日志文件名
-   * @details 获取下一个日志文件名。通常是上一个日志文件写满了，通过这个接口生成下一个日志文件
+   * @details 获取下一个日志文件名。通常是上一个日志文件写满了，通过这个接口生成下一个日志文件。
+   * 优先使用回收池中的文件，没有的话就创建一个新文件并预先分配空间。
    */
   RC next_file(LogFileWriter &file_writer);
 
+  /**
+   * @brief 删除检查点之前的日志文件
+   * @details 文件中所有日志的LSN都小于lsn时，这个文件在恢复时就不再需要了。
+   * 最后一个文件正在被写入，永远不会删除。回收池没有满时，文件会放到回收池中而不是删除。
+   * @param lsn 检查点LSN，恢复时从这个LSN开始重做
+   * @param removed_num 删除或者回收的文件个数
+   */
+  RC truncate(LSN lsn, int &removed_num);
+
+  /**
+   * @brief 当前日志文件的个数
+   */
+  size_t file_num() const;
+
+  /**
+   * @brief 回收池中的文件个数
+   */
+  size_t recycled_file_num() const;
+
 private:
+  /**
+   * @brief 把一个不再需要的日志文件放到回收池中
+   * @details 先把第一个日志头清零，这样即使在改名之后、写入新日志之前崩溃，这个文件也会被当成空文件
+   */
+  RC recycle_file(const filesystem::path &file_path);
+
+  /**
+   * @brief 预先分配文件空间
+   */
+  static RC preallocate_file(const filesystem::path &file_path, int64_t size);
+
   /**
    * @brief 从文件名称中获取LSN
    * @details 如果日志文件名不符合要求，就返回失败
@@ -145,11 +218,18 @@ private:
   static RC get_lsn_from_filename(const string &filename, LSN &lsn);
 
 private:
-  static constexpr const char *file_prefix_ = "clog_";
-  static constexpr const char *file_suffix_ = ".log";
+  static constexpr const char *file_prefix_         = "clog_";
+  static constexpr const char *file_suffix_         = ".log";
+  static constexpr const char *recycle_file_prefix_ = "clog_recycle_";
 
   filesystem::path directory_;                  /// 日志文件存放的目录
   int              max_entry_number_per_file_;  /// 一个文件最大允许存放多少条日志
-
-  map<LSN, filesystem::path> log_files_;  /// 日志文件名和第一个LSN的映射
+  int64_t          file_size_            = 0;   /// 新日志文件预先分配的大小
+  int              max_recycled_files_   = 0;   /// 回收池中最多保留多少个文件
+  int64_t          next_recycle_file_id_ = 0;   /// 用来生成回收池中的文件名
+
+  /// 日志线程创建新文件，检查点删除老文件，需要保护 log_files_
+  mutable mutex              lock_;
+  map<LSN, filesystem::path> log_files_;       /// 日志文件名和第一个LSN的映射
+  deque<filesystem::path>    recycled_files_;  /// 回收池中的文件
 };
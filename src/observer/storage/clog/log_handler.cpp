@@ -21,8 +21,12 @@ See the Mulan PSL v2 for more details. */
 
 RC LogHandler::append(LSN &lsn, LogModule::Id module, span<const char> data)
 {
-  vector<char> data_vec(data.begin(), data.end());
-  return append(lsn, module, std::move(data_vec));
+  if (static_cast<int64_t>(data.size()) > LogEntry::max_payload_size()) {
+    return RC::INVALID_ARGUMENT;
+  }
+
+  return append(
+      lsn, module, static_cast<int32_t>(data.size()), [data](LogPayloadWriter &writer) { writer.write(data); });
 }
 
 RC LogHandler::append(LSN &lsn, LogModule::Id module, vector<char> &&data)
@@ -30,6 +34,23 @@ RC LogHandler::append(LSN &lsn, LogModule::Id module, vector<char> &&data)
   return _append(lsn, LogModule(module), std::move(data));
 }
 
+RC LogHandler::append(LSN &lsn, LogModule::Id module, int32_t size, const LogPayloadSerializer &serializer)
+{
+  return _append(lsn, LogModule(module), size, serializer);
+}
+
+RC LogHandler::_append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer)
+{
+  if (size < 0 || size > LogEntry::max_payload_size()) {
+    return RC::INVALID_ARGUMENT;
+  }
+
+  vector<char>     data(size);
+  LogPayloadWriter writer{span<char>(data)};
+  serializer(writer);
+  return _append(lsn, module, std::move(data));
+}
+
 RC LogHandler::create(const char *name, LogHandler *&log_handler)
 {
   if (name == nullptr || common::is_blank(name)) {
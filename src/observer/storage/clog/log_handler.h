@@ -21,13 +21,13 @@ See the Mulan PSL v2 for more details. */
 #include "common/lang/span.h"
 #include "common/lang/vector.h"
 #include "storage/clog/log_module.h"
+#include "storage/clog/log_entry.h"
 
 /**
  * @defgroup CLog commit log/redo log
  */
 
 class LogReplayer;
-class LogEntry;
 
 /**
  * @brief 对外提供服务的CLog模块
@@ -88,6 +88,18 @@ public:
   virtual RC append(LSN &lsn, LogModule::Id module, span<const char> data);
   virtual RC append(LSN &lsn, LogModule::Id module, vector<char> &&data);
 
+  /**
+   * @brief 写入一条日志，日志数据直接序列化到日志缓冲区中
+   * @details 先在日志缓冲区中预留size字节的空间，再调用serializer把数据写进去，
+   * 不需要调用者先构造一个临时的vector。
+   * @param lsn 返回的LSN
+   * @param module 日志模块
+   * @param size 日志数据的大小，不包含日志头
+   * @param serializer 把日志数据写到预留的空间中，必须正好写入size个字节
+   * @note 子类不应该重新实现这个函数
+   */
+  virtual RC append(LSN &lsn, LogModule::Id module, int32_t size, const LogPayloadSerializer &serializer);
+
   /**
    * @brief 等待某个LSN的日志被刷新到磁盘
    * @param lsn 日志的LSN
@@ -96,6 +108,12 @@ public:
 
   virtual LSN current_lsn() const = 0;
 
+  /**
+   * @brief 做完检查点后，清理恢复时不再需要的日志
+   * @param check_point_lsn 恢复时从这个LSN开始重做，比它小的日志都可以删除
+   */
+  virtual RC truncate(LSN check_point_lsn) = 0;
+
   static RC create(const char *name, LogHandler *&handler);
 
 private:
@@ -104,4 +122,11 @@ private:
    * @details 子类应该重现实现这个函数
    */
   virtual RC _append(LSN &lsn, LogModule module, vector<char> &&data) = 0;
+
+  /**
+   * @brief 写入一条日志，由serializer直接写日志数据
+   * @details 默认实现把数据序列化到一个vector中再调用上面的函数。
+   * 有日志缓冲区的子类应该重新实现它，直接写到缓冲区中。
+   */
+  virtual RC _append(LSN &lsn, LogModule module, int32_t size, const LogPayloadSerializer &serializer);
 };
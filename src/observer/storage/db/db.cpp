@@ -17,10 +17,14 @@ See the Mulan PSL v2 for more details. */
 #include <fcntl.h>
 #include <sys/stat.h>
 
+#include "common/conf/ini.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/chrono.h"
 #include "common/lang/string.h"
 #include "common/log/log.h"
 #include "common/os/path.h"
 #include "common/global_context.h"
+#include "common/thread/thread_util.h"
 #include "storage/common/meta_util.h"
 #include "storage/table/table.h"
 #include "storage/table/table_meta.h"
@@ -30,8 +34,33 @@ See the Mulan PSL v2 for more details. */
 
 using namespace common;
 
+/// buffer pool 相关的配置都放在配置文件的这个section中
+static const char *BUFFER_POOL_SECTION = "BUFFER_POOL";
+
+/**
+ * @brief 从配置文件中读取一个整数类型的buffer pool配置项
+ * @details 配置项不存在或者格式不正确时，返回默认值
+ */
+static int buffer_pool_int_config(const char *key, int default_value)
+{
+  string value  = get_properties()->get(key, "", BUFFER_POOL_SECTION);
+  int    result = default_value;
+  if (!value.empty() && !str_to_val(value, result)) {
+    LOG_WARN("invalid buffer pool config. key=%s, value=%s, use default %d", key, value.c_str(), default_value);
+    result = default_value;
+  }
+  return result;
+}
+
 Db::~Db()
 {
+  stop_checkpoint_thread();
+
+  if (buffer_pool_manager_) {
+    buffer_pool_manager_->stop_warm_up();
+    buffer_pool_manager_->stop_page_cleaner();
+  }
+
   for (auto &iter : opened_tables_) {
     delete iter.second;
   }
@@ -84,7 +113,12 @@ RC Db::init(const char *name, const char *dbpath, const char *trx_kit_name, cons
 
   storage_engine_ = storage_engine;
 
-  buffer_pool_manager_ = make_unique<BufferPoolManager>();
+  const int    frame_shard_num = buffer_pool_int_config("FRAME_SHARD_NUM", 1);
+  const string frame_replacer  = get_properties()->get("FRAME_REPLACER", "lru", BUFFER_POOL_SECTION);
+  const bool   direct_io       = buffer_pool_int_config("DIRECT_IO", 0) != 0;
+  const bool   huge_page       = buffer_pool_int_config("HUGE_PAGE", 0) != 0;
+  buffer_pool_manager_ = make_unique<BufferPoolManager>(
+      0 /*memory_size*/, frame_shard_num, frame_replacer.c_str(), direct_io, huge_page);
   auto dblwr_buffer    = make_unique<DiskDoubleWriteBuffer>(*buffer_pool_manager_);
 
   const char      *double_write_buffer_filename  = "dblwr.db";
@@ -102,6 +136,14 @@ RC Db::init(const char *name, const char *dbpath, const char *trx_kit_name, cons
     return rc;
   }
 
+  const int read_ahead_pages   = buffer_pool_int_config("READ_AHEAD_PAGES", 32);
+  const int read_ahead_threads = buffer_pool_int_config("READ_AHEAD_THREADS", 2);
+  rc = buffer_pool_manager_->enable_read_ahead(read_ahead_pages, read_ahead_threads);
+  if (OB_FAIL(rc)) {
+    LOG_ERROR("Failed to enable buffer pool read ahead. dbpath=%s, rc=%s", dbpath, strrc(rc));
+    return rc;
+  }
+
   filesystem::path clog_path       = filesystem::path(dbpath) / "clog";
   LogHandler      *tmp_log_handler = nullptr;
   rc                               = LogHandler::create(log_handler_name, tmp_log_handler);
@@ -148,6 +190,30 @@ RC Db::init(const char *name, const char *dbpath, const char *trx_kit_name, cons
     return rc;
   }
 
+  const int dirty_page_ratio = buffer_pool_int_config("DIRTY_PAGE_RATIO", 10);
+  const int clean_batch_size = buffer_pool_int_config("PAGE_CLEANER_BATCH_SIZE", 64);
+  rc = buffer_pool_manager_->start_page_cleaner(dirty_page_ratio, clean_batch_size);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to start page cleaner. dbpath=%s, rc=%s", dbpath, strrc(rc));
+    return rc;
+  }
+
+  // 预热需要所有的表都已经打开，并且已经完成恢复
+  const int        dump_interval = buffer_pool_int_config("BUFFER_POOL_DUMP_INTERVAL", 60);
+  filesystem::path dump_file     = filesystem::path(dbpath) / "buffer_pool.dump";
+  rc = buffer_pool_manager_->start_warm_up(dump_file.c_str(), dump_interval);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to start buffer pool warm up. dbpath=%s, rc=%s", dbpath, strrc(rc));
+    return rc;
+  }
+
+  const int checkpoint_interval = buffer_pool_int_config("CHECKPOINT_INTERVAL", 60);
+  rc = start_checkpoint_thread(checkpoint_interval, clean_batch_size);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to start checkpoint thread. dbpath=%s, rc=%s", dbpath, strrc(rc));
+    return rc;
+  }
+
   return rc;
 }
 
@@ -308,16 +374,143 @@ RC Db::sync()
     return rc;
   }
 
-  check_point_lsn_ = current_lsn;
-  rc               = flush_meta();
+  rc = advance_check_point(current_lsn);
   if (OB_FAIL(rc)) {
-    LOG_ERROR("Failed to flush meta. db=%s, rc=%d:%s", name_.c_str(), rc, strrc(rc));
+    LOG_ERROR("Failed to advance check point. db=%s, rc=%d:%s", name_.c_str(), rc, strrc(rc));
     return rc;
   }
   LOG_DEBUG("Successfully sync db. db=%s", name_.c_str());
   return rc;
 }
 
+RC Db::checkpoint(LSN max_lsn)
+{
+  // 先确定LSN的上限，再检查活跃事务和脏页。在这之后开始的事务和变脏的页面，日志都比上限大
+  LSN lsn       = max_lsn;
+  LSN trx_lsn   = 0;
+  LSN dirty_lsn = 0;
+  if (trx_kit_->min_active_lsn(trx_lsn)) {
+    lsn = min(lsn, trx_lsn);
+  }
+  if (buffer_pool_manager_->min_dirty_lsn(dirty_lsn)) {
+    lsn = min(lsn, dirty_lsn);
+  }
+
+  {
+    lock_guard guard(check_point_lock_);
+    if (lsn <= check_point_lsn_) {
+      return RC::SUCCESS;
+    }
+  }
+
+  // 已经不在脏页列表中的页面，可能还在double write buffer的内存里
+  auto dblwr_buffer = static_cast<DiskDoubleWriteBuffer *>(buffer_pool_manager_->get_dblwr_buffer());
+  RC   rc           = dblwr_buffer->flush_page();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to flush double write buffer. db=%s, rc=%s", name_.c_str(), strrc(rc));
+    return rc;
+  }
+
+  // 重做从检查点这条日志开始，保证它已经落盘
+  rc = log_handler_->wait_lsn(lsn);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to wait lsn. lsn=%ld, rc=%s", lsn, strrc(rc));
+    return rc;
+  }
+
+  return advance_check_point(lsn);
+}
+
+RC Db::advance_check_point(LSN lsn)
+{
+  lock_guard guard(check_point_lock_);
+  if (lsn <= check_point_lsn_) {
+    return RC::SUCCESS;
+  }
+
+  const LSN old_lsn = check_point_lsn_;
+  check_point_lsn_  = lsn;
+  RC rc             = flush_meta();
+  if (OB_FAIL(rc)) {
+    check_point_lsn_ = old_lsn;
+    LOG_WARN("failed to flush meta. db=%s, rc=%s", name_.c_str(), strrc(rc));
+    return rc;
+  }
+
+  // 元数据已经落盘，即使删除日志文件失败，下次做检查点时还会再删除
+  rc = log_handler_->truncate(lsn);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to truncate log. db=%s, check point lsn=%ld, rc=%s", name_.c_str(), lsn, strrc(rc));
+  }
+
+  LOG_INFO("check point advanced. db=%s, lsn=%ld -> %ld", name_.c_str(), old_lsn, lsn);
+  return RC::SUCCESS;
+}
+
+RC Db::start_checkpoint_thread(int interval_sec, int flush_batch_size)
+{
+  if (interval_sec <= 0) {
+    LOG_INFO("checkpoint thread is disabled");
+    return RC::SUCCESS;
+  }
+
+#ifndef CONCURRENCY
+  LOG_INFO("checkpoint thread is disabled without CONCURRENCY");
+  return RC::SUCCESS;
+#endif
+
+  checkpoint_running_ = true;
+  checkpoint_thread_  = make_unique<thread>(&Db::checkpoint_thread_func, this, interval_sec, flush_batch_size);
+  LOG_INFO("checkpoint thread started. interval=%ds", interval_sec);
+  return RC::SUCCESS;
+}
+
+void Db::stop_checkpoint_thread()
+{
+  if (!checkpoint_thread_) {
+    return;
+  }
+
+  {
+    lock_guard guard(checkpoint_thread_lock_);
+    checkpoint_running_ = false;
+  }
+  checkpoint_cond_.notify_all();
+
+  checkpoint_thread_->join();
+  checkpoint_thread_.reset();
+  LOG_INFO("checkpoint thread stopped");
+}
+
+void Db::checkpoint_thread_func(int interval_sec, int flush_batch_size)
+{
+  thread_set_name("Checkpoint");
+
+  /*
+  前台线程修改页面时，先写日志再把页面标记为脏页，中间有一个很短的窗口，这期间的日志在脏页列表中是看不到的。
+  这里使用上一轮记录的LSN作为检查点的上限，经过一个时间间隔，这些页面早就已经在脏页列表中了。
+  */
+  LSN max_lsn = log_handler_->current_lsn();
+  while (true) {
+    {
+      unique_lock guard(checkpoint_thread_lock_);
+      checkpoint_cond_.wait_for(guard, chrono::seconds(interval_sec), [this]() { return !checkpoint_running_; });
+      if (!checkpoint_running_) {
+        break;
+      }
+    }
+
+    // 先刷新最老的一批脏页，否则长时间不被淘汰的脏页会让检查点一直停在原地
+    buffer_pool_manager_->flush_dirty_pages(flush_batch_size);
+
+    RC rc = checkpoint(max_lsn);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to do checkpoint. db=%s, rc=%s", name_.c_str(), strrc(rc));
+    }
+    max_lsn = log_handler_->current_lsn();
+  }
+}
+
 RC Db::recover()
 {
   LOG_TRACE("db recover begin. check_point_lsn=%d", check_point_lsn_);
@@ -329,7 +522,14 @@ RC Db::recover()
   }
 
   IntegratedLogReplayer log_replayer(*buffer_pool_manager_, unique_ptr<LogReplayer>(trx_log_replayer));
-  RC                    rc = log_handler_->replay(log_replayer, check_point_lsn_ /*start_lsn*/);
+  const int             recovery_threads = buffer_pool_int_config("RECOVERY_THREADS", 4);
+  RC                    rc               = log_replayer.start_workers(recovery_threads);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to start log replay workers. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = log_handler_->replay(log_replayer, check_point_lsn_ /*start_lsn*/);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to replay log. rc=%s", strrc(rc));
     return rc;
@@ -381,10 +581,14 @@ RC Db::init_meta()
       return RC::IOERR_TOO_LONG;
     }
 
-    buffer[n]        = '\0';
-    check_point_lsn_ = atoll(buffer);  // 当前元数据就这一个数字
-    LOG_INFO("Successfully read db meta file. db=%s, file=%s, check_point_lsn=%ld", 
-             name_.c_str(), db_meta_file_path.c_str(), check_point_lsn_);
+    buffer[n] = '\0';
+    // 元数据格式：检查点LSN 最大的事务ID。老版本只有检查点LSN一个数字
+    char   *trx_id_str = nullptr;
+    check_point_lsn_   = strtoll(buffer, &trx_id_str, 10);
+    int32_t max_trx_id = atoi(trx_id_str);
+    trx_kit_->recover_trx_id(max_trx_id);
+    LOG_INFO("Successfully read db meta file. db=%s, file=%s, check_point_lsn=%ld, max_trx_id=%d", 
+             name_.c_str(), db_meta_file_path.c_str(), check_point_lsn_, max_trx_id);
   }
   close(fd);
 
@@ -409,7 +613,8 @@ RC Db::flush_meta()
     return RC::IOERR_WRITE;
   }
 
-  string buffer = to_string(check_point_lsn_);
+  // 检查点之前的日志会被删除，要把已经分配的最大事务ID记下来，重启后新的事务ID才不会重复
+  string buffer = to_string(check_point_lsn_) + " " + to_string(trx_kit_->current_trx_id());
   int    n      = write(fd, buffer.c_str(), buffer.size());
   if (n < 0) {
     LOG_ERROR("Failed to write db meta file. db=%s, file=%s, errno=%s", 
@@ -19,6 +19,9 @@ See the Mulan PSL v2 for more details. */
 #include "common/lang/string.h"
 #include "common/lang/unordered_map.h"
 #include "common/lang/memory.h"
+#include "common/lang/condition_variable.h"
+#include "common/lang/mutex.h"
+#include "common/lang/thread.h"
 #include "common/lang/span.h"
 #include "sql/parser/parse_defs.h"
 #include "storage/buffer/disk_buffer_pool.h"
@@ -97,6 +100,17 @@ public:
    */
   RC sync();
 
+  /**
+   * @brief 做一次模糊检查点
+   * @details 不需要停止事务，也不需要刷新所有的脏页。检查点LSN取下面几个值中最小的一个：
+   * - max_lsn，调用者保证比它小的日志对应的页面都已经被标记为脏页；
+   * - 所有脏页最早变脏时的LSN；
+   * - 活跃事务开始时的LSN，回滚事务时需要它的日志。
+   * 检查点LSN记录到元数据中，重启时从这里开始重做，之前的日志文件会被删除。
+   * @param max_lsn 检查点LSN的上限
+   */
+  RC checkpoint(LSN max_lsn);
+
   /// @brief 获取当前数据库的日志处理器
   LogHandler &log_handler();
 
@@ -124,6 +138,20 @@ private:
   /// @brief 初始化数据库的double buffer pool
   RC init_dblwr_buffer();
 
+  /// @brief 推进检查点，记录元数据并删除不再需要的日志
+  RC advance_check_point(LSN lsn);
+
+  /**
+   * @brief 启动定期做检查点的线程
+   * @details 非 CONCURRENCY 编译模式下，事务和buffer pool的锁都不生效，不会启动后台线程，
+   * 只在 sync 时推进检查点
+   * @param interval_sec 做检查点的时间间隔，不大于0表示不启动
+   * @param flush_batch_size 每次做检查点之前，刷新最老的脏页的个数，这样检查点可以向前推进
+   */
+  RC   start_checkpoint_thread(int interval_sec, int flush_batch_size);
+  void stop_checkpoint_thread();
+  void checkpoint_thread_func(int interval_sec, int flush_batch_size);
+
   StorageEngine get_storage_engine()
   {
     StorageEngine engine = StorageEngine::UNKNOWN_ENGINE;
@@ -152,5 +180,11 @@ private:
   int32_t next_table_id_ = 0;
 
   LSN    check_point_lsn_ = 0;  ///< 当前数据库的检查点LSN。会记录到磁盘中。
+  mutex  check_point_lock_;     ///< 保护检查点LSN和元数据文件，sync和检查点线程都会修改
+
+  mutex              checkpoint_thread_lock_;
+  condition_variable checkpoint_cond_;
+  bool               checkpoint_running_ = false;
+  unique_ptr<thread> checkpoint_thread_;
   string storage_engine_;
 };
@@ -14,7 +14,11 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "storage/index/bplus_tree.h"
+#include "common/lang/algorithm.h"
 #include "common/lang/lower_bound.h"
+#include "common/lang/thread.h"
+#include "common/math/simd_util.h"
+#include "common/defs.h"
 #include "common/log/log.h"
 #include "common/global_context.h"
 #include "sql/parser/parse_defs.h"
@@ -29,18 +33,129 @@ using namespace common;
  */
 #define FIRST_INDEX_PAGE 1
 
-int calc_internal_page_capacity(int attr_length)
+int calc_internal_page_capacity(int attr_length, bool prefix_compression)
 {
   int item_size = attr_length + sizeof(RID) + sizeof(PageNum);
-  int capacity  = ((int)BP_PAGE_DATA_SIZE - InternalIndexNode::HEADER_SIZE) / item_size;
-  return capacity;
+  int data_size = (int)BP_PAGE_DATA_SIZE - InternalIndexNode::HEADER_SIZE;
+  if (prefix_compression) {
+    // 按照键值完全压缩计算。节点实际能存放多少元素，还要看节点中键值的公共前缀有多长
+    item_size -= attr_length;
+    data_size -= IndexNodeFences::HEADER_SIZE + 2 * attr_length;
+  }
+  return data_size / item_size;
 }
 
-int calc_leaf_page_capacity(int attr_length)
+int calc_leaf_page_capacity(int attr_length, bool prefix_compression)
 {
   int item_size = attr_length + sizeof(RID) + sizeof(RID);
-  int capacity  = ((int)BP_PAGE_DATA_SIZE - LeafIndexNode::HEADER_SIZE) / item_size;
-  return capacity;
+  int data_size = (int)BP_PAGE_DATA_SIZE - LeafIndexNode::HEADER_SIZE;
+  if (prefix_compression) {
+    item_size -= attr_length;
+    data_size -= IndexNodeFences::HEADER_SIZE + 2 * attr_length;
+  }
+  return data_size / item_size;
+}
+
+namespace {
+
+/**
+ * @brief 读取一个数值
+ * @details 与通用比较器一致：所有字节都是0xFF的值表示NULL，构造 Value 后按照0比较
+ */
+template <typename T>
+T load_numeric(const char *data)
+{
+  uint32_t bits;
+  memcpy(&bits, data, sizeof(bits));
+  if (bits == UINT32_MAX) {
+    bits = 0;
+  }
+  T value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+int compare_numeric(int32_t value, int32_t key) { return common::compare_int(&value, &key); }
+int compare_numeric(float value, float key) { return common::compare_float(&value, &key); }
+
+#ifdef USE_SIMD
+int simd_partition_point(const char *values, int stride, int size, int32_t key, bool upper)
+{
+  return mm256_partition_point_epi32(values, stride, size, key, upper);
+}
+int simd_partition_point(const char *values, int stride, int size, float key, bool upper)
+{
+  return mm256_partition_point_ps(values, stride, size, key, static_cast<float>(EPSILON), upper);
+}
+#endif
+
+/**
+ * @brief 在间隔存放的有序数值中查找
+ * @details 比较的方式与 compare_int/compare_float 一致。先二分查找缩小范围，开启 USE_SIMD 时剩下的几十个值一起比较。
+ * @param upper false 时返回第一个不小于 key 的位置，true 时返回第一个大于 key 的位置
+ */
+template <typename T>
+int numeric_partition_point(const char *values, int stride, int size, T key, bool upper)
+{
+  auto before = [key, upper](const char *data) {
+    int result = compare_numeric(load_numeric<T>(data), key);
+    return upper ? result <= 0 : result < 0;
+  };
+
+  int first = 0;
+  int count = size;
+#ifdef USE_SIMD
+  while (count > 4 * SIMD_WIDTH) {
+#else
+  while (count > 0) {
+#endif
+    const int step = count / 2;
+    if (before(values + (first + step) * stride)) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+#ifdef USE_SIMD
+  first += simd_partition_point(values + first * stride, stride, count, key, upper);
+#endif
+  return first;
+}
+
+}  // namespace
+
+int KeyComparator::lower_bound(const char *items, int item_size, int size, const char *key, bool *found) const
+{
+  char                        *data = const_cast<char *>(items);
+  common::BinaryIterator<char> iter_begin(item_size, data);
+  if (search_mode_ == KeySearchMode::GENERIC) {
+    common::BinaryIterator<char> iter_end(item_size, data + size * item_size);
+    return static_cast<int>(common::lower_bound(iter_begin, iter_end, key, *this, found) - iter_begin);
+  }
+
+  int first = 0;
+  int last  = 0;
+  if (search_mode_ == KeySearchMode::INT32) {
+    const int32_t value = load_numeric<int32_t>(key);
+    first = numeric_partition_point(items, item_size, size, value, false /*upper*/);
+    last  = first + numeric_partition_point(items + first * item_size, item_size, size - first, value, true /*upper*/);
+  } else {
+    const float value = load_numeric<float>(key);
+    first = numeric_partition_point(items, item_size, size, value, false /*upper*/);
+    last  = first + numeric_partition_point(items + first * item_size, item_size, size - first, value, true /*upper*/);
+  }
+
+  // 属性值相等的键值按照RID排序
+  const int rid_offset     = attr_comparator_.attr_length();
+  auto      rid_comparator = [rid_offset](const char *item, const char *key) {
+    return RID::compare(
+        reinterpret_cast<const RID *>(item + rid_offset), reinterpret_cast<const RID *>(key + rid_offset));
+  };
+  common::BinaryIterator<char> equal_begin(item_size, data + first * item_size);
+  common::BinaryIterator<char> equal_end(item_size, data + last * item_size);
+  return first + static_cast<int>(common::lower_bound(equal_begin, equal_end, key, rid_comparator, found) - equal_begin);
 }
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -54,29 +169,309 @@ void IndexNodeHandler::init_empty(bool leaf)
   node_->is_leaf = leaf;
   node_->key_num = 0;
   node_->parent  = BP_INVALID_PAGE_NUM;
+  if (prefix_compressed()) {
+    fences()->flags         = 0;
+    fences()->prefix_length = 0;
+  }
 }
 PageNum IndexNodeHandler::page_num() const { return frame_->page_num(); }
 
 int IndexNodeHandler::key_size() const { return header_.key_length; }
 
-int IndexNodeHandler::value_size() const
-{
-  // return header_.value_size;
-  return sizeof(RID);
-}
+int IndexNodeHandler::value_size() const { return is_leaf() ? sizeof(RID) : sizeof(PageNum); }
 
 int IndexNodeHandler::item_size() const { return key_size() + value_size(); }
 
 int IndexNodeHandler::size() const { return node_->key_num; }
 
-int IndexNodeHandler::max_size() const { return is_leaf() ? header_.leaf_max_size : header_.internal_max_size; }
+int IndexNodeHandler::max_size() const
+{
+  const int max = is_leaf() ? header_.leaf_max_size : header_.internal_max_size;
+  if (!prefix_compressed()) {
+    return max;
+  }
+  return min(max, node_capacity(header_, is_leaf(), prefix_length()));
+}
 
 int IndexNodeHandler::min_size() const
 {
-  const int max = this->max_size();
+  int max = is_leaf() ? header_.leaf_max_size : header_.internal_max_size;
+  if (prefix_compressed()) {
+    // 按照不压缩时的容量计算，这样节点的范围变大(公共前缀变短)之后，合并或者重新分配的元素也一定放得下
+    max = min(max, node_capacity(header_, is_leaf(), 0));
+  }
   return max - max / 2;
 }
 
+int IndexNodeHandler::max_size_after_merge(const IndexNodeHandler &other) const
+{
+  const int max = is_leaf() ? header_.leaf_max_size : header_.internal_max_size;
+  if (!prefix_compressed()) {
+    return max;
+  }
+
+  // 两个节点的范围是相邻的，合并后的公共前缀就是四个边界的公共前缀
+  const int length        = header_.attr_length;
+  const int prefix_length = min(common_prefix_length(low_fence(), other.high_fence(), length),
+      common_prefix_length(other.low_fence(), high_fence(), length));
+  return min(max, node_capacity(header_, is_leaf(), prefix_length));
+}
+
+int IndexNodeHandler::node_capacity(const IndexFileHeader &header, bool leaf, int prefix_length)
+{
+  const int header_size = leaf ? LeafIndexNode::HEADER_SIZE : InternalIndexNode::HEADER_SIZE;
+  const int value_size  = leaf ? sizeof(RID) : sizeof(PageNum);
+  int       data_size   = static_cast<int>(BP_PAGE_DATA_SIZE) - header_size;
+  if (header.prefix_compression) {
+    data_size -= IndexNodeFences::HEADER_SIZE + 2 * header.attr_length;
+  }
+  return data_size / (header.key_length - prefix_length + value_size);
+}
+
+int IndexNodeHandler::common_prefix_length(const char *key1, const char *key2, int length)
+{
+  if (key1 == nullptr || key2 == nullptr) {
+    return 0;
+  }
+
+  int i = 0;
+  while (i < length && key1[i] == key2[i]) {
+    i++;
+  }
+  return i;
+}
+
+char *IndexNodeHandler::node_array() const
+{
+  return reinterpret_cast<char *>(node_) + (is_leaf() ? LeafIndexNode::HEADER_SIZE : InternalIndexNode::HEADER_SIZE);
+}
+
+int IndexNodeHandler::fences_size() const
+{
+  return prefix_compressed() ? IndexNodeFences::HEADER_SIZE + 2 * header_.attr_length : 0;
+}
+
+int IndexNodeHandler::prefix_length() const
+{
+  if (!prefix_compressed()) {
+    return 0;
+  }
+
+  // 乐观读时可能读到正在修改的数据，不能让它影响访问的内存范围
+  const int prefix_length = fences()->prefix_length;
+  return (prefix_length < 0 || prefix_length > header_.attr_length) ? 0 : prefix_length;
+}
+
+const char *IndexNodeHandler::low_fence() const
+{
+  if (!prefix_compressed() || (fences()->flags & IndexNodeFences::HAS_LOW) == 0) {
+    return nullptr;
+  }
+  return fences()->keys;
+}
+
+const char *IndexNodeHandler::high_fence() const
+{
+  if (!prefix_compressed() || (fences()->flags & IndexNodeFences::HAS_HIGH) == 0) {
+    return nullptr;
+  }
+  return fences()->keys + header_.attr_length;
+}
+
+char *IndexNodeHandler::__item_at(int index) const
+{
+  if (!prefix_compressed()) {
+    return node_array() + (index * item_size());
+  }
+  return slot_at(index, prefix_length());
+}
+
+char *IndexNodeHandler::__value_at(int index) const
+{
+  if (!prefix_compressed()) {
+    return __item_at(index) + key_size();
+  }
+
+  const int prefix_length = this->prefix_length();
+  return slot_at(index, prefix_length) + key_size() - prefix_length;
+}
+
+char *IndexNodeHandler::slot_at(int index, int prefix_length) const
+{
+  // 压缩后元素的大小跟公共前缀的长度有关。乐观读时页面可能正在修改，元素的位置也要限制在页面之内
+  const int slot_size  = item_size() - prefix_length;
+  const int data_size  = static_cast<int>(BP_PAGE_DATA_SIZE - (node_array() - reinterpret_cast<char *>(node_)));
+  int       offset     = fences_size() + index * slot_size;
+  if (offset < 0 || offset > data_size - slot_size) {
+    offset = fences_size();
+  }
+  return node_array() + offset;
+}
+
+char *IndexNodeHandler::__key_at(int index) const
+{
+  const int prefix_length = this->prefix_length();
+  if (prefix_length == 0) {
+    return __item_at(index);
+  }
+
+  key_buffer_.resize(key_size());
+  memcpy(key_buffer_.data(), fences()->keys, prefix_length);
+  memcpy(key_buffer_.data() + prefix_length, slot_at(index, prefix_length), key_size() - prefix_length);
+  return key_buffer_.data();
+}
+
+int IndexNodeHandler::compare_key_at(const KeyComparator &comparator, const char *key, int index) const
+{
+  const int prefix_length = this->prefix_length();
+  if (prefix_length == 0) {
+    return comparator(key, __item_at(index));
+  }
+
+  // 前缀压缩只用于按字节比较的键值，可以分别比较前缀和后缀
+  const int   attr_length = header_.attr_length;
+  const char *suffix      = slot_at(index, prefix_length);
+  int         result    = memcmp(key, fences()->keys, prefix_length);
+  if (result == 0) {
+    result = memcmp(key + prefix_length, suffix, attr_length - prefix_length);
+  }
+  if (result != 0) {
+    return result < 0 ? -1 : 1;
+  }
+  return RID::compare(
+      reinterpret_cast<const RID *>(key + attr_length), reinterpret_cast<const RID *>(suffix + attr_length - prefix_length));
+}
+
+int IndexNodeHandler::lower_bound(const KeyComparator &comparator, const char *key, int first, bool *found) const
+{
+  const int prefix_length = this->prefix_length();
+  const int slot_size     = item_size() - prefix_length;
+
+  int size = this->size();
+  if (prefix_compressed()) {
+    // 与 slot_at 一样，乐观读时不能访问到页面之外
+    size = min(size, node_capacity(header_, is_leaf(), prefix_length));
+  }
+  if (first >= size) {
+    if (found) {
+      *found = false;
+    }
+    return first;
+  }
+
+  char                        *first_slot = prefix_compressed() ? slot_at(first, prefix_length) : __item_at(first);
+  if (prefix_length == 0) {
+    return first + comparator.lower_bound(first_slot, slot_size, size - first, key, found);
+  }
+
+  common::BinaryIterator<char> iter_begin(slot_size, first_slot);
+  common::BinaryIterator<char> iter_end(slot_size, first_slot + (size - first) * slot_size);
+
+  // 节点中所有键值的前缀都相同，先比较一次前缀，前缀不同时可以直接确定位置
+  int result = memcmp(key, fences()->keys, prefix_length);
+  if (result != 0) {
+    if (found) {
+      *found = false;
+    }
+    return result < 0 ? first : size;
+  }
+
+  const int suffix_length = header_.attr_length - prefix_length;
+  auto      suffix_comparator = [suffix_length](const char *slot, const char *key_suffix) {
+    int result = memcmp(slot, key_suffix, suffix_length);
+    if (result != 0) {
+      return result < 0 ? -1 : 1;
+    }
+    return RID::compare(
+        reinterpret_cast<const RID *>(slot + suffix_length), reinterpret_cast<const RID *>(key_suffix + suffix_length));
+  };
+  const char *key_suffix = key + prefix_length;
+  return first +
+         static_cast<int>(common::lower_bound(iter_begin, iter_end, key_suffix, suffix_comparator, found) - iter_begin);
+}
+
+span<const char> IndexNodeHandler::items_at(int index, int num, vector<char> &buffer) const
+{
+  const size_t bytes = static_cast<size_t>(num) * item_size();
+  if (prefix_length() == 0) {
+    return span<const char>(__item_at(index), bytes);
+  }
+
+  buffer.resize(bytes);
+  decode_items(index, num, buffer.data());
+  return span<const char>(buffer.data(), bytes);
+}
+
+void IndexNodeHandler::decode_items(int index, int num, char *dest) const
+{
+  const int   prefix_length = this->prefix_length();
+  const int   item_size     = this->item_size();
+  const int   slot_size     = item_size - prefix_length;
+  const char *slot          = slot_at(index, prefix_length);
+  for (int i = 0; i < num; i++, dest += item_size, slot += slot_size) {
+    memcpy(dest, fences()->keys, prefix_length);
+    memcpy(dest + prefix_length, slot, slot_size);
+  }
+}
+
+void IndexNodeHandler::encode_items(int index, const char *items, int num)
+{
+  const int prefix_length = this->prefix_length();
+  const int item_size     = this->item_size();
+  const int slot_size     = item_size - prefix_length;
+  char     *slot          = slot_at(index, prefix_length);
+  for (int i = 0; i < num; i++, items += item_size, slot += slot_size) {
+    ASSERT(memcmp(items, fences()->keys, prefix_length) == 0,
+           "the key is out of the node's fences. page num=%d", page_num());
+    memcpy(slot, items + prefix_length, slot_size);
+  }
+}
+
+RC IndexNodeHandler::set_fences(const char *low, const char *high)
+{
+  if (!prefix_compressed()) {
+    return RC::SUCCESS;
+  }
+
+  const int    attr_length = header_.attr_length;
+  vector<char> new_fences(fences_size(), 0);
+  auto        *fences      = reinterpret_cast<IndexNodeFences *>(new_fences.data());
+  if (low != nullptr) {
+    fences->flags |= IndexNodeFences::HAS_LOW;
+    memcpy(fences->keys, low, attr_length);
+  }
+  if (high != nullptr) {
+    fences->flags |= IndexNodeFences::HAS_HIGH;
+    memcpy(fences->keys + attr_length, high, attr_length);
+  }
+  fences->prefix_length = common_prefix_length(low, high, attr_length);
+
+  RC rc = mtr_.logger().node_set_fences(
+      *this, span<const char>(new_fences.data(), new_fences.size()), span<const char>(node_array(), fences_size()));
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to log set fences. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  return recover_set_fences(new_fences.data());
+}
+
+RC IndexNodeHandler::recover_set_fences(const char *fences)
+{
+  const int new_prefix_length = reinterpret_cast<const IndexNodeFences *>(fences)->prefix_length;
+  if (new_prefix_length < 0 || new_prefix_length > header_.attr_length ||
+      size() > node_capacity(header_, is_leaf(), new_prefix_length)) {
+    LOG_ERROR("invalid fences. page num=%d, prefix length=%d, size=%d", page_num(), new_prefix_length, size());
+    return RC::INTERNAL;
+  }
+
+  // 公共前缀的长度变化之后，所有元素的位置都会变化，先解压出来再按照新的前缀存放
+  vector<char> items(static_cast<size_t>(size()) * item_size());
+  decode_items(0, size(), items.data());
+  memcpy(node_array(), fences, fences_size());
+  encode_items(0, items.data(), size());
+  return RC::SUCCESS;
+}
 void IndexNodeHandler::increase_size(int n) { node_->key_num += n; }
 
 PageNum IndexNodeHandler::parent_page_num() const { return node_->parent; }
@@ -153,23 +548,51 @@ bool IndexNodeHandler::validate() const
   return true;
 }
 
+bool IndexNodeHandler::validate_fences() const
+{
+  if (!prefix_compressed()) {
+    return true;
+  }
+
+  const int   attr_length = header_.attr_length;
+  const char *low         = low_fence();
+  const char *high        = high_fence();
+  if (fences()->prefix_length != common_prefix_length(low, high, attr_length)) {
+    LOG_WARN("invalid prefix length. page num=%d, prefix length=%d", page_num(), fences()->prefix_length);
+    return false;
+  }
+
+  for (int i = 0; i < size(); i++) {
+    const char *key = __key_at(i);
+    if ((low != nullptr && memcmp(low, key, attr_length) > 0) || (high != nullptr && memcmp(key, high, attr_length) > 0)) {
+      LOG_WARN("key is out of the node's fences. page num=%d, index=%d", page_num(), i);
+      return false;
+    }
+  }
+  return true;
+}
+
 RC IndexNodeHandler::recover_insert_items(int index, const char *items, int num)
 {
-  const int item_size = this->item_size();
+  const int slot_size = this->slot_size();
   if (index < size()) {
-    memmove(__item_at(index + num), __item_at(index), (static_cast<size_t>(size()) - index) * item_size);
+    memmove(__item_at(index) + num * slot_size, __item_at(index), (static_cast<size_t>(size()) - index) * slot_size);
   }
 
-  memcpy(__item_at(index), items, static_cast<size_t>(num) * item_size);
+  if (prefix_length() == 0) {
+    memcpy(__item_at(index), items, static_cast<size_t>(num) * slot_size);
+  } else {
+    encode_items(index, items, num);
+  }
   increase_size(num);
   return RC::SUCCESS;
 }
 
 RC IndexNodeHandler::recover_remove_items(int index, int num)
 {
-  const int item_size = this->item_size();
+  const int slot_size = this->slot_size();
   if (index < size() - num) {
-    memmove(__item_at(index), __item_at(index + num), (static_cast<size_t>(size()) - index - num) * item_size);
+    memmove(__item_at(index), __item_at(index) + num * slot_size, (static_cast<size_t>(size()) - index - num) * slot_size);
   }
 
   increase_size(-num);
@@ -221,11 +644,7 @@ char *LeafIndexNodeHandler::value_at(int index)
 
 int LeafIndexNodeHandler::lookup(const KeyComparator &comparator, const char *key, bool *found /* = nullptr */) const
 {
-  const int                    size = this->size();
-  common::BinaryIterator<char> iter_begin(item_size(), __key_at(0));
-  common::BinaryIterator<char> iter_end(item_size(), __key_at(size));
-  common::BinaryIterator<char> iter = lower_bound(iter_begin, iter_end, key, comparator, found);
-  return iter - iter_begin;
+  return lower_bound(comparator, key, 0, found);
 }
 
 RC LeafIndexNodeHandler::insert(int index, const char *key, const char *value)
@@ -248,7 +667,8 @@ RC LeafIndexNodeHandler::remove(int index)
 {
   assert(index >= 0 && index < size());
 
-  RC rc = mtr_.logger().node_remove_items(*this, index, span<const char>(__item_at(index), item_size()), 1);
+  vector<char> buffer;
+  RC           rc = mtr_.logger().node_remove_items(*this, index, items_at(index, 1, buffer), 1);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log remove item. rc=%s", strrc(rc));
     return rc;
@@ -275,46 +695,65 @@ RC LeafIndexNodeHandler::move_half_to(LeafIndexNodeHandler &other)
   const int move_index    = size / 2;
   const int move_item_num = size - move_index;
 
-  other.append(__item_at(move_index), move_item_num);
+  vector<char>     buffer;
+  span<const char> items = items_at(move_index, move_item_num, buffer);
 
-  RC rc = mtr_.logger().node_remove_items(*this,
-      move_index,
-      span<const char>(__item_at(move_index), static_cast<size_t>(move_item_num) * item_size()),
-      move_item_num);
+  // 拆分后两个节点以新节点的第一个键值为界。范围变小了，公共前缀不会变短，元素一定放得下
+  other.set_fences(items.data(), this->high_fence());
+  other.append(items.data(), move_item_num);
+
+  RC rc = mtr_.logger().node_remove_items(*this, move_index, items, move_item_num);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log shrink leaf node. rc=%s", strrc(rc));
     return rc;
   }
 
   recover_remove_items(move_index, move_item_num);
-  return RC::SUCCESS;
+  return set_fences(this->low_fence(), items.data());
 }
 RC LeafIndexNodeHandler::move_first_to_end(LeafIndexNodeHandler &other)
 {
-  other.append(__item_at(0));
+  // 移动之后，两个节点的分界变成当前节点的第二个键值
+  vector<char>     buffer;
+  span<const char> items = items_at(0, 2, buffer);
+  vector<char>     separator(items.data() + item_size(), items.data() + item_size() + header_.attr_length);
+
+  other.set_fences(other.low_fence(), separator.data());
+  other.append(items.data());
 
-  return this->remove(0);
+  RC rc = this->remove(0);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  return set_fences(separator.data(), this->high_fence());
 }
 
 RC LeafIndexNodeHandler::move_last_to_front(LeafIndexNodeHandler &other)
 {
-  other.preappend(__item_at(size() - 1));
+  // 移动之后，两个节点的分界变成移动的这个键值
+  vector<char>     buffer;
+  span<const char> item = items_at(size() - 1, 1, buffer);
+  vector<char>     separator(item.data(), item.data() + header_.attr_length);
+
+  other.set_fences(separator.data(), other.high_fence());
+  other.preappend(item.data());
 
   this->remove(size() - 1);
-  return RC::SUCCESS;
+  return set_fences(this->low_fence(), separator.data());
 }
 /**
  * move all items to left page
  */
 RC LeafIndexNodeHandler::move_to(LeafIndexNodeHandler &other)
 {
-  other.append(__item_at(0), this->size());
+  vector<char>     buffer;
+  span<const char> items = items_at(0, this->size(), buffer);
+
+  other.set_fences(other.low_fence(), this->high_fence());
+  other.append(items.data(), this->size());
   other.set_next_page(this->next_page());
 
-  RC rc = mtr_.logger().node_remove_items(*this,
-      0,
-      span<const char>(__item_at(0), static_cast<size_t>(this->size()) * static_cast<size_t>(item_size())),
-      this->size());
+  RC rc = mtr_.logger().node_remove_items(*this, 0, items, this->size());
 
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log shrink leaf node. rc=%s", strrc(rc));
@@ -341,7 +780,7 @@ RC LeafIndexNodeHandler::append(const char *item) { return append(item, 1); }
 
 RC LeafIndexNodeHandler::preappend(const char *item) { return insert(0, item, item + key_size()); }
 
-char *LeafIndexNodeHandler::__item_at(int index) const { return leaf_node_->array + (index * item_size()); }
+int LeafIndexNodeHandler::value_size() const { return sizeof(RID); }
 
 string to_string(const LeafIndexNodeHandler &handler, const KeyPrinter &printer)
 {
@@ -364,13 +803,19 @@ bool LeafIndexNodeHandler::validate(const KeyComparator &comparator, DiskBufferP
 
   const int node_size = size();
   for (int i = 1; i < node_size; i++) {
-    if (comparator(__key_at(i - 1), __key_at(i)) >= 0) {
+    const char  *key = __key_at(i - 1);
+    vector<char> prev_key(key, key + key_size());
+    if (compare_key_at(comparator, prev_key.data(), i) >= 0) {
       LOG_WARN("page number = %d, invalid key order. id1=%d,id2=%d, this=%s",
                page_num(), i - 1, i, to_string(*this).c_str());
       return false;
     }
   }
 
+  if (!validate_fences()) {
+    return false;
+  }
+
   PageNum parent_page_num = this->parent_page_num();
   if (parent_page_num == BP_INVALID_PAGE_NUM) {
     return true;
@@ -453,7 +898,7 @@ RC InternalIndexNodeHandler::create_new_root(PageNum first_page_num, const char
     LOG_WARN("failed to log create new root. rc=%s", strrc(rc));
   }
 
-  memset(__key_at(0), 0, key_size());
+  memset(__item_at(0), 0, key_size());
   memcpy(__value_at(0), &first_page_num, value_size());
   memcpy(__item_at(1), key, key_size());
   memcpy(__value_at(1), &page_num, value_size());
@@ -492,16 +937,21 @@ RC InternalIndexNodeHandler::move_half_to(InternalIndexNodeHandler &other)
   const int size       = this->size();
   const int move_index = size / 2;
   const int move_num   = size - move_index;
-  RC        rc         = other.append(this->__item_at(move_index), size - move_index);
+
+  vector<char>     buffer;
+  span<const char> items = items_at(move_index, move_num, buffer);
+
+  // 新节点的第一个键值会插入到父节点中，作为两个节点的分界
+  other.set_fences(items.data(), this->high_fence());
+  RC rc = other.append(items.data(), move_num);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to copy item to new node. rc=%d:%s", rc, strrc(rc));
     return rc;
   }
 
-  mtr_.logger().node_remove_items(
-      *this, move_index, span<const char>(__item_at(move_index), move_num * item_size()), move_num);
+  mtr_.logger().node_remove_items(*this, move_index, items, move_num);
   increase_size(-(size - move_index));
-  return rc;
+  return set_fences(this->low_fence(), items.data());
 }
 
 /**
@@ -523,15 +973,12 @@ int InternalIndexNodeHandler::lookup(const KeyComparator &comparator, const char
     return 0;
   }
 
-  common::BinaryIterator<char> iter_begin(item_size(), __key_at(1));
-  common::BinaryIterator<char> iter_end(item_size(), __key_at(size));
-  common::BinaryIterator<char> iter = lower_bound(iter_begin, iter_end, key, comparator, found);
-  int                          ret  = static_cast<int>(iter - iter_begin) + 1;
+  const int ret = lower_bound(comparator, key, 1, found);
   if (insert_position) {
     *insert_position = ret;
   }
 
-  if (ret >= size || comparator(key, __key_at(ret)) < 0) {
+  if (ret >= size || compare_key_at(comparator, key, ret) < 0) {
     return ret - 1;
   }
   return ret;
@@ -549,7 +996,11 @@ void InternalIndexNodeHandler::set_key_at(int index, const char *key)
 
   mtr_.logger().internal_update_key(
       *this, index, span<const char>(key, key_size()), span<const char>(__key_at(index), key_size()));
-  memcpy(__key_at(index), key, key_size());
+
+  // 新的键值在父节点给这个节点划定的范围内，一定有相同的公共前缀
+  const int prefix_length = this->prefix_length();
+  ASSERT(memcmp(key, fences()->keys, prefix_length) == 0, "the key is out of the node's fences. page num=%d", page_num());
+  memcpy(__item_at(index), key + prefix_length, key_size() - prefix_length);
 }
 
 PageNum InternalIndexNodeHandler::value_at(int index)
@@ -573,7 +1024,8 @@ void InternalIndexNodeHandler::remove(int index)
   assert(index >= 0 && index < size());
 
   BplusTreeLogger &logger = mtr_.logger();
-  RC               rc     = logger.node_remove_items(*this, index, span<const char>(__item_at(index), item_size()), 1);
+  vector<char>     buffer;
+  RC               rc = logger.node_remove_items(*this, index, items_at(index, 1, buffer), 1);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log remove item. rc=%s. node=%s", strrc(rc), to_string(*this).c_str());
   }
@@ -583,13 +1035,17 @@ void InternalIndexNodeHandler::remove(int index)
 
 RC InternalIndexNodeHandler::move_to(InternalIndexNodeHandler &other)
 {
-  RC rc = other.append(__item_at(0), size());
+  vector<char>     buffer;
+  span<const char> items = items_at(0, size(), buffer);
+
+  other.set_fences(other.low_fence(), this->high_fence());
+  RC rc = other.append(items.data(), size());
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to copy items to other node. rc=%d:%s", rc, strrc(rc));
     return rc;
   }
 
-  rc = mtr_.logger().node_remove_items(*this, 0, span<const char>(__item_at(0), size() * item_size()), size());
+  rc = mtr_.logger().node_remove_items(*this, 0, items, size());
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log shrink internal node. rc=%d:%s", rc, strrc(rc));
     return rc;
@@ -600,31 +1056,42 @@ RC InternalIndexNodeHandler::move_to(InternalIndexNodeHandler &other)
 
 RC InternalIndexNodeHandler::move_first_to_end(InternalIndexNodeHandler &other)
 {
-  RC rc = other.append(__item_at(0));
+  // 移动之后，当前节点的第二个键值成为第一个键值，也是父节点中两个节点的分界
+  vector<char>     buffer;
+  span<const char> items = items_at(0, 2, buffer);
+  vector<char>     separator(items.data() + item_size(), items.data() + item_size() + header_.attr_length);
+
+  other.set_fences(other.low_fence(), separator.data());
+  RC rc = other.append(items.data());
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to append item to others.");
     return rc;
   }
 
   remove(0);
-  return rc;
+  return set_fences(separator.data(), this->high_fence());
 }
 
 RC InternalIndexNodeHandler::move_last_to_front(InternalIndexNodeHandler &other)
 {
-  RC rc = other.preappend(__item_at(size() - 1));
+  vector<char>     buffer;
+  span<const char> item = items_at(size() - 1, 1, buffer);
+  vector<char>     separator(item.data(), item.data() + header_.attr_length);
+
+  other.set_fences(separator.data(), other.high_fence());
+  RC rc = other.preappend(item.data());
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to preappend to others");
     return rc;
   }
 
-  rc = mtr_.logger().node_remove_items(*this, size() - 1, span<const char>(__item_at(size() - 1), item_size()), 1);
+  rc = mtr_.logger().node_remove_items(*this, size() - 1, item, 1);
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to log shrink internal node. rc=%d:%s", rc, strrc(rc));
     return rc;
   }
   increase_size(-1);
-  return rc;
+  return set_fences(this->low_fence(), separator.data());
 }
 
 RC InternalIndexNodeHandler::insert_items(int index, const char *items, int num)
@@ -669,8 +1136,6 @@ RC InternalIndexNodeHandler::append(const char *item) { return this->append(item
 
 RC InternalIndexNodeHandler::preappend(const char *item) { return this->insert_items(0, item, 1); }
 
-char *InternalIndexNodeHandler::__item_at(int index) const { return internal_node_->array + (index * item_size()); }
-
 int InternalIndexNodeHandler::value_size() const { return sizeof(PageNum); }
 
 int InternalIndexNodeHandler::item_size() const { return key_size() + this->value_size(); }
@@ -684,13 +1149,19 @@ bool InternalIndexNodeHandler::validate(const KeyComparator &comparator, DiskBuf
 
   const int node_size = size();
   for (int i = 2; i < node_size; i++) {
-    if (comparator(__key_at(i - 1), __key_at(i)) >= 0) {
+    const char  *key = __key_at(i - 1);
+    vector<char> prev_key(key, key + key_size());
+    if (compare_key_at(comparator, prev_key.data(), i) >= 0) {
       LOG_WARN("page number = %d, invalid key order. id1=%d,id2=%d, this=%s",
           page_num(), i - 1, i, to_string(*this).c_str());
       return false;
     }
   }
 
+  if (!validate_fences()) {
+    return false;
+  }
+
   for (int i = 0; result && i < node_size; i++) {
     PageNum page_num = *(PageNum *)__value_at(i);
     if (page_num < 0) {
@@ -788,7 +1259,8 @@ RC BplusTreeHandler::sync()
 }
 
 RC BplusTreeHandler::create(LogHandler &log_handler, BufferPoolManager &bpm, const char *file_name, AttrType attr_type,
-    int attr_length, int internal_max_size /* = -1*/, int leaf_max_size /* = -1 */)
+    int attr_length, int internal_max_size /* = -1*/, int leaf_max_size /* = -1 */,
+    bool prefix_compression /* = false */)
 {
   RC rc = bpm.create_file(file_name);
   if (OB_FAIL(rc)) {
@@ -806,7 +1278,7 @@ RC BplusTreeHandler::create(LogHandler &log_handler, BufferPoolManager &bpm, con
   }
   LOG_INFO("Successfully open index file %s.", file_name);
 
-  rc = this->create(log_handler, *bp, attr_type, attr_length, internal_max_size, leaf_max_size);
+  rc = this->create(log_handler, *bp, attr_type, attr_length, internal_max_size, leaf_max_size, prefix_compression);
   if (OB_FAIL(rc)) {
     bpm.close_file(file_name);
     return rc;
@@ -817,13 +1289,19 @@ RC BplusTreeHandler::create(LogHandler &log_handler, BufferPoolManager &bpm, con
 }
 
 RC BplusTreeHandler::create(LogHandler &log_handler, DiskBufferPool &buffer_pool, AttrType attr_type, int attr_length,
-    int internal_max_size /* = -1 */, int leaf_max_size /* = -1 */)
+    int internal_max_size /* = -1 */, int leaf_max_size /* = -1 */, bool prefix_compression /* = false */)
 {
+  // 前缀压缩要求键值按照字节比较，其它类型的大小顺序与字节顺序不一致
+  if (prefix_compression && attr_type != AttrType::CHARS) {
+    LOG_INFO("prefix compression is only supported for chars keys. attr type=%s", attr_type_to_string(attr_type));
+    prefix_compression = false;
+  }
+
   if (internal_max_size < 0) {
-    internal_max_size = calc_internal_page_capacity(attr_length);
+    internal_max_size = calc_internal_page_capacity(attr_length, prefix_compression);
   }
   if (leaf_max_size < 0) {
-    leaf_max_size = calc_leaf_page_capacity(attr_length);
+    leaf_max_size = calc_leaf_page_capacity(attr_length, prefix_compression);
   }
 
   log_handler_      = &log_handler;
@@ -855,6 +1333,7 @@ RC BplusTreeHandler::create(LogHandler &log_handler, DiskBufferPool &buffer_pool
   file_header->internal_max_size = internal_max_size;
   file_header->leaf_max_size     = leaf_max_size;
   file_header->root_page         = BP_INVALID_PAGE_NUM;
+  file_header->prefix_compression = prefix_compression ? 1 : 0;
 
   // 取消记录日志的原因请参考下面的sync调用的地方。
   // mtr.logger().init_header_page(header_frame, *file_header);
@@ -1222,6 +1701,68 @@ RC BplusTreeHandler::find_leaf_internal(BplusTreeMiniTransaction &mtr, BplusTree
   return RC::SUCCESS;
 }
 
+RC BplusTreeHandler::optimistic_find_leaf(
+    BplusTreeMiniTransaction &mtr, const char *key, Frame *&frame, uint64_t &version)
+{
+  LatchMemo &latch_memo = mtr.latch_memo();
+
+  const PageNum root_page = root_page_num();
+  if (root_page == BP_INVALID_PAGE_NUM) {
+    return RC::EMPTY;
+  }
+
+  RC rc = latch_memo.get_page(root_page, frame);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to fetch root page. page id=%d, rc=%s", root_page, strrc(rc));
+    return rc;
+  }
+
+  // 拿到版本号之后根节点没有变化，才能从这个节点开始查找。之后再修改根节点，一定会修改这个节点的版本号
+  version = frame->version();
+  if (Frame::is_write_latched(version) || root_page_num() != root_page) {
+    return RC::LOCKED_NEED_WAIT;
+  }
+
+  while (true) {
+    IndexNodeHandler node(mtr, file_header_, frame);
+    const bool       is_leaf  = node.is_leaf();
+    const int        size     = node.size();
+    const int        max_size = is_leaf ? file_header_.leaf_max_size : file_header_.internal_max_size;
+    // 读到的数据可能是正在修改的，不能直接使用
+    if (size < 0 || size > max_size || !frame->validate_version(version)) {
+      return RC::LOCKED_NEED_WAIT;
+    }
+
+    if (is_leaf) {
+      return RC::SUCCESS;
+    }
+
+    InternalIndexNodeHandler internal_node(mtr, file_header_, frame);
+    const int     index          = (key == nullptr) ? 0 : internal_node.lookup(key_comparator_, key);
+    const PageNum child_page_num = internal_node.value_at(index);
+    if (!frame->validate_version(version)) {
+      return RC::LOCKED_NEED_WAIT;
+    }
+
+    Frame         *parent_frame   = frame;
+    const uint64_t parent_version = version;
+    const int      memo_point     = latch_memo.memo_point();
+    rc = latch_memo.get_page(child_page_num, frame);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to fetch page. page num=%d, rc=%s", child_page_num, strrc(rc));
+      return rc;
+    }
+
+    // 子节点的版本号必须在父节点还指向它的时候获取
+    version = frame->version();
+    if (Frame::is_write_latched(version) || !parent_frame->validate_version(parent_version)) {
+      return RC::LOCKED_NEED_WAIT;
+    }
+
+    latch_memo.release_to(memo_point);  // 父节点已经用不到了，释放它的pin
+  }
+}
+
 RC BplusTreeHandler::crabing_protocal_fetch_page(
     BplusTreeMiniTransaction &mtr, BplusTreeOperationType op, PageNum page_num, bool is_root_node, Frame *&frame)
 {
@@ -1273,7 +1814,8 @@ RC BplusTreeHandler::insert_entry_into_leaf_node(
   new_index_node.set_parent_page_num(leaf_node.parent_page_num());
   leaf_node.set_next_page(new_frame->page_num());
 
-  if (insert_position < leaf_node.size()) {
+  // 插入到两个节点的分界处时放到左边的节点中，新节点的第一个键值仍然是拆分时的分界，与新节点的下界一致
+  if (insert_position <= leaf_node.size()) {
     leaf_node.insert(insert_position, key, (const char *)rid);
   } else {
     new_index_node.insert(insert_position - leaf_node.size(), key, (const char *)rid);
@@ -1438,8 +1980,9 @@ void BplusTreeHandler::update_root_page_num_locked(BplusTreeMiniTransaction &mtr
   IndexFileHeader *file_header = reinterpret_cast<IndexFileHeader *>(frame->data());
   mtr.logger().update_root_page(frame, root_page_num, file_header->root_page);
   file_header->root_page = root_page_num;
-  file_header_.root_page = root_page_num;
-  header_dirty_          = true;
+  // 乐观读的读者不加锁读取根节点页号
+  atomic_ref<PageNum>(file_header_.root_page).store(root_page_num, memory_order_release);
+  header_dirty_ = true;
   frame->mark_dirty();
   LOG_DEBUG("set root page to %d", root_page_num);
 }
@@ -1650,7 +2193,7 @@ RC BplusTreeHandler::coalesce_or_redistribute(BplusTreeMiniTransaction &mtr, Fra
   latch_memo.xlatch(neighbor_frame);
 
   IndexNodeHandlerType neighbor_node(mtr, file_header_, neighbor_frame);
-  if (index_node.size() + neighbor_node.size() > index_node.max_size()) {
+  if (index_node.size() + neighbor_node.size() > index_node.max_size_after_merge(neighbor_node)) {
     rc = redistribute<IndexNodeHandlerType>(mtr, neighbor_frame, frame, parent_frame, index);
   } else {
     rc = coalesce<IndexNodeHandlerType>(mtr, neighbor_frame, frame, parent_frame, index);
@@ -1813,7 +2356,7 @@ BplusTreeScanner::BplusTreeScanner(BplusTreeHandler &tree_handler) : tree_handle
 BplusTreeScanner::~BplusTreeScanner() { close(); }
 
 RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inclusive, const char *right_user_key,
-    int right_len, bool right_inclusive)
+    int right_len, bool right_inclusive, bool fetch_key)
 {
 
   RC rc = RC::SUCCESS;
@@ -1822,10 +2365,12 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
     return RC::INTERNAL;
   }
 
-  inited_        = true;
-  first_emitted_ = false;
-
-  LatchMemo &latch_memo = mtr_.latch_memo();
+  inited_    = true;
+  reach_end_ = false;
+  fetch_key_ = fetch_key;
+  rids_.clear();
+  user_keys_.clear();
+  rid_index_ = 0;
 
   // 校验输入的键值是否是合法范围
   if (left_user_key && right_user_key) {
@@ -1839,18 +2384,7 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
   }
 
   if (nullptr == left_user_key) {
-    rc = tree_handler_.left_most_page(mtr_, current_frame_);
-    if (OB_FAIL(rc)) {
-      if (rc == RC::EMPTY) {
-        current_frame_ = nullptr;
-        return RC::SUCCESS;
-      }
-
-      LOG_WARN("failed to find left most page. rc=%s", strrc(rc));
-      return rc;
-    }
-
-    iter_index_ = 0;
+    resume_key_.clear();
   } else {
 
     char *fixed_left_key = const_cast<char *>(left_user_key);
@@ -1868,6 +2402,7 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
       }
     }
 
+    // 左边界使用最小或最大的RID，树中不会有相同的键值，查找到的位置刚好是第一个在范围内的数据
     MemPoolItem::item_unique_ptr left_pkey;
     if (left_inclusive) {
       left_pkey = tree_handler_.make_key(fixed_left_key, *RID::min());
@@ -1876,44 +2411,13 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
     }
 
     const char *left_key = (const char *)left_pkey.get();
+    resume_key_.assign(left_key, left_key + tree_handler_.file_header_.key_length);
+    resume_inclusive_ = true;
 
     if (fixed_left_key != left_user_key) {
       delete[] fixed_left_key;
       fixed_left_key = nullptr;
     }
-
-    rc = tree_handler_.find_leaf(mtr_, BplusTreeOperationType::READ, left_key, current_frame_);
-
-    if (rc == RC::EMPTY) {
-      rc             = RC::SUCCESS;
-      current_frame_ = nullptr;
-      return rc;
-    } else if (OB_FAIL(rc)) {
-      LOG_WARN("failed to find left page. rc=%s", strrc(rc));
-      return rc;
-    }
-
-    LeafIndexNodeHandler left_node(mtr_, tree_handler_.file_header_, current_frame_);
-    int                  left_index = left_node.lookup(tree_handler_.key_comparator_, left_key);
-    // lookup 返回的是适合插入的位置，还需要判断一下是否在合适的边界范围内
-    if (left_index >= left_node.size()) {  // 超出了当前页，就需要向后移动一个位置
-      const PageNum next_page_num = left_node.next_page();
-      if (next_page_num == BP_INVALID_PAGE_NUM) {  // 这里已经是最后一页，说明当前扫描，没有数据
-        latch_memo.release();
-        current_frame_ = nullptr;
-        return RC::SUCCESS;
-      }
-
-      rc = latch_memo.get_page(next_page_num, current_frame_);
-      if (OB_FAIL(rc)) {
-        LOG_WARN("failed to fetch next page. page num=%d, rc=%s", next_page_num, strrc(rc));
-        return rc;
-      }
-      latch_memo.slatch(current_frame_);
-
-      left_index = 0;
-    }
-    iter_index_ = left_index;
   }
 
   // 没有指定右边界范围，那么就返回右边界最大值
@@ -1947,89 +2451,188 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
     }
   }
 
-  if (touch_end()) {
-    current_frame_ = nullptr;
+  rc = fetch_leaf_by_key();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to find left page. rc=%s", strrc(rc));
+    return rc;
   }
-
   return RC::SUCCESS;
 }
 
-void BplusTreeScanner::fetch_item(RID &rid)
+RC BplusTreeScanner::fetch_leaf_by_key()
 {
-  LeafIndexNodeHandler node(mtr_, tree_handler_.file_header_, current_frame_);
-  memcpy(&rid, node.value_at(iter_index_), sizeof(rid));
-}
+  LatchMemo  &latch_memo = mtr_.latch_memo();
+  const char *key        = resume_key_.empty() ? nullptr : resume_key_.data();
 
-bool BplusTreeScanner::touch_end()
-{
-  if (right_key_ == nullptr) {
-    return false;
+  RC rc = RC::SUCCESS;
+  for (int i = 0; i < MAX_OPTIMISTIC_RETRY; i++) {
+    Frame   *frame   = nullptr;
+    uint64_t version = 0;
+    rc = tree_handler_.optimistic_find_leaf(mtr_, key, frame, version);
+    if (OB_SUCC(rc)) {
+      rc = copy_leaf(frame, version, true /*optimistic*/, true /*from_resume_key*/);
+    }
+    latch_memo.release();
+
+    if (rc != RC::LOCKED_NEED_WAIT) {
+      break;
+    }
+    this_thread::yield();
   }
 
-  LeafIndexNodeHandler node(mtr_, tree_handler_.file_header_, current_frame_);
+  if (rc == RC::LOCKED_NEED_WAIT) {
+    // 乐观读一直失败，说明这部分数据修改得很频繁，改成加读锁查找
+    Frame *frame = nullptr;
+    if (nullptr == key) {
+      rc = tree_handler_.left_most_page(mtr_, frame);
+    } else {
+      rc = tree_handler_.find_leaf(mtr_, BplusTreeOperationType::READ, key, frame);
+    }
+    if (OB_SUCC(rc)) {
+      rc = copy_leaf(frame, frame->version(), false /*optimistic*/, true /*from_resume_key*/);
+    }
+    latch_memo.release();
+  }
 
-  const char *this_key       = node.key_at(iter_index_);
-  int         compare_result = tree_handler_.key_comparator_(this_key, static_cast<char *>(right_key_.get()));
-  return compare_result > 0;
+  if (rc == RC::EMPTY) {
+    reach_end_ = true;
+    rc         = RC::SUCCESS;
+  }
+  return rc;
 }
 
-RC BplusTreeScanner::next_entry(RID &rid)
+RC BplusTreeScanner::fetch_next_leaf()
 {
-  if (nullptr == current_frame_) {
-    return RC::RECORD_EOF;
+  LatchMemo &latch_memo = mtr_.latch_memo();
+
+  // 上一个叶子节点没有变化时，它的next指针一定指向下一个叶子节点。
+  // 下一个节点的版本号需要在确认这一点的同时获取
+  Frame *leaf_frame = nullptr;
+  Frame *next_frame = nullptr;
+  RC     rc         = latch_memo.get_page(leaf_page_, leaf_frame);
+  if (OB_SUCC(rc) && leaf_frame->validate_version(leaf_version_)) {
+    rc = latch_memo.get_page(next_page_, next_frame);
+    if (OB_SUCC(rc)) {
+      const uint64_t next_version = next_frame->version();
+      if (!Frame::is_write_latched(next_version) && leaf_frame->validate_version(leaf_version_)) {
+        rc = copy_leaf(next_frame, next_version, true /*optimistic*/, false /*from_resume_key*/);
+      } else {
+        rc = RC::LOCKED_NEED_WAIT;
+      }
+    }
+  } else if (OB_SUCC(rc)) {
+    rc = RC::LOCKED_NEED_WAIT;
   }
+  latch_memo.release();
 
-  if (!first_emitted_) {
-    fetch_item(rid);
-    first_emitted_ = true;
-    return RC::SUCCESS;
+  if (rc == RC::LOCKED_NEED_WAIT) {
+    return fetch_leaf_by_key();
   }
+  return rc;
+}
 
-  iter_index_++;
+RC BplusTreeScanner::copy_leaf(Frame *frame, uint64_t version, bool optimistic, bool from_resume_key)
+{
+  const IndexFileHeader &file_header = tree_handler_.file_header_;
+  const KeyComparator   &comparator  = tree_handler_.key_comparator_;
 
-  LeafIndexNodeHandler node(mtr_, tree_handler_.file_header_, current_frame_);
-  if (iter_index_ < node.size()) {
-    if (touch_end()) {
-      return RC::RECORD_EOF;
+  // 乐观读时读到的可能是正在修改的数据，必须先检查，不能越界访问
+  LeafIndexNodeHandler node(mtr_, file_header, frame);
+  const int            size = node.size();
+  if (!node.is_leaf() || size < 0 || size > file_header.leaf_max_size) {
+    if (optimistic) {
+      return RC::LOCKED_NEED_WAIT;
     }
-
-    fetch_item(rid);
-    return RC::SUCCESS;
+    LOG_ERROR("invalid leaf node. page num=%d, size=%d", frame->page_num(), size);
+    return RC::INTERNAL;
   }
 
-  RC      rc            = RC::SUCCESS;
-  PageNum next_page_num = node.next_page();
-  if (BP_INVALID_PAGE_NUM == next_page_num) {
-    return RC::RECORD_EOF;
+  int index = 0;
+  if (from_resume_key && !resume_key_.empty()) {
+    bool found = false;
+    index      = node.lookup(comparator, resume_key_.data(), &found);
+    if (found && !resume_inclusive_) {
+      index++;
+    }
   }
 
-  LatchMemo &latch_memo = mtr_.latch_memo();
+  rids_.clear();
+  user_keys_.clear();
+  rid_index_ = 0;
 
-  const int memo_point = latch_memo.memo_point();
-  rc                   = latch_memo.get_page(next_page_num, current_frame_);
-  if (OB_FAIL(rc)) {
-    LOG_WARN("failed to get next page. page num=%d, rc=%s", next_page_num, strrc(rc));
-    return rc;
+  const int attr_length = file_header.attr_length;
+  bool      reach_end   = false;
+  for (; index < size; index++) {
+    if (right_key_ != nullptr && node.compare_key_at(comparator, static_cast<const char *>(right_key_.get()), index) < 0) {
+      reach_end = true;
+      break;
+    }
+    rids_.push_back(*reinterpret_cast<const RID *>(node.__value_at(index)));
+    if (fetch_key_) {
+      const char *key = node.__key_at(index);
+      user_keys_.insert(user_keys_.end(), key, key + attr_length);
+    }
   }
 
-  /**
-   * 如果这里直接去加锁，那可能会造成死锁
-   * 因为这里访问页面的方式顺序与插入、删除的顺序不一样
-   * 如果加锁失败，就由上层做重试
-   */
-  bool locked = latch_memo.try_slatch(current_frame_);
-  if (!locked) {
+  const PageNum next_page = node.next_page();
+  if (!rids_.empty()) {
+    const char *last_key = node.__key_at(index - 1);
+    key_buffer_.assign(last_key, last_key + file_header.key_length);
+  }
+
+  if (optimistic && !frame->validate_version(version)) {
+    rids_.clear();
+    user_keys_.clear();
     return RC::LOCKED_NEED_WAIT;
   }
 
-  latch_memo.release_to(memo_point);
-  iter_index_ = -1;  // `next` will add 1
-  return next_entry(rid);
+  if (!rids_.empty()) {
+    resume_key_.swap(key_buffer_);
+    resume_inclusive_ = false;
+  }
+  leaf_page_    = frame->page_num();
+  leaf_version_ = version;
+  next_page_    = next_page;
+  reach_end_    = reach_end || next_page == BP_INVALID_PAGE_NUM;
+  return RC::SUCCESS;
+}
+
+RC BplusTreeScanner::next_entry(RID &rid)
+{
+  while (rid_index_ >= rids_.size()) {
+    if (reach_end_) {
+      return RC::RECORD_EOF;
+    }
+
+    RC rc = fetch_next_leaf();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to fetch next leaf. page num=%d, rc=%s", next_page_, strrc(rc));
+      return rc;
+    }
+  }
+
+  rid = rids_[rid_index_++];
+  return RC::SUCCESS;
+}
+
+RC BplusTreeScanner::next_entry(RID &rid, const char *&user_key)
+{
+  ASSERT(fetch_key_, "the scanner is not opened with fetch_key");
+
+  RC rc = next_entry(rid);
+  if (OB_SUCC(rc)) {
+    user_key = user_keys_.data() + (rid_index_ - 1) * tree_handler_.file_header_.attr_length;
+  }
+  return rc;
 }
 
 RC BplusTreeScanner::close()
 {
-  inited_ = false;
+  inited_    = false;
+  reach_end_ = true;
+  rids_.clear();
+  user_keys_.clear();
+  rid_index_ = 0;
   LOG_TRACE("bplus tree scanner closed");
   return RC::SUCCESS;
 }
@@ -23,6 +23,9 @@ See the Mulan PSL v2 for more details. */
 #include "common/lang/memory.h"
 #include "common/lang/sstream.h"
 #include "common/lang/functional.h"
+#include "common/lang/vector.h"
+#include "common/lang/span.h"
+#include "common/lang/atomic.h"
 #include "common/log/log.h"
 #include "sql/parser/parse_defs.h"
 #include "storage/buffer/disk_buffer_pool.h"
@@ -86,6 +89,19 @@ private:
   int      attr_length_;
 };
 
+/**
+ * @brief 节点内查找键值的方式
+ * @ingroup BPlusTree
+ * @details 通用的比较器每次比较都要构造 Value，再通过类型的虚函数比较。
+ * 整数、日期和浮点数类型的键值都是4个字节的数值，可以直接按照数值比较，开启 USE_SIMD 时一次比较8个键值。
+ */
+enum class KeySearchMode
+{
+  GENERIC,  ///< 使用比较器逐个比较
+  INT32,    ///< 整数和日期
+  FLOAT32,  ///< 浮点数。与 compare_float 一样，相差不超过 EPSILON 时认为相等
+};
+
 /**
  * @brief 键值比较(BplusTree)
  * @details BplusTree的键值除了字段属性，还有RID，是为了避免属性值重复而增加的。
@@ -94,10 +110,33 @@ private:
 class KeyComparator
 {
 public:
-  void init(AttrType type, int length) { attr_comparator_.init(type, length); }
+  void init(AttrType type, int length)
+  {
+    attr_comparator_.init(type, length);
+
+    search_mode_ = KeySearchMode::GENERIC;
+    if (length == static_cast<int>(sizeof(int32_t))) {
+      if (type == AttrType::INTS || type == AttrType::DATES) {
+        search_mode_ = KeySearchMode::INT32;
+      } else if (type == AttrType::FLOATS) {
+        search_mode_ = KeySearchMode::FLOAT32;
+      }
+    }
+  }
 
   const AttrComparator &attr_comparator() const { return attr_comparator_; }
 
+  /// @brief 节点内查找键值的方式，打开索引时根据键值的类型确定
+  KeySearchMode search_mode() const { return search_mode_; }
+
+  /**
+   * @brief 在有序的键值中查找第一个不小于 key 的位置
+   * @details 数值类型的键值先找到属性值与 key 相等的范围，范围内的键值只需要再比较RID。
+   * @param items 第 i 个键值存放在 items + i * item_size 的位置
+   * @param[out] found 是否找到了相等的键值
+   */
+  int lower_bound(const char *items, int item_size, int size, const char *key, bool *found = nullptr) const;
+
   int operator()(const char *v1, const char *v2) const
   {
     int result = attr_comparator_(v1, v2);
@@ -112,6 +151,7 @@ public:
 
 private:
   AttrComparator attr_comparator_;
+  KeySearchMode  search_mode_ = KeySearchMode::GENERIC;
 };
 
 /**
@@ -184,6 +224,7 @@ struct IndexFileHeader
   int32_t  attr_length;        ///< 键值的长度
   int32_t  key_length;         ///< attr length + sizeof(RID)
   AttrType attr_type;          ///< 键值的类型
+  int32_t  prefix_compression; ///< 是否开启键值前缀压缩。只有按字节比较的 CHARS 类型(包括多字段索引)支持
 
   const string to_string() const
   {
@@ -191,7 +232,8 @@ struct IndexFileHeader
 
     ss << "attr_length:" << attr_length << "," << "key_length:" << key_length << ","
        << "attr_type:" << attr_type_to_string(attr_type) << "," << "root_page:" << root_page << ","
-       << "internal_max_size:" << internal_max_size << "," << "leaf_max_size:" << leaf_max_size << ";";
+       << "internal_max_size:" << internal_max_size << "," << "leaf_max_size:" << leaf_max_size << ","
+       << "prefix_compression:" << prefix_compression << ";";
 
     return ss.str();
   }
@@ -259,6 +301,31 @@ struct InternalIndexNode : public IndexNode
   char array[0];
 };
 
+/**
+ * @brief 前缀压缩节点的键值范围
+ * @ingroup BPlusTree
+ * @code
+ * storage format:
+ * | common header | flags | prefix length | low fence | high fence |
+ * | suffix(0), value(0) | suffix(1), value(1) | ... | suffix(n), value(n) |
+ * @endcode
+ * 开启前缀压缩后，叶子节点和内部节点的数据区(array)先存放这个结构，然后才是各个元素。
+ * 下界(low fence)和上界(high fence)是这个节点在父节点中的分隔键值(只包含用户键值部分)，
+ * 所有能够路由到这个节点的键值都在这个范围内，所以它们一定有公共前缀，即上下界的公共前缀。
+ * 公共前缀只存放一次(就是下界的前 prefix length 个字节)，元素中只存放键值去掉前缀之后的部分。
+ * 插入的键值一定在节点的范围内，不会让前缀变短；只有分裂、合并和重新分配会修改节点的范围。
+ */
+struct IndexNodeFences
+{
+  static constexpr int HEADER_SIZE = 8;
+  static constexpr int HAS_LOW     = 1;  ///< 有下界，否则是负无穷
+  static constexpr int HAS_HIGH    = 2;  ///< 有上界，否则是正无穷
+
+  int32_t flags;
+  int32_t prefix_length;  ///< 节点中所有键值的公共前缀长度
+  char    keys[0];        ///< 下界和上界，各占 attr_length 个字节
+};
+
 /**
  * @brief IndexNode 仅作为数据在内存或磁盘中的表示
  * @ingroup BPlusTree
@@ -280,7 +347,7 @@ public:
 
   /// @brief 存储的键值大小
   virtual int key_size() const;
-  /// @brief 存储的值的大小。内部节点和叶子节点是不一样的，但是这里返回的是叶子节点存储的大小
+  /// @brief 存储的值的大小。内部节点和叶子节点是不一样的，这里根据页面上的节点类型返回
   virtual int value_size() const;
   /// @brief 存储的键值对的大小。值是指叶子节点中存放的数据
   virtual int item_size() const;
@@ -289,6 +356,11 @@ public:
   int     size() const;
   int     max_size() const;
   int     min_size() const;
+  /**
+   * @brief 与相邻节点合并之后最多可以存放多少个元素
+   * @details 开启前缀压缩时，合并后的键值范围变大，公共前缀可能变短，能够存放的元素也会变少
+   */
+  int     max_size_after_merge(const IndexNodeHandler &other) const;
   RC      set_parent_page_num(PageNum page_num);
   PageNum parent_page_num() const;
   PageNum page_num() const;
@@ -312,22 +384,98 @@ public:
 
   RC recover_insert_items(int index, const char *items, int num);
   RC recover_remove_items(int index, int num);
+  /**
+   * @brief 恢复节点的键值范围
+   * @param fences 格式与 IndexNodeFences 一致，包含上下界
+   */
+  RC recover_set_fences(const char *fences);
+
+  /// @brief 是否开启了键值前缀压缩
+  bool prefix_compressed() const { return header_.prefix_compression != 0; }
+  /// @brief 节点中所有键值的公共前缀长度。没有开启前缀压缩时总是0
+  int  prefix_length() const;
+  /// @brief 节点键值范围的下界(用户键值)。空指针表示负无穷
+  const char *low_fence() const;
+  /// @brief 节点键值范围的上界(用户键值)。空指针表示正无穷
+  const char *high_fence() const;
+
+  /**
+   * @brief 修改节点的键值范围，并按照新的公共前缀重新存放所有元素
+   * @details 没有开启前缀压缩时什么都不做。
+   * 调用者需要保证当前所有的元素都在新的范围内，并且按照新的前缀长度可以放得下。
+   * @param low 下界，空指针表示负无穷
+   * @param high 上界，空指针表示正无穷
+   */
+  RC set_fences(const char *low, const char *high);
+
+  /**
+   * @brief 比较指定的键值与节点中某个位置的键值
+   * @return 与 KeyComparator 的结果一致
+   */
+  int compare_key_at(const KeyComparator &comparator, const char *key, int index) const;
+
+  /**
+   * @brief 获取连续的一些元素，每个元素是完整的键值加上值
+   * @details 没有压缩时直接返回页面中的数据，否则解压到 buffer 中
+   */
+  span<const char> items_at(int index, int num, vector<char> &buffer) const;
+
+  /**
+   * @brief 计算一个节点最多可以存放多少个元素
+   * @param prefix_length 开启前缀压缩时元素中不需要存放的前缀长度
+   */
+  static int node_capacity(const IndexFileHeader &header, bool leaf, int prefix_length);
+  /// @brief 两个用户键值的公共前缀长度。任意一个是空指针(表示无穷)时返回0
+  static int common_prefix_length(const char *key1, const char *key2, int length);
 
 protected:
+  /**
+   * @brief 节点数据区的开始位置
+   * @note 这并不是一个纯虚函数，是为了可以直接使用 IndexNodeHandler 类，这时根据页面上的节点类型计算。
+   */
+  virtual char *node_array() const;
+
+  IndexNodeFences *fences() const { return reinterpret_cast<IndexNodeFences *>(node_array()); }
+  int              fences_size() const;
+  /// @brief 每个元素实际占用的空间，即去掉公共前缀之后的大小
+  int              slot_size() const { return item_size() - prefix_length(); }
+
   /**
    * @brief 获取指定元素的开始内存位置
-   * @note 这并不是一个纯虚函数，是为了可以直接使用 IndexNodeHandler 类。
-   * 但是使用这个类时，注意不能使用与这个函数相关的函数。
+   * @details 开启前缀压缩时，元素中存放的是键值去掉公共前缀之后的部分
    */
-  virtual char *__item_at(int index) const { return nullptr; }
-  char         *__key_at(int index) const { return __item_at(index); }
-  char         *__value_at(int index) const { return __item_at(index) + key_size(); };
+  char *__item_at(int index) const;
+  /**
+   * @brief 获取指定位置的完整键值
+   * @details 压缩的键值会解压到 key_buffer_ 中，在下一次调用之前有效
+   */
+  char *__key_at(int index) const;
+  char *__value_at(int index) const;
+
+  /// @brief 检查节点中的键值都在节点的范围内
+  bool validate_fences() const;
+
+  /**
+   * @brief 在 [first, size) 中查找第一个不小于 key 的位置
+   * @details 开启前缀压缩时，先比较一次公共前缀，之后只比较元素中存放的后缀
+   */
+  int lower_bound(const KeyComparator &comparator, const char *key, int first, bool *found) const;
+
+private:
+  /// @brief 按照指定的公共前缀长度计算元素的位置。只读一次前缀长度，避免乐观读时前后不一致
+  char *slot_at(int index, int prefix_length) const;
+  /// @brief 把压缩存放的元素解压到 dest
+  void decode_items(int index, int num, char *dest) const;
+  /// @brief 把完整的元素压缩存放到指定位置
+  void encode_items(int index, const char *items, int num);
 
 protected:
   BplusTreeMiniTransaction &mtr_;
   const IndexFileHeader    &header_;
   Frame                    *frame_ = nullptr;
   IndexNode                *node_  = nullptr;
+
+  mutable vector<char> key_buffer_;  ///< 解压键值使用的内存
 };
 
 /**
@@ -369,13 +517,17 @@ public:
   friend string to_string(const LeafIndexNodeHandler &handler, const KeyPrinter &printer);
 
 protected:
-  char *__item_at(int index) const override;
+  char *node_array() const override { return leaf_node_->array; }
+  int   value_size() const override;
 
   RC append(const char *items, int num);
   RC append(const char *item);
   RC preappend(const char *item);
 
 private:
+  friend class BplusTreeScanner;
+  friend class BplusTreeBulkLoader;
+
   LeafIndexNode *leaf_node_ = nullptr;
 };
 
@@ -429,13 +581,15 @@ public:
   friend string to_string(const InternalIndexNodeHandler &handler, const KeyPrinter &printer);
 
 private:
+  friend class BplusTreeBulkLoader;
+
   RC insert_items(int index, const char *items, int num);
   RC append(const char *items, int num);
   RC append(const char *item);
   RC preappend(const char *item);
 
 private:
-  char *__item_at(int index) const override;
+  char *node_array() const override { return internal_node_->array; }
 
   int value_size() const override;
   int item_size() const override;
@@ -460,11 +614,12 @@ public:
    * @param attr_length 属性长度
    * @param internal_max_size 内部节点最大大小
    * @param leaf_max_size 叶子节点最大大小
+   * @param prefix_compression 是否开启键值前缀压缩。只对 CHARS 类型生效
    */
   RC create(LogHandler &log_handler, BufferPoolManager &bpm, const char *file_name, AttrType attr_type, int attr_length,
-      int internal_max_size = -1, int leaf_max_size = -1);
+      int internal_max_size = -1, int leaf_max_size = -1, bool prefix_compression = false);
   RC create(LogHandler &log_handler, DiskBufferPool &buffer_pool, AttrType attr_type, int attr_length,
-      int internal_max_size = -1, int leaf_max_size = -1);
+      int internal_max_size = -1, int leaf_max_size = -1, bool prefix_compression = false);
 
   /**
    * @brief 打开一个B+树
@@ -570,6 +725,23 @@ protected:
   RC find_leaf_internal(BplusTreeMiniTransaction &mtr, BplusTreeOperationType op,
       const function<PageNum(InternalIndexNodeHandler &)> &child_page_getter, Frame *&frame);
 
+  /**
+   * @brief 乐观地查找叶子节点，查找的过程中不加任何latch
+   * @details 只pin住页面，每读完一个节点都校验它的版本号，发现节点被修改过就返回 LOCKED_NEED_WAIT，
+   * 由调用者释放pin之后重试。找到的叶子节点也是pin住的，调用者读完叶子节点中的数据后，
+   * 还需要使用返回的版本号再校验一次。
+   * @param key 查找的键值。如果是空指针，就查找最左边的叶子节点
+   * @param[out] frame 返回找到的叶子节点
+   * @param[out] version 叶子节点的版本号
+   */
+  RC optimistic_find_leaf(BplusTreeMiniTransaction &mtr, const char *key, Frame *&frame, uint64_t &version);
+
+  /**
+   * @brief 不加锁读取根节点的页号
+   * @details 根节点只在加着 root_lock_ 和旧根节点写锁的情况下修改，乐观读的读者通过版本号校验
+   */
+  PageNum root_page_num() { return atomic_ref<PageNum>(file_header_.root_page).load(memory_order_acquire); }
+
   /**
    * @brief 使用crabing protocol 获取页面
    */
@@ -654,6 +826,7 @@ protected:
 
 private:
   friend class BplusTreeScanner;
+  friend class BplusTreeBulkLoader;
   friend class BplusTreeTester;
 };
 
@@ -675,22 +848,28 @@ public:
    * @param right_user_key 扫描范围的右边界。如果是null，则没有右边界
    * @param right_len right_user_key 的内存大小(只有在变长字段中才会关注)
    * @param right_inclusive 右边界的值是否包含在内
+   * @param fetch_key 是否同时拷贝用户键值，之后可以使用返回键值的 next_entry
    * TODO 重构参数表示方法
    */
   RC open(const char *left_user_key, int left_len, bool left_inclusive, const char *right_user_key, int right_len,
-      bool right_inclusive);
+      bool right_inclusive, bool fetch_key = false);
 
   /**
    * @brief 获取下一条记录
    *
    * @param rid 当前默认所有值都是RID类型。对B+树来说并不是一个好的抽象
    * @return RC RECORD_EOF 表示遍历完成
-   * TODO 需要增加返回 key 的接口
-   * @warning 不要在遍历时删除数据。删除数据会导致遍历器失效。
-   * 当前默认的走索引删除的逻辑就是这样做的，所以删除逻辑有BUG。
+   * @details 扫描器每次把一个叶子节点上满足条件的数据都拷贝出来，拷贝完成后就不再持有叶子节点的latch和pin，
+   * 所以遍历时修改数据不会被扫描器阻塞，但是已经拷贝过的数据不会再反映之后的修改。
    */
   RC next_entry(RID &rid);
 
+  /**
+   * @brief 获取下一条记录以及它的用户键值
+   * @details 打开扫描器时需要指定 fetch_key。user_key 指向扫描器内部的内存，在下一次调用之前有效
+   */
+  RC next_entry(RID &rid, const char *&user_key);
+
   /**
    * @brief 关闭当前扫描器
    * @details 可以不调用，在析构函数时会自动执行
@@ -703,23 +882,50 @@ private:
    */
   RC fix_user_key(const char *user_key, int key_len, bool want_greater, char **fixed_key, bool *should_inclusive);
 
-  void fetch_item(RID &rid);
+  /**
+   * @brief 从 resume_key_ 开始查找叶子节点，并拷贝叶子节点上的数据
+   * @details 先尝试乐观读，连续失败多次后退回到加读锁的方式
+   */
+  RC fetch_leaf_by_key();
+
+  /**
+   * @brief 沿着叶子节点的链表拷贝下一个叶子节点上的数据
+   * @details 如果上一个叶子节点在拷贝之后被修改过，就无法确定下一个节点，这时从 resume_key_ 重新查找
+   */
+  RC fetch_next_leaf();
 
   /**
-   * @brief 判断是否到了扫描的结束位置
+   * @brief 拷贝叶子节点上在扫描范围内的数据
+   * @param frame 叶子节点
+   * @param version 读取叶子节点之前获取的版本号
+   * @param optimistic 是否乐观读。乐观读需要在读完之后校验版本号，加着读锁就不需要
+   * @param from_resume_key 从 resume_key_ 的位置开始拷贝，否则从第一个元素开始
    */
-  bool touch_end();
+  RC copy_leaf(Frame *frame, uint64_t version, bool optimistic, bool from_resume_key);
 
 private:
+  /// 乐观读连续失败多少次之后，改成加读锁
+  static constexpr int MAX_OPTIMISTIC_RETRY = 8;
+
   bool                     inited_ = false;
   BplusTreeHandler        &tree_handler_;
   BplusTreeMiniTransaction mtr_;
 
-  /// 使用左右叶子节点和位置来表示扫描的起始位置和终止位置
-  /// 起始位置和终止位置都是有效的数据
-  Frame *current_frame_ = nullptr;
+  vector<RID> rids_;           /// 从当前叶子节点中拷贝出来的数据
+  size_t      rid_index_ = 0;  /// 下一个要返回的数据
+
+  bool         fetch_key_ = false;  /// 是否拷贝用户键值
+  vector<char> user_keys_;          /// 与 rids_ 对应的用户键值
+
+  PageNum  leaf_page_    = BP_INVALID_PAGE_NUM;  /// 最近拷贝的叶子节点
+  uint64_t leaf_version_ = 0;                    /// 拷贝时叶子节点的版本号
+  PageNum  next_page_    = BP_INVALID_PAGE_NUM;  /// 下一个叶子节点
+  bool     reach_end_    = true;                 /// 已经拷贝到了扫描范围的结尾
+
+  /// 下一次从这个键值之后的位置开始拷贝，为空表示从最左边开始
+  vector<char> resume_key_;
+  bool         resume_inclusive_ = false;  /// 是否包含 resume_key_ 本身。只有扫描的左边界是包含的
+  vector<char> key_buffer_;  /// 拷贝时临时存放最后一个键值，校验成功后再与 resume_key_ 交换
 
   common::MemPoolItem::item_unique_ptr right_key_;
-  int                                  iter_index_    = -1;
-  bool                                 first_emitted_ = false;
 };
@@ -0,0 +1,519 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/index/bplus_tree_bulk_loader.h"
+#include "common/lang/algorithm.h"
+#include "common/lang/filesystem.h"
+#include "common/lang/fstream.h"
+#include "common/lang/ios.h"
+#include "common/lang/memory.h"
+#include "common/lang/queue.h"
+#include "common/log/log.h"
+#include "storage/index/bplus_tree.h"
+#include "storage/index/bplus_tree_log.h"
+
+using namespace common;
+
+namespace {
+
+/**
+ * @brief 顺序读取临时文件中的一个排好序的数据段
+ */
+class SortRunReader final
+{
+public:
+  /// 每次从文件中读取的数据大小
+  static constexpr int READ_BUFFER_SIZE = 64 * 1024;
+
+public:
+  RC open(const string &file_name, int64_t offset, int64_t count, int item_size)
+  {
+    in_.open(file_name, ios::binary | ios::in);
+    if (!in_.is_open()) {
+      LOG_WARN("failed to open sort file. file=%s", file_name.c_str());
+      return RC::IOERR_OPEN;
+    }
+    in_.seekg(offset);
+
+    item_size_  = item_size;
+    remaining_  = count;
+    buffer_num_ = max(1, READ_BUFFER_SIZE / item_size);
+    buffer_.resize(static_cast<size_t>(buffer_num_) * item_size);
+    return fill();
+  }
+
+  /// @brief 当前数据。读完之后返回nullptr
+  const char *current() const { return position_ < item_num_ ? buffer_.data() + position_ * item_size_ : nullptr; }
+
+  RC next()
+  {
+    position_++;
+    if (position_ < item_num_) {
+      return RC::SUCCESS;
+    }
+    return fill();
+  }
+
+private:
+  RC fill()
+  {
+    position_ = 0;
+    item_num_ = static_cast<int>(min<int64_t>(remaining_, buffer_num_));
+    if (item_num_ == 0) {
+      return RC::SUCCESS;
+    }
+
+    in_.read(buffer_.data(), static_cast<streamsize>(item_num_) * item_size_);
+    if (!in_.good()) {
+      LOG_WARN("failed to read sort file. item num=%d", item_num_);
+      return RC::IOERR_READ;
+    }
+    remaining_ -= item_num_;
+    return RC::SUCCESS;
+  }
+
+private:
+  ifstream     in_;
+  vector<char> buffer_;
+  int          item_size_  = 0;
+  int          buffer_num_ = 0;
+  int          item_num_   = 0;
+  int          position_   = 0;
+  int64_t      remaining_  = 0;
+};
+
+}  // namespace
+
+BplusTreeBulkLoader::BplusTreeBulkLoader(BplusTreeHandler &tree_handler) : tree_handler_(tree_handler) {}
+
+BplusTreeBulkLoader::~BplusTreeBulkLoader()
+{
+  if (!runs_.empty()) {
+    error_code ec;
+    filesystem::remove(sort_file_, ec);
+  }
+}
+
+RC BplusTreeBulkLoader::init(const char *sort_file, bool unique, double fill_factor, int64_t memory_limit)
+{
+  if (inited_) {
+    LOG_WARN("bulk loader has been inited");
+    return RC::INTERNAL;
+  }
+
+  if (!tree_handler_.is_empty()) {
+    LOG_WARN("cannot bulk load into a non-empty bplus tree");
+    return RC::INVALID_ARGUMENT;
+  }
+
+  if (fill_factor < 0.5 || fill_factor > 1.0) {
+    LOG_WARN("invalid fill factor %lf, use default %lf", fill_factor, DEFAULT_FILL_FACTOR);
+    fill_factor = DEFAULT_FILL_FACTOR;
+  }
+
+  const IndexFileHeader &header = tree_handler_.file_header_;
+
+  sort_file_    = sort_file;
+  unique_       = unique;
+  fill_factor_  = fill_factor;
+  attr_length_  = header.attr_length;
+  key_length_   = header.key_length;
+  item_size_    = header.key_length + static_cast<int>(sizeof(RID));
+  memory_limit_ = max<int64_t>(memory_limit, item_size_);
+
+  // 清理上次没有删除的临时文件
+  error_code ec;
+  filesystem::remove(sort_file_, ec);
+
+  inited_ = true;
+  LOG_INFO("bulk loader inited. sort file=%s, unique=%d, fill factor=%lf, memory limit=%ld",
+           sort_file_.c_str(), unique_, fill_factor_, memory_limit_);
+  return RC::SUCCESS;
+}
+
+RC BplusTreeBulkLoader::add_entry(const char *user_key, const RID &rid)
+{
+  if (!inited_) {
+    LOG_WARN("bulk loader is not inited");
+    return RC::INTERNAL;
+  }
+
+  if (!buffer_.empty() && static_cast<int64_t>(buffer_.size()) + item_size_ > memory_limit_) {
+    RC rc = spill_buffer();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  // 与叶子节点的元素格式一致：用户键值 + RID 组成键值，值是RID
+  const size_t offset = buffer_.size();
+  buffer_.resize(offset + item_size_);
+  char *item = buffer_.data() + offset;
+  memcpy(item, user_key, attr_length_);
+  memcpy(item + attr_length_, &rid, sizeof(rid));
+  memcpy(item + key_length_, &rid, sizeof(rid));
+  entry_count_++;
+  return RC::SUCCESS;
+}
+
+void BplusTreeBulkLoader::sort_buffer(vector<const char *> &items) const
+{
+  const int64_t item_num = static_cast<int64_t>(buffer_.size()) / item_size_;
+  items.resize(item_num);
+  for (int64_t i = 0; i < item_num; i++) {
+    items[i] = buffer_.data() + i * item_size_;
+  }
+
+  const KeyComparator &comparator = tree_handler_.key_comparator_;
+  sort(items.begin(), items.end(), [&comparator](const char *a, const char *b) { return comparator(a, b) < 0; });
+}
+
+RC BplusTreeBulkLoader::spill_buffer()
+{
+  vector<const char *> items;
+  sort_buffer(items);
+
+  ofstream out(sort_file_, ios::binary | ios::out | ios::app);
+  if (!out.is_open()) {
+    LOG_WARN("failed to open sort file. file=%s", sort_file_.c_str());
+    return RC::IOERR_OPEN;
+  }
+
+  SortRun run;
+  run.offset = runs_.empty() ? 0 : runs_.back().offset + runs_.back().count * item_size_;
+  run.count  = static_cast<int64_t>(items.size());
+  for (const char *item : items) {
+    out.write(item, item_size_);
+  }
+  out.close();
+  if (out.fail()) {
+    LOG_WARN("failed to write sort file. file=%s", sort_file_.c_str());
+    return RC::IOERR_WRITE;
+  }
+
+  LOG_INFO("spill a sorted run to file. file=%s, run=%ld, offset=%ld, count=%ld",
+           sort_file_.c_str(), runs_.size(), run.offset, run.count);
+  runs_.push_back(run);
+  buffer_.clear();
+  return RC::SUCCESS;
+}
+
+RC BplusTreeBulkLoader::finish()
+{
+  if (!inited_) {
+    LOG_WARN("bulk loader is not inited");
+    return RC::INTERNAL;
+  }
+
+  RC rc = RC::SUCCESS;
+  if (runs_.empty()) {
+    // 数据都在内存中，不需要外部排序
+    vector<const char *> items;
+    sort_buffer(items);
+
+    size_t index = 0;
+    rc           = build([&items, &index](const char *&item) {
+      item = items[index++];
+      return RC::SUCCESS;
+    });
+  } else {
+    if (!buffer_.empty()) {
+      rc = spill_buffer();
+    }
+    if (OB_SUCC(rc)) {
+      rc = merge_and_build();
+    }
+
+    error_code ec;
+    filesystem::remove(sort_file_, ec);
+    runs_.clear();
+  }
+
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to bulk load bplus tree. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  LOG_INFO("bulk load bplus tree done. entry count=%ld", entry_count_);
+  return rc;
+}
+
+RC BplusTreeBulkLoader::merge_and_build()
+{
+  vector<unique_ptr<SortRunReader>> readers;
+  for (const SortRun &run : runs_) {
+    auto reader = make_unique<SortRunReader>();
+    RC   rc     = reader->open(sort_file_, run.offset, run.count, item_size_);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    readers.push_back(std::move(reader));
+  }
+
+  // 多路归并。堆顶是当前最小的数据段
+  const KeyComparator &comparator = tree_handler_.key_comparator_;
+  auto                 greater    = [&readers, &comparator](size_t a, size_t b) {
+    return comparator(readers[a]->current(), readers[b]->current()) > 0;
+  };
+  priority_queue<size_t, vector<size_t>, decltype(greater)> heap(greater);
+  for (size_t i = 0; i < readers.size(); i++) {
+    if (readers[i]->current() != nullptr) {
+      heap.push(i);
+    }
+  }
+
+  // 上一次返回的数据段需要先前进一步才能继续比较。返回的数据在下一次调用之前都是有效的
+  size_t last = readers.size();
+  return build([&](const char *&item) {
+    if (last < readers.size()) {
+      RC rc = readers[last]->next();
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      if (readers[last]->current() != nullptr) {
+        heap.push(last);
+      }
+    }
+
+    if (heap.empty()) {
+      LOG_WARN("no more items in sorted runs");
+      return RC::INTERNAL;
+    }
+
+    last = heap.top();
+    heap.pop();
+    item = readers[last]->current();
+    return RC::SUCCESS;
+  });
+}
+
+int BplusTreeBulkLoader::fill_size(bool leaf, int prefix_length) const
+{
+  const IndexFileHeader &header   = tree_handler_.file_header_;
+  const int              max_size = min(leaf ? header.leaf_max_size : header.internal_max_size,
+      IndexNodeHandler::node_capacity(header, leaf, prefix_length));
+  const int              fill     = min(max_size, static_cast<int>(max_size * fill_factor_));
+  if (leaf) {
+    return max(1, fill);
+  }
+
+  // 内部节点至少要有两个子节点，否则查找和删除时调整节点都会比较麻烦
+  return max(min(3, max_size), fill);
+}
+
+int BplusTreeBulkLoader::cut_size(
+    bool leaf, const char *items, int item_size, int item_num, bool has_low, bool finished) const
+{
+  if (finished) {
+    const int last_fill = fill_size(leaf, 0);
+    return item_num <= last_fill ? item_num : max(item_num - last_fill, item_num / 2);
+  }
+
+  // 以最新读到的元素作为上界，前面的元素都放到当前节点中。放不下的话，当前节点就少放一个元素，
+  // 前一个元素就是上界。公共前缀只会越来越短，所以前面的元素个数一定是放得下的
+  if (item_num < 2) {
+    return 0;
+  }
+  const char *high          = items + static_cast<size_t>(item_num - 1) * item_size;
+  const int   prefix_length = (has_low && tree_handler_.file_header_.prefix_compression)
+                                  ? IndexNodeHandler::common_prefix_length(items, high, attr_length_)
+                                  : 0;
+  return item_num - 1 > fill_size(leaf, prefix_length) ? item_num - 2 : 0;
+}
+
+RC BplusTreeBulkLoader::build_node(bool leaf, const char *items, int item_num, const char *low, const char *high,
+    PageNum prev_page_num, PageNum &page_num)
+{
+  const IndexFileHeader &header = tree_handler_.file_header_;
+
+  // 每个节点一个mini事务，初始化、填充数据和链接到前一个叶子节点记录在同一条日志中
+  RC rc = RC::SUCCESS;
+  {
+    BplusTreeMiniTransaction mtr(tree_handler_, &rc);
+
+    Frame *frame = nullptr;
+    rc           = mtr.latch_memo().allocate_page(frame);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to allocate page. leaf=%d, rc=%s", leaf, strrc(rc));
+      return rc;
+    }
+
+    // 上下界要在填充数据之前设置，数据是按照上下界的公共前缀压缩存放的
+    // 内部节点的 append 同时会设置所有子节点的父节点
+    if (leaf) {
+      LeafIndexNodeHandler leaf_node(mtr, header, frame);
+      if (OB_FAIL(rc = leaf_node.init_empty()) || OB_FAIL(rc = leaf_node.set_fences(low, high)) ||
+          OB_FAIL(rc = leaf_node.append(items, item_num))) {
+        LOG_WARN("failed to fill leaf page. rc=%s", strrc(rc));
+        return rc;
+      }
+    } else {
+      InternalIndexNodeHandler internal_node(mtr, header, frame);
+      if (OB_FAIL(rc = internal_node.init_empty()) || OB_FAIL(rc = internal_node.set_fences(low, high)) ||
+          OB_FAIL(rc = internal_node.append(items, item_num))) {
+        LOG_WARN("failed to fill internal page. rc=%s", strrc(rc));
+        return rc;
+      }
+    }
+    frame->mark_dirty();
+    page_num = frame->page_num();
+
+    if (prev_page_num != BP_INVALID_PAGE_NUM) {
+      Frame *prev_frame = nullptr;
+      rc                = mtr.latch_memo().get_page(prev_page_num, prev_frame);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to fetch previous leaf page. page num=%d, rc=%s", prev_page_num, strrc(rc));
+        return rc;
+      }
+
+      LeafIndexNodeHandler prev_node(mtr, header, prev_frame);
+      rc = prev_node.set_next_page(page_num);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+      prev_frame->mark_dirty();
+    }
+  }
+  return rc;
+}
+
+RC BplusTreeBulkLoader::build(const ItemSource &source)
+{
+  if (entry_count_ == 0) {
+    return RC::SUCCESS;
+  }
+
+  const int    entry_size = key_length_ + static_cast<int>(sizeof(PageNum));
+  vector<char> entries;
+
+  RC rc = build_leaf_level(source, entries);
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+
+  int level = 1;
+  while (static_cast<int>(entries.size()) > entry_size) {
+    vector<char> upper_entries;
+    rc = build_internal_level(entries, upper_entries);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+    entries.swap(upper_entries);
+    level++;
+  }
+
+  const PageNum root_page_num = *reinterpret_cast<const PageNum *>(entries.data() + key_length_);
+  {
+    BplusTreeMiniTransaction mtr(tree_handler_, &rc);
+    tree_handler_.update_root_page_num_locked(mtr, root_page_num);
+  }
+
+  LOG_INFO("bulk build bplus tree. entry count=%ld, levels=%d, root page=%d", entry_count_, level, root_page_num);
+  return rc;
+}
+
+RC BplusTreeBulkLoader::build_leaf_level(const ItemSource &source, vector<char> &entries)
+{
+  const AttrComparator &comparator = tree_handler_.key_comparator_.attr_comparator();
+
+  // 还没有放到叶子节点中的数据。每次确定一个叶子节点之后，剩下的数据不会超过两个
+  vector<char> items;
+  int          item_num      = 0;
+  int64_t      read_num      = 0;
+  int          leaf_num      = 0;
+  PageNum      prev_page_num = BP_INVALID_PAGE_NUM;
+
+  while (item_num > 0 || read_num < entry_count_) {
+    const bool finished = read_num >= entry_count_;
+    if (!finished) {
+      const char *item = nullptr;
+      RC          rc   = source(item);
+      if (OB_FAIL(rc)) {
+        return rc;
+      }
+
+      if (unique_ && read_num > 0 && comparator(items.data() + items.size() - item_size_, item) == 0) {
+        LOG_WARN("duplicate key found while bulk loading unique index");
+        return RC::RECORD_DUPLICATE_KEY;
+      }
+      items.insert(items.end(), item, item + item_size_);
+      item_num++;
+      read_num++;
+    }
+
+    const int leaf_size = cut_size(true, items.data(), item_size_, item_num, leaf_num > 0, finished);
+    if (leaf_size == 0) {
+      continue;
+    }
+
+    const char *low  = leaf_num > 0 ? items.data() : nullptr;
+    const char *high = leaf_size < item_num ? items.data() + static_cast<size_t>(leaf_size) * item_size_ : nullptr;
+    PageNum     page_num = BP_INVALID_PAGE_NUM;
+    RC          rc       = build_node(true, items.data(), leaf_size, low, high, prev_page_num, page_num);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    entries.insert(entries.end(), items.data(), items.data() + key_length_);
+    entries.insert(entries.end(), reinterpret_cast<const char *>(&page_num),
+        reinterpret_cast<const char *>(&page_num) + sizeof(page_num));
+    items.erase(items.begin(), items.begin() + static_cast<size_t>(leaf_size) * item_size_);
+    item_num -= leaf_size;
+    prev_page_num = page_num;
+    leaf_num++;
+  }
+
+  LOG_INFO("bulk build leaf level. leaf num=%d", leaf_num);
+  return RC::SUCCESS;
+}
+
+RC BplusTreeBulkLoader::build_internal_level(const vector<char> &children, vector<char> &entries)
+{
+  const int     entry_size = key_length_ + static_cast<int>(sizeof(PageNum));
+  const int64_t child_num  = static_cast<int64_t>(children.size()) / entry_size;
+
+  const char *child    = children.data();  // 还没有放到内部节点中的第一个子节点
+  int         item_num = 0;
+  int64_t     read_num = 0;
+  int         node_num = 0;
+
+  while (item_num > 0 || read_num < child_num) {
+    const bool finished = read_num >= child_num;
+    if (!finished) {
+      item_num++;
+      read_num++;
+    }
+
+    const int node_size = cut_size(false, child, entry_size, item_num, node_num > 0, finished);
+    if (node_size == 0) {
+      continue;
+    }
+
+    const char *low      = node_num > 0 ? child : nullptr;
+    const char *high     = node_size < item_num ? child + static_cast<size_t>(node_size) * entry_size : nullptr;
+    PageNum     page_num = BP_INVALID_PAGE_NUM;
+    RC          rc       = build_node(false, child, node_size, low, high, BP_INVALID_PAGE_NUM, page_num);
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+
+    entries.insert(entries.end(), child, child + key_length_);
+    entries.insert(entries.end(), reinterpret_cast<const char *>(&page_num),
+        reinterpret_cast<const char *>(&page_num) + sizeof(page_num));
+    child += static_cast<size_t>(node_size) * entry_size;
+    item_num -= node_size;
+    node_num++;
+  }
+
+  LOG_INFO("bulk build internal level. node num=%d", node_num);
+  return RC::SUCCESS;
+}
@@ -0,0 +1,154 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/sys/rc.h"
+#include "common/types.h"
+#include "common/lang/functional.h"
+#include "common/lang/string.h"
+#include "common/lang/vector.h"
+#include "storage/record/record.h"
+
+class BplusTreeHandler;
+
+/**
+ * @brief 自底向上批量构建B+树
+ * @ingroup BPlusTree
+ * @details 在已经有数据的表上创建索引时，逐条调用 insert_entry 的话，每条记录都要从根节点查找到叶子节点，
+ * 加锁、分裂页面，并且每次分裂都会记录日志。
+ * 批量构建时，先收集所有的 (key, RID) 并排序，内存放不下时把排好序的数据分批写到临时文件中，
+ * 最后做多路归并（外部排序）。排好序的数据按照填充因子依次写满叶子节点，再逐层向上构建内部节点。
+ * 每个页面构建完成后作为一个B+树的mini事务提交，因此日志是按照页面粒度记录的。
+ * @note 只能在一棵空的B+树上使用，并且构建过程中不能有其它线程访问这棵树。
+ */
+class BplusTreeBulkLoader final
+{
+public:
+  /// 默认的填充因子。给后续插入预留一些空间，避免构建完成后马上分裂
+  static constexpr double  DEFAULT_FILL_FACTOR  = 0.9;
+  /// 默认的排序内存大小
+  static constexpr int64_t DEFAULT_MEMORY_LIMIT = 64LL * 1024 * 1024;
+
+public:
+  explicit BplusTreeBulkLoader(BplusTreeHandler &tree_handler);
+  ~BplusTreeBulkLoader();
+
+  /**
+   * @brief 初始化
+   * @param sort_file 外部排序使用的临时文件。构建完成后会删除
+   * @param unique 是否唯一索引。唯一索引遇到重复的键值时返回 RECORD_DUPLICATE_KEY
+   * @param fill_factor 页面的填充因子，取值范围 [0.5, 1]
+   * @param memory_limit 排序可以使用的内存大小，超过之后数据会写到临时文件中
+   */
+  RC init(const char *sort_file, bool unique, double fill_factor = DEFAULT_FILL_FACTOR,
+      int64_t memory_limit = DEFAULT_MEMORY_LIMIT);
+
+  /**
+   * @brief 添加一条索引数据
+   * @param user_key 用户键值，长度与索引的属性长度一致
+   */
+  RC add_entry(const char *user_key, const RID &rid);
+
+  /**
+   * @brief 排序并构建B+树
+   */
+  RC finish();
+
+  /// @brief 已经添加的索引数据条数
+  int64_t entry_count() const { return entry_count_; }
+
+private:
+  /**
+   * @brief 外部排序中一个排好序的数据段
+   */
+  struct SortRun
+  {
+    int64_t offset = 0;  ///< 在临时文件中的偏移
+    int64_t count  = 0;  ///< 数据条数
+  };
+
+  /// @brief 按照顺序返回下一条数据的函数
+  using ItemSource = function<RC(const char *&item)>;
+
+  /// @brief 把内存中的数据排序，返回每条数据的地址
+  void sort_buffer(vector<const char *> &items) const;
+  /// @brief 把内存中的数据排序后写到临时文件中
+  RC spill_buffer();
+
+  /// @brief 从多个排好序的数据段中归并数据并构建B+树
+  RC merge_and_build();
+
+  /**
+   * @brief 构建所有的叶子节点
+   * @param source 排好序的数据
+   * @param[out] entries 每个叶子节点的第一个键值和页面编号，格式与内部节点的元素一致
+   */
+  RC build_leaf_level(const ItemSource &source, vector<char> &entries);
+  /**
+   * @brief 构建一层内部节点
+   * @param children 下一层节点的第一个键值和页面编号
+   * @param[out] entries 当前层的节点
+   */
+  RC build_internal_level(const vector<char> &children, vector<char> &entries);
+  /// @brief 从叶子节点开始逐层构建，最后更新根节点
+  RC build(const ItemSource &source);
+
+  /**
+   * @brief 按照填充因子计算一个节点放多少个元素
+   * @param leaf 是否叶子节点
+   * @param prefix_length 节点中键值的公共前缀长度。前缀越长，一个节点能放的元素越多
+   */
+  int fill_size(bool leaf, int prefix_length) const;
+
+  /**
+   * @brief 计算当前节点放多少个元素
+   * @details 每读到一个元素调用一次。节点的下界是它的第一个键值（每一层的第一个节点没有下界），
+   * 上界是下一个节点的第一个键值（每一层的最后一个节点没有上界）。启用前缀压缩时，上下界的公共前缀
+   * 决定了节点能放多少元素，而上界要多读一个元素才知道，所以只有发现多放一个元素会超出容量时才能确定。
+   * 最后一个节点放不下剩余的元素时，与前一个节点平分，避免最后一个节点太空。
+   * @param leaf 是否叶子节点
+   * @param items 还没有放到节点中的元素，每个元素都以用户键值开头
+   * @param item_size 元素的大小
+   * @param item_num 元素个数
+   * @param has_low 当前节点是否有下界
+   * @param finished 是否已经没有更多的元素了
+   * @return 当前节点的元素个数，0 表示还要再读取元素才能确定
+   */
+  int cut_size(bool leaf, const char *items, int item_size, int item_num, bool has_low, bool finished) const;
+
+  /**
+   * @brief 分配一个页面并填充数据
+   * @param low 节点的下界，nullptr 表示没有
+   * @param high 节点的上界，nullptr 表示没有
+   * @param prev_page_num 前一个叶子节点，构建叶子节点时用来维护叶子节点链表
+   * @param[out] page_num 新页面的编号
+   */
+  RC build_node(bool leaf, const char *items, int item_num, const char *low, const char *high, PageNum prev_page_num,
+      PageNum &page_num);
+
+private:
+  BplusTreeHandler &tree_handler_;
+
+  string  sort_file_;
+  bool    unique_       = false;
+  double  fill_factor_  = DEFAULT_FILL_FACTOR;
+  int64_t memory_limit_ = DEFAULT_MEMORY_LIMIT;
+
+  int attr_length_ = 0;  ///< 用户键值的长度
+  int key_length_  = 0;  ///< 键值长度，即用户键值加上RID
+  int item_size_   = 0;  ///< 叶子节点中一个元素的大小，即键值加上RID
+
+  vector<char>    buffer_;  ///< 还没有写到临时文件中的数据，格式与叶子节点的元素一致
+  vector<SortRun> runs_;    ///< 已经写到临时文件中的数据段
+
+  int64_t entry_count_ = 0;
+  bool    inited_      = false;
+};
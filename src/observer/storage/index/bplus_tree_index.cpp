@@ -14,10 +14,33 @@ See the Mulan PSL v2 for more details. */
 
 #include "storage/index/bplus_tree_index.h"
 #include <cstring>
+#include "common/conf/ini.h"
 #include "common/log/log.h"
+#include "storage/index/bplus_tree_bulk_loader.h"
+#include "storage/record/record_scanner.h"
 #include "storage/table/table.h"
 #include "storage/db/db.h"
 
+using namespace common;
+
+/// 索引相关的配置都放在配置文件的这个section中
+static const char *INDEX_SECTION = "INDEX";
+
+/**
+ * @brief 从配置文件中读取一个整数类型的索引配置项
+ * @details 配置项不存在或者格式不正确时，返回默认值
+ */
+static int index_int_config(const char *key, int default_value)
+{
+  string value  = get_properties()->get(key, "", INDEX_SECTION);
+  int    result = default_value;
+  if (!value.empty() && !str_to_val(value, result)) {
+    LOG_WARN("invalid index config. key=%s, value=%s, use default %d", key, value.c_str(), default_value);
+    result = default_value;
+  }
+  return result;
+}
+
 BplusTreeIndex::~BplusTreeIndex() noexcept { close(); }
 bool BplusTreeIndex::is_null_key(const char *key_data, int key_len) const
 {
@@ -105,8 +128,11 @@ RC BplusTreeIndex::create(Table *table, const char *file_name, const IndexMeta &
 
   Index::init(index_meta, field_meta);
 
+  const bool prefix_compression = index_int_config("KEY_PREFIX_COMPRESSION", 0) != 0;
+
   BufferPoolManager &bpm = table->db()->buffer_pool_manager();
-  RC rc = index_handler_.create(table->db()->log_handler(), bpm, file_name, field_meta.type(), field_meta.len());
+  RC                 rc  = index_handler_.create(
+      table->db()->log_handler(), bpm, file_name, field_meta.type(), field_meta.len(), -1, -1, prefix_compression);
   if (RC::SUCCESS != rc) {
     LOG_WARN("Failed to create index_handler, file_name:%s, index:%s, field:%s, rc:%s",
         file_name, index_meta.name(), index_meta.field(), strrc(rc));
@@ -249,11 +275,57 @@ RC BplusTreeIndex::delete_entry(const char *record, const RID *rid)
   }
 }
 
-IndexScanner *BplusTreeIndex::create_scanner(
-    const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len, bool right_inclusive)
+RC BplusTreeIndex::bulk_load(RecordScanner &scanner, int &record_count)
+{
+  record_count = 0;
+
+  const double  fill_factor  = index_int_config("BULK_LOAD_FILL_FACTOR", 90) / 100.0;
+  const int64_t memory_limit = static_cast<int64_t>(index_int_config("BULK_LOAD_SORT_MEMORY_MB", 64)) * 1024 * 1024;
+  const string  sort_file    = string(index_handler_.buffer_pool().filename()) + ".sort";
+
+  BplusTreeBulkLoader loader(index_handler_);
+
+  RC rc = loader.init(sort_file.c_str(), index_meta_.is_unique(), fill_factor, memory_limit);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to init bulk loader. index=%s, rc=%s", index_meta_.name(), strrc(rc));
+    return rc;
+  }
+
+  Record record;
+  while (OB_SUCC(rc = scanner.next(record))) {
+    record_count++;
+
+    char *key_data = nullptr;
+    int   key_len  = 0;
+    rc             = build_index(record.data(), key_data, key_len);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("Failed to build index. rc=%d:%s", rc, strrc(rc));
+      return rc;
+    }
+
+    // 与 insert_entry 一致，唯一索引不包含NULL值
+    if (!index_meta_.is_unique() || !is_null_key(key_data, key_len)) {
+      rc = loader.add_entry(key_data, record.rid());
+    }
+    delete[] key_data;
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to scan records while bulk loading index. index=%s, rc=%s", index_meta_.name(), strrc(rc));
+    return rc;
+  }
+
+  return loader.finish();
+}
+
+IndexScanner *BplusTreeIndex::create_scanner(const char *left_key, int left_len, bool left_inclusive,
+    const char *right_key, int right_len, bool right_inclusive, bool fetch_key)
 {
   BplusTreeIndexScanner *index_scanner = new BplusTreeIndexScanner(index_handler_);
-  RC rc = index_scanner->open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive);
+  RC rc = index_scanner->open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive, fetch_key);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to open index scanner. rc=%d:%s", rc, strrc(rc));
     delete index_scanner;
@@ -292,8 +364,11 @@ RC BplusTreeIndex::create(
   LOG_INFO("Creating multi-field index. file_name:%s, index:%s, field_count:%zu, total_key_len:%d, first_field:%s",
       file_name, index_meta.name(), field_metas.size(), total_key_len, field_metas[0]->name());
 
+  const bool prefix_compression = index_int_config("KEY_PREFIX_COMPRESSION", 0) != 0;
+
   BufferPoolManager &bpm = table->db()->buffer_pool_manager();
-  RC                 rc  = index_handler_.create(table->db()->log_handler(), bpm, file_name, key_type, total_key_len);
+  RC                 rc  = index_handler_.create(
+      table->db()->log_handler(), bpm, file_name, key_type, total_key_len, -1, -1, prefix_compression);
   if (RC::SUCCESS != rc) {
     LOG_WARN("Failed to create index_handler, file_name:%s, index:%s, field:%s, rc:%s",
         file_name, index_meta.name(), field_metas[0]->name(), strrc(rc));
@@ -352,14 +427,16 @@ BplusTreeIndexScanner::BplusTreeIndexScanner(BplusTreeHandler &tree_handler) : t
 
 BplusTreeIndexScanner::~BplusTreeIndexScanner() noexcept { tree_scanner_.close(); }
 
-RC BplusTreeIndexScanner::open(
-    const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len, bool right_inclusive)
+RC BplusTreeIndexScanner::open(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+    int right_len, bool right_inclusive, bool fetch_key)
 {
-  return tree_scanner_.open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive);
+  return tree_scanner_.open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive, fetch_key);
 }
 
 RC BplusTreeIndexScanner::next_entry(RID *rid) { return tree_scanner_.next_entry(*rid); }
 
+RC BplusTreeIndexScanner::next_entry(RID *rid, const char *&key) { return tree_scanner_.next_entry(*rid, key); }
+
 RC BplusTreeIndexScanner::destroy()
 {
   delete this;
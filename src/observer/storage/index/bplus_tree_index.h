@@ -17,6 +17,8 @@ See the Mulan PSL v2 for more details. */
 #include "storage/index/bplus_tree.h"
 #include "storage/index/index.h"
 
+class RecordScanner;
+
 /**
  * @brief B+树索引
  * @ingroup Index
@@ -38,11 +40,20 @@ public:
   RC insert_entry(const char *record, const RID *rid) override;
   RC delete_entry(const char *record, const RID *rid) override;
 
+  /**
+   * @brief 使用表中已有的数据批量构建索引
+   * @details 在有数据的表上创建索引时使用。不再逐条插入，而是把所有键值排序后自底向上构建B+树。
+   * 填充因子和排序使用的内存大小在配置文件的 INDEX 部分配置。
+   * @param scanner 表数据的扫描器
+   * @param[out] record_count 扫描到的记录数
+   */
+  RC bulk_load(RecordScanner &scanner, int &record_count);
+
   /**
    * 扫描指定范围的数据
    */
   IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
-      int right_len, bool right_inclusive) override;
+      int right_len, bool right_inclusive, bool fetch_key = false) override;
 
   RC sync() override;
 
@@ -68,10 +79,11 @@ public:
   ~BplusTreeIndexScanner() noexcept override;
 
   RC next_entry(RID *rid) override;
+  RC next_entry(RID *rid, const char *&key) override;
   RC destroy() override;
 
   RC open(const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len,
-      bool right_inclusive);
+      bool right_inclusive, bool fetch_key = false);
 
 private:
   BplusTreeScanner tree_scanner_;
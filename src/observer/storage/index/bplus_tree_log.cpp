@@ -90,6 +90,12 @@ RC BplusTreeLogger::set_parent_page(IndexNodeHandler &node_handler, PageNum page
   return append_log_entry(make_unique<SetParentPageLogEntryHandler>(node_handler.frame(), page_num, old_page_num));
 }
 
+RC BplusTreeLogger::node_set_fences(
+    IndexNodeHandler &node_handler, span<const char> fences, span<const char> old_fences)
+{
+  return append_log_entry(make_unique<NodeSetFencesLogEntryHandler>(node_handler.frame(), fences, old_fences));
+}
+
 RC BplusTreeLogger::append_log_entry(unique_ptr<bplus_tree::LogEntryHandler> entry)
 {
   if (!need_log_) {
@@ -106,17 +112,18 @@ RC BplusTreeLogger::commit()
     return RC::SUCCESS;
   }
 
-  LSN        lsn = 0;
-  Serializer buffer;
+  // 每个线程复用同一块序列化内存，避免每次提交都分配内存。
+  // 日志条目的大小要序列化之后才知道，所以这里先序列化，再直接拷贝到日志缓冲区中
+  static thread_local Serializer buffer;
+  buffer.clear();
   buffer.write_int32(buffer_pool_id_);
 
   for (auto &entry : entries_) {
     entry->serialize(buffer);
   }
 
-  Serializer::BufferType &buffer_data = buffer.data();
-
-  RC rc = log_handler_.append(lsn, LogModule::Id::BPLUS_TREE, std::move(buffer_data));
+  LSN lsn = 0;
+  RC  rc  = log_handler_.append(lsn, LogModule::Id::BPLUS_TREE, span<const char>(buffer.data()));
   if (RC::SUCCESS != rc) {
     LOG_WARN("failed to append log entry. rc=%s", strrc(rc));
     return rc;
@@ -127,6 +127,13 @@ public:
    */
   RC set_parent_page(IndexNodeHandler &node_handler, PageNum page_num, PageNum old_page_num);
 
+  /**
+   * @brief 修改某个页面的上下界
+   * @param fences 新的上下界，即页面数组开头的 IndexNodeFences
+   * @param old_fences 原来的上下界，回滚时使用
+   */
+  RC node_set_fences(IndexNodeHandler &node_handler, span<const char> fences, span<const char> old_fences);
+
   /**
    * @brief 提交。表示整个操作成功
    */
@@ -34,6 +34,7 @@ string LogOperation::to_string() const
     case Type::INTERNAL_UPDATE_KEY: ss << "INTERNAL_UPDATE_KEY"; break;
     case Type::NODE_INSERT: ss << "NODE_INSERT"; break;
     case Type::NODE_REMOVE: ss << "NODE_REMOVE"; break;
+    case Type::NODE_SET_FENCES: ss << "NODE_SET_FENCES"; break;
     default: ss << "INVALID"; break;
   }
   return ss.str();
@@ -172,6 +173,10 @@ RC LogEntryHandler::from_buffer(
       rc = NormalOperationLogEntryHandler::deserialize(frame, operation, buffer, handler);
     } break;
 
+    case LogOperation::Type::NODE_SET_FENCES: {
+      rc = NodeSetFencesLogEntryHandler::deserialize(frame, buffer, handler);
+    } break;
+
     default: {
       LOG_ERROR("unknown log operation. operation=%d:%s", operation.index(), operation.to_string().c_str());
       return RC::INTERNAL;
@@ -354,6 +359,66 @@ RC NormalOperationLogEntryHandler::redo(BplusTreeMiniTransaction &mtr, BplusTree
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// NodeSetFencesLogEntryHandler
+NodeSetFencesLogEntryHandler::NodeSetFencesLogEntryHandler(
+    Frame *frame, span<const char> fences, span<const char> old_fences)
+    : NodeLogEntryHandler(LogOperation::Type::NODE_SET_FENCES, frame),
+      fences_(fences.begin(), fences.end()),
+      old_fences_(old_fences.begin(), old_fences.end())
+{}
+
+RC NodeSetFencesLogEntryHandler::serialize_body(Serializer &buffer) const
+{
+  int32_t fences_bytes = static_cast<int32_t>(fences_.size());
+  if (buffer.write_int32(fences_bytes) < 0 || buffer.write(fences_) < 0) {
+    return RC::INTERNAL;
+  }
+  return RC::SUCCESS;
+}
+
+string NodeSetFencesLogEntryHandler::to_string() const
+{
+  stringstream ss;
+  ss << LogEntryHandler::to_string() << ", fences_bytes=" << fences_.size();
+  return ss.str();
+}
+
+RC NodeSetFencesLogEntryHandler::deserialize(Frame *frame, Deserializer &buffer, unique_ptr<LogEntryHandler> &handler)
+{
+  int32_t fences_bytes = -1;
+  if (buffer.read_int32(fences_bytes) < 0 || fences_bytes < 0) {
+    return RC::INTERNAL;
+  }
+
+  vector<char> fences(fences_bytes);
+  if (buffer.read(fences) < 0) {
+    return RC::INTERNAL;
+  }
+
+  handler = make_unique<NodeSetFencesLogEntryHandler>(frame, fences, span<const char>());
+  return RC::SUCCESS;
+}
+
+RC NodeSetFencesLogEntryHandler::rollback(BplusTreeMiniTransaction &mtr, BplusTreeHandler &tree_handler)
+{
+  if (nullptr == frame()) {
+    return RC::INTERNAL;
+  }
+  IndexNodeHandler node_handler(mtr, tree_handler.file_header(), frame());
+  return node_handler.recover_set_fences(old_fences_.data());
+}
+
+RC NodeSetFencesLogEntryHandler::redo(BplusTreeMiniTransaction &mtr, BplusTreeHandler &tree_handler)
+{
+  IndexNodeHandler node_handler(mtr, tree_handler.file_header(), frame());
+  if (fences_bytes() != IndexNodeFences::HEADER_SIZE + 2 * tree_handler.file_header().attr_length) {
+    LOG_WARN("invalid fences size. fences bytes=%d, page num=%d", fences_bytes(), page_num());
+    return RC::INTERNAL;
+  }
+  return node_handler.recover_set_fences(fences_.data());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // LeafInitEmptyLogEntryHandler
 LeafInitEmptyLogEntryHandler::LeafInitEmptyLogEntryHandler(Frame *frame)
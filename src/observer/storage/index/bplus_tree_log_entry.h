@@ -50,6 +50,7 @@ public:
     INTERNAL_UPDATE_KEY,       /// 更新内部节点的key
     NODE_INSERT,               /// 在节点中间(也可能是末尾)插入一些元素
     NODE_REMOVE,               /// 在节点中间(也可能是末尾)删除一些元素
+    NODE_SET_FENCES,           /// 设置节点的上下界
 
     MAX_TYPE,
   };
@@ -256,6 +257,34 @@ private:
   vector<char> items_;
 };
 
+/**
+ * @brief 设置节点上下界的日志处理类
+ * @ingroup CLog
+ * @details 上下界决定了节点中键值压缩的前缀长度，修改之后节点中所有的元素都要重新存放。
+ * 日志中只记录新的上下界，重做时根据页面中原来的上下界解压元素。
+ */
+class NodeSetFencesLogEntryHandler : public NodeLogEntryHandler
+{
+public:
+  NodeSetFencesLogEntryHandler(Frame *frame, span<const char> fences, span<const char> old_fences);
+  virtual ~NodeSetFencesLogEntryHandler() = default;
+
+  RC serialize_body(common::Serializer &buffer) const override;
+  RC rollback(BplusTreeMiniTransaction &mtr, BplusTreeHandler &tree_handler) override;
+  RC redo(BplusTreeMiniTransaction &mtr, BplusTreeHandler &tree_handler) override;
+
+  string to_string() const override;
+
+  static RC deserialize(Frame *frame, common::Deserializer &buffer, unique_ptr<LogEntryHandler> &handler);
+
+  const char *fences() const { return fences_.data(); }
+  int32_t     fences_bytes() const { return static_cast<int32_t>(fences_.size()); }
+
+private:
+  vector<char> fences_;
+  vector<char> old_fences_;
+};
+
 /**
  * @brief 叶子节点初始化日志处理类
  * @ingroup CLog
@@ -88,9 +88,10 @@ public:
    * @param right_key 要扫描的右边界
    * @param right_len 右边界的长度
    * @param right_inclusive 是否包含右边界
+   * @param fetch_key 扫描时是否同时返回键值，用于覆盖索引扫描
    */
   virtual IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
-      int right_len, bool right_inclusive) = 0;
+      int right_len, bool right_inclusive, bool fetch_key = false) = 0;
 
   /**
    * @brief 同步索引数据到磁盘
@@ -124,4 +125,10 @@ public:
    */
   virtual RC next_entry(RID *rid) = 0;
   virtual RC destroy()            = 0;
+
+  /**
+   * @brief 遍历元素数据，同时返回键值
+   * @details 创建扫描器时需要指定 fetch_key。键值的格式与插入时使用的键值一致，在下一次调用之前有效
+   */
+  virtual RC next_entry(RID *rid, const char *&key) { return RC::UNSUPPORTED; }
 };
@@ -88,80 +88,59 @@ RC RecordLogHandler::init(
 // data is the column index in page
 RC RecordLogHandler::init_new_page(Frame *frame, PageNum page_num, span<const char> data)
 {
-  const int        log_payload_size = RecordLogHeader::SIZE + data.size();
-  vector<char>     log_payload(log_payload_size);
-  RecordLogHeader *header = reinterpret_cast<RecordLogHeader *>(log_payload.data());
-  header->buffer_pool_id  = buffer_pool_id_;
-  header->operation_type  = RecordOperation(RecordOperation::Type::INIT_PAGE).type_id();
-  header->page_num        = page_num;
-  header->record_size     = record_size_;
-  header->storage_format  = static_cast<int>(storage_format_);
-  header->column_num      = data.size() / sizeof(int);
-  if (data.size() > 0) {
-    memcpy(log_payload.data() + RecordLogHeader::SIZE, data.data(), data.size());
-  }
-
-  LSN lsn = 0;
-  RC  rc  = log_handler_->append(lsn, LogModule::Id::RECORD_MANAGER, std::move(log_payload));
-  if (OB_SUCC(rc) && lsn > 0) {
-    frame->set_lsn(lsn);
-  }
-  return rc;
+  RecordLogHeader header{};
+  header.buffer_pool_id = buffer_pool_id_;
+  header.operation_type = RecordOperation(RecordOperation::Type::INIT_PAGE).type_id();
+  header.page_num       = page_num;
+  header.record_size    = record_size_;
+  header.storage_format = static_cast<int>(storage_format_);
+  header.column_num     = data.size() / sizeof(int);
+  return append_log(frame, header, data);
 }
 
 RC RecordLogHandler::insert_record(Frame *frame, const RID &rid, const char *record)
 {
-  const int        log_payload_size = RecordLogHeader::SIZE + record_size_;
-  vector<char>     log_payload(log_payload_size);
-  RecordLogHeader *header = reinterpret_cast<RecordLogHeader *>(log_payload.data());
-  header->buffer_pool_id  = buffer_pool_id_;
-  header->operation_type  = RecordOperation(RecordOperation::Type::INSERT).type_id();
-  header->page_num        = rid.page_num;
-  header->slot_num        = rid.slot_num;
-  header->storage_format  = static_cast<int>(storage_format_);
-  memcpy(log_payload.data() + RecordLogHeader::SIZE, record, record_size_);
-
-  LSN lsn = 0;
-  RC  rc  = log_handler_->append(lsn, LogModule::Id::RECORD_MANAGER, std::move(log_payload));
-  if (OB_SUCC(rc) && lsn > 0) {
-    frame->set_lsn(lsn);
-  }
-  return rc;
+  RecordLogHeader header{};
+  header.buffer_pool_id = buffer_pool_id_;
+  header.operation_type = RecordOperation(RecordOperation::Type::INSERT).type_id();
+  header.page_num       = rid.page_num;
+  header.slot_num       = rid.slot_num;
+  header.storage_format = static_cast<int>(storage_format_);
+  return append_log(frame, header, span<const char>(record, record_size_));
 }
 
 RC RecordLogHandler::update_record(Frame *frame, const RID &rid, const char *record)
 {
-  const int        log_payload_size = RecordLogHeader::SIZE + record_size_;
-  vector<char>     log_payload(log_payload_size);
-  RecordLogHeader *header = reinterpret_cast<RecordLogHeader *>(log_payload.data());
-  header->buffer_pool_id  = buffer_pool_id_;
-  header->operation_type  = RecordOperation(RecordOperation::Type::UPDATE).type_id();
-  header->page_num        = rid.page_num;
-  header->slot_num        = rid.slot_num;
-  header->storage_format  = static_cast<int>(storage_format_);
-  memcpy(log_payload.data() + RecordLogHeader::SIZE, record, record_size_);
-
-  LSN lsn = 0;
-  RC  rc  = log_handler_->append(lsn, LogModule::Id::RECORD_MANAGER, std::move(log_payload));
-  if (OB_SUCC(rc) && lsn > 0) {
-    frame->set_lsn(lsn);
-  }
-  return rc;
+  RecordLogHeader header{};
+  header.buffer_pool_id = buffer_pool_id_;
+  header.operation_type = RecordOperation(RecordOperation::Type::UPDATE).type_id();
+  header.page_num       = rid.page_num;
+  header.slot_num       = rid.slot_num;
+  header.storage_format = static_cast<int>(storage_format_);
+  return append_log(frame, header, span<const char>(record, record_size_));
 }
 
 RC RecordLogHandler::delete_record(Frame *frame, const RID &rid)
 {
-  RecordLogHeader header;
+  RecordLogHeader header{};
   header.buffer_pool_id = buffer_pool_id_;
   header.operation_type = RecordOperation(RecordOperation::Type::DELETE).type_id();
   header.page_num       = rid.page_num;
   header.slot_num       = rid.slot_num;
   header.storage_format = static_cast<int>(storage_format_);
+  return append_log(frame, header, span<const char>());
+}
+
+RC RecordLogHandler::append_log(Frame *frame, const RecordLogHeader &header, span<const char> data)
+{
+  const int32_t payload_size = RecordLogHeader::SIZE + static_cast<int32_t>(data.size());
 
   LSN lsn = 0;
-  RC  rc  = log_handler_->append(lsn,
-      LogModule::Id::RECORD_MANAGER,
-      span<const char>(reinterpret_cast<const char *>(&header), RecordLogHeader::SIZE));
+  RC  rc  = log_handler_->append(
+      lsn, LogModule::Id::RECORD_MANAGER, payload_size, [&header, &data](LogPayloadWriter &writer) {
+        writer.write(&header, RecordLogHeader::SIZE);
+        writer.write(data);
+      });
   if (OB_SUCC(rc) && lsn > 0) {
     frame->set_lsn(lsn);
   }
@@ -125,6 +125,12 @@ public:
    */
   RC update_record(Frame *frame, const RID &rid, const char *record);
 
+private:
+  /**
+   * @brief 把日志头和数据直接写到日志缓冲区中，成功后更新页帧的LSN
+   */
+  RC append_log(Frame *frame, const RecordLogHeader &header, span<const char> data);
+
 private:
   LogHandler   *log_handler_    = nullptr;
   int32_t       buffer_pool_id_ = -1;
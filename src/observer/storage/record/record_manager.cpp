@@ -945,8 +945,9 @@ RC RecordFileHandler::insert_record(const char *data, int record_size, RID *rid)
   memcpy(new_data.get(), data, record_size);
   bool rewritten = false;   // 标记是否修改了数据
 
-  // 检查每个字段，处理TEXT类型
-  for (int i = 0; i < table_meta_->field_num(); i++) {
+  // 检查每个字段，处理TEXT类型。没有表元数据时(比如单独测试记录管理器)，不需要处理
+  const int field_num = table_meta_ != nullptr ? table_meta_->field_num() : 0;
+  for (int i = 0; i < field_num; i++) {
     const FieldMeta *field = table_meta_->field(i);
     
     if (field->type() != AttrType::TEXTS) {
@@ -1201,7 +1202,8 @@ RC RecordFileHandler::free_text_overflow_pages(const Record &record)
   RC rc = RC::SUCCESS;
   
   // 遍历所有TEXT字段
-  for (int i = 0; i < table_meta_->field_num(); i++) {
+  const int field_num = table_meta_ != nullptr ? table_meta_->field_num() : 0;
+  for (int i = 0; i < field_num; i++) {
     const FieldMeta *field = table_meta_->field(i);
     if (field->type() != AttrType::TEXTS) {
       continue;
@@ -461,7 +461,7 @@ RC HeapTableEngine::create_index(Trx *trx, const FieldMeta *field_meta, const ch
     return rc;
   }
 
-  // 遍历当前的所有数据，插入这个索引
+  // 遍历当前的所有数据，批量构建这个索引
   RecordScanner *scanner = nullptr;
   rc                     = get_record_scanner(scanner, trx, ReadWriteMode::READ_ONLY);
   if (rc != RC::SUCCESS) {
@@ -470,25 +470,17 @@ RC HeapTableEngine::create_index(Trx *trx, const FieldMeta *field_meta, const ch
     return rc;
   }
 
-  Record record;
-  while (OB_SUCC(rc = scanner->next(record))) {
-    rc = index->insert_entry(record.data(), &record.rid());
-    if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to insert record into index while creating index. table=%s, index=%s, rc=%s",
-               table_meta_->name(), index_name, strrc(rc));
-      return rc;
-    }
-  }
-  if (RC::RECORD_EOF == rc) {
-    rc = RC::SUCCESS;
-  } else {
+  int record_count = 0;
+  rc               = index->bulk_load(*scanner, record_count);
+  scanner->close_scan();
+  delete scanner;
+  if (rc != RC::SUCCESS) {
     LOG_WARN("failed to insert record into index while creating index. table=%s, index=%s, rc=%s",
              table_meta_->name(), index_name, strrc(rc));
     return rc;
   }
-  scanner->close_scan();
-  delete scanner;
-  LOG_INFO("inserted all records into new index. table=%s, index=%s", table_meta_->name(), index_name);
+  LOG_INFO("inserted all records into new index. table=%s, index=%s, records=%d",
+           table_meta_->name(), index_name, record_count);
 
   indexes_.push_back(index);
 
@@ -572,28 +564,15 @@ RC HeapTableEngine::create_index(
     return rc;
   }
 
-  Record record;
-  int    record_count = 0;
-  while (OB_SUCC(rc = scanner->next(record))) {
-    rc = index->insert_entry(record.data(), &record.rid());
-    if (rc != RC::SUCCESS) {
-      LOG_ERROR("Failed to insert existing record into new index. table=%s, index=%s, rid=%s, rc=%s", 
-                table_meta_->name(), index_name, record.rid().to_string().c_str(), strrc(rc));
-      scanner->close_scan();
-      delete scanner;
-      delete index;
-      return rc;
-    }
-    record_count++;
-    printf("Indexed record %d: RID=%s\n", record_count, record.rid().to_string().c_str());
-  }
-
+  int record_count = 0;
+  rc               = index->bulk_load(*scanner, record_count);
   scanner->close_scan();
   delete scanner;
 
-  if (rc != RC::RECORD_EOF) {
+  if (rc != RC::SUCCESS) {
     delete index;
-    LOG_ERROR("Failed to scan table for reindexing. table=%s, rc=%s", table_meta_->name(), strrc(rc));
+    LOG_ERROR("Failed to build index for existing records. table=%s, index=%s, rc=%s",
+              table_meta_->name(), index_name, strrc(rc));
     return rc;
   }
 
@@ -98,6 +98,28 @@ LogReplayer *MvccTrxKit::create_log_replayer(Db &db, LogHandler &log_handler)
   return new MvccTrxLogReplayer(db, *this, log_handler);
 }
 
+bool MvccTrxKit::min_active_lsn(LSN &lsn)
+{
+  bool found = false;
+  lock_.lock();
+  for (Trx *trx : trxes_) {
+    LSN start_lsn = static_cast<MvccTrx *>(trx)->start_lsn();
+    if (start_lsn > 0 && (!found || start_lsn < lsn)) {
+      lsn   = start_lsn;
+      found = true;
+    }
+  }
+  lock_.unlock();
+  return found;
+}
+
+void MvccTrxKit::recover_trx_id(int32_t trx_id)
+{
+  int32_t current = current_trx_id_.load();
+  while (current < trx_id && !current_trx_id_.compare_exchange_weak(current, trx_id)) {
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 MvccTrx::MvccTrx(MvccTrxKit &kit, LogHandler &log_handler)
@@ -316,6 +338,8 @@ RC MvccTrx::start_if_need()
 {
   if (!started_) {
     ASSERT(operations_.empty(), "try to start a new trx while operations is not empty");
+    // 事务的日志都在这之后写入。检查点会先取当前LSN再检查活跃事务，这样不会漏掉这个事务的日志
+    start_lsn_.store(log_handler_.current_lsn() + 1);
     trx_id_ = trx_kit_.next_trx_id();
     LOG_DEBUG("current thread change to new trx with %d", trx_id_);
     started_ = true;
@@ -392,6 +416,7 @@ RC MvccTrx::commit_with_trx_id(int32_t commit_xid)
   }
 
   operations_.clear();
+  start_lsn_.store(0);
 
   LOG_TRACE("append trx commit log. trx id=%d, commit_xid=%d, rc=%s", trx_id_, commit_xid, strrc(rc));
   return rc;
@@ -471,6 +496,7 @@ RC MvccTrx::rollback()
   if (!recovering_) {
     rc = log_handler_.rollback(trx_id_);
   }
+  start_lsn_.store(0);
   LOG_TRACE("append trx rollback log. trx id=%d, rc=%s", trx_id_, strrc(rc));
   return rc;
 }
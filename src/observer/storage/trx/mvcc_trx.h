@@ -14,6 +14,7 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "common/lang/atomic.h"
 #include "common/lang/vector.h"
 #include "storage/trx/trx.h"
 #include "storage/trx/mvcc_trx_log.h"
@@ -39,6 +40,10 @@ public:
 
   LogReplayer *create_log_replayer(Db &db, LogHandler &log_handler) override;
 
+  bool    min_active_lsn(LSN &lsn) override;
+  int32_t current_trx_id() const override { return current_trx_id_.load(); }
+  void    recover_trx_id(int32_t trx_id) override;
+
 public:
   int32_t next_trx_id();
 
@@ -95,6 +100,11 @@ public:
 
   int32_t id() const override { return trx_id_; }
 
+  /**
+   * @brief 事务开始时的LSN，这个事务的日志都比它大。事务没有开始时返回0
+   */
+  LSN start_lsn() const { return start_lsn_.load(); }
+
 private:
   RC   commit_with_trx_id(int32_t commit_id);
   void trx_fields(Table *table, Field &begin_xid_field, Field &end_xid_field) const;
@@ -111,5 +121,6 @@ private:
   int32_t           trx_id_     = -1;
   bool              started_    = false;
   bool              recovering_ = false;
+  atomic<LSN>       start_lsn_{0};  ///< 做检查点的线程会读取，参考 MvccTrxKit::min_active_lsn
   OperationSet      operations_;
 };
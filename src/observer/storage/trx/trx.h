@@ -129,6 +129,32 @@ public:
 
   virtual LogReplayer *create_log_replayer(Db &db, LogHandler &log_handler) = 0;
 
+  /**
+   * @brief 活跃事务可能写下的最小的日志LSN
+   * @details 事务回滚或者恢复时需要用到这个事务的所有日志，做检查点时不能删除这些日志。
+   * 没有活跃事务时返回false
+   */
+  virtual bool min_active_lsn(LSN &lsn) { return false; }
+
+  /**
+   * @brief 已经分配出去的最大的事务ID
+   * @details 检查点之前的日志会被删除，重启时就不能再通过回放日志找到最大的事务ID，
+   * 所以做检查点时要把它记录下来
+   */
+  virtual int32_t current_trx_id() const { return 0; }
+
+  /**
+   * @brief 启动时恢复检查点记录的事务ID，后面分配的事务ID都会比它大
+   */
+  virtual void recover_trx_id(int32_t trx_id) {}
+
+  /**
+   * @brief 判断记录是否可见时，是否需要读取记录本身
+   * @details MVCC 把事务的版本信息存放在记录中，只有读到记录才能判断可见性。
+   * 不需要读取记录时，只读的索引扫描可以直接使用索引中的键值，即覆盖索引扫描
+   */
+  virtual bool visibility_needs_record() const { return true; }
+
 public:
   static TrxKit *create(const char *name, Db *db);
 };
@@ -35,6 +35,9 @@ public:
   void destroy_trx(Trx *trx) override;
 
   LogReplayer *create_log_replayer(Db &db, LogHandler &log_handler) override;
+
+  /// 所有记录都是可见的
+  bool visibility_needs_record() const override { return false; }
 };
 
 class VacuousTrx : public Trx
@@ -125,6 +125,54 @@ TEST(test_frame_manager, test_frame_manager_simple_lru)
   frame_manager.cleanup();
 }
 
+TEST(test_frame_manager, test_frame_manager_sharded)
+{
+  BPFrameManager frame_manager("Test");
+  ASSERT_EQ(RC::SUCCESS, frame_manager.init(4 /*pool_num*/, 4 /*shard_num*/));
+  ASSERT_EQ(4, frame_manager.shard_num());
+  ASSERT_EQ(static_cast<size_t>(4 * DEFAULT_ITEM_NUM_PER_POOL), frame_manager.total_frame_num());
+
+  test_get(frame_manager);
+
+  // 页面按照 FrameId::hash() 取模划分分片，一直在同一个分片中分配页面直到分片满了，其它分片依然可以分配
+  const int          buffer_pool_id = 0;
+  std::list<Frame *> used_list;
+  PageNum            full_page_num = -1;
+  for (PageNum page_num = 0; true; page_num += frame_manager.shard_num()) {
+    Frame *frame = frame_manager.alloc(buffer_pool_id, page_num);
+    if (frame == nullptr) {
+      full_page_num = page_num;
+      break;
+    }
+    used_list.push_back(frame);
+  }
+  ASSERT_EQ(used_list.size(), frame_manager.frame_num());
+  Frame *other_frame = frame_manager.alloc(buffer_pool_id, full_page_num + 1);
+  ASSERT_NE(nullptr, other_frame);
+  used_list.push_back(other_frame);
+
+  // 满了的分片中没有可以淘汰的页面
+  auto purger = [](Frame *frame) { return RC::SUCCESS; };
+  ASSERT_EQ(0, frame_manager.purge_frames(buffer_pool_id, full_page_num, 1, purger));
+
+  for (Frame *frame : used_list) {
+    frame->unpin();
+  }
+
+  // 淘汰之后，满了的分片又可以分配页面了
+  ASSERT_EQ(1, frame_manager.purge_frames(buffer_pool_id, full_page_num, 1, purger));
+  Frame *frame = frame_manager.alloc(buffer_pool_id, full_page_num);
+  ASSERT_NE(nullptr, frame);
+  frame->unpin();
+
+  std::list<Frame *> frames = frame_manager.find_list(buffer_pool_id);
+  for (Frame *frame : frames) {
+    frame_manager.free(buffer_pool_id, frame->page_num(), frame);
+  }
+  ASSERT_EQ(0, frame_manager.frame_num());
+  frame_manager.cleanup();
+}
+
 int main(int argc, char **argv)
 {
 
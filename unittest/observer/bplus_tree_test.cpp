@@ -17,11 +17,13 @@ See the Mulan PSL v2 for more details. */
 #include <filesystem>
 
 #include "common/log/log.h"
+#include "common/lang/algorithm.h"
 #include "common/lang/memory.h"
 #include "common/lang/filesystem.h"
 #include "sql/parser/parse_defs.h"
 #include "storage/buffer/disk_buffer_pool.h"
 #include "storage/index/bplus_tree.h"
+#include "storage/index/bplus_tree_bulk_loader.h"
 #include "storage/clog/vacuous_log_handler.h"
 #include "storage/buffer/double_write_buffer.h"
 #include "gtest/gtest.h"
@@ -316,6 +318,56 @@ void test_delete(BplusTreeHandler *handler)
   handler->print_tree();
 }
 
+TEST(test_bplus_tree, test_key_comparator_lower_bound)
+{
+  // 数值类型的查找结果要与逐个使用比较器的结果一致
+  const int item_size = sizeof(int32_t) + 2 * sizeof(RID);
+  for (AttrType type : {AttrType::INTS, AttrType::DATES, AttrType::FLOATS}) {
+    KeyComparator comparator;
+    comparator.init(type, sizeof(int32_t));
+    ASSERT_NE(KeySearchMode::GENERIC, comparator.search_mode());
+
+    for (int size : {0, 1, 7, 8, 9, 31, 33, 70, 400}) {
+      // 每个属性值有两个键值，RID不同
+      vector<char> items(static_cast<size_t>(size) * item_size);
+      for (int i = 0; i < size; i++) {
+        char   *item = items.data() + static_cast<size_t>(i) * item_size;
+        int32_t int_value = i / 2 * 3;
+        float   float_value = static_cast<float>(int_value) / 2;
+        memcpy(item, type == AttrType::FLOATS ? (const char *)&float_value : (const char *)&int_value, sizeof(int32_t));
+        RID rid(1, i % 2);
+        memcpy(item + sizeof(int32_t), &rid, sizeof(rid));
+      }
+
+      for (int k = -1; k <= size * 3 / 2 + 1; k++) {
+        for (SlotNum slot_num : {-1, 0, 1, 2}) {
+          char    key[sizeof(int32_t) + sizeof(RID)];
+          int32_t int_value   = k;
+          float   float_value = static_cast<float>(k) / 2;
+          memcpy(key, type == AttrType::FLOATS ? (const char *)&float_value : (const char *)&int_value, sizeof(int32_t));
+          RID rid(1, slot_num);
+          memcpy(key + sizeof(int32_t), &rid, sizeof(rid));
+
+          int expected = 0;
+          while (expected < size && comparator(items.data() + static_cast<size_t>(expected) * item_size, key) < 0) {
+            expected++;
+          }
+          const bool expected_found =
+              expected < size && comparator(items.data() + static_cast<size_t>(expected) * item_size, key) == 0;
+
+          bool found = false;
+          ASSERT_EQ(expected, comparator.lower_bound(items.data(), item_size, size, key, &found));
+          ASSERT_EQ(expected_found, found);
+        }
+      }
+    }
+  }
+
+  KeyComparator chars_comparator;
+  chars_comparator.init(AttrType::CHARS, sizeof(int32_t));
+  ASSERT_EQ(KeySearchMode::GENERIC, chars_comparator.search_mode());
+}
+
 TEST(test_bplus_tree, test_leaf_index_node_handle)
 {
   filesystem::path test_directory("bplus_tree");
@@ -793,6 +845,246 @@ TEST(test_bplus_tree, test_scanner)
   handler.close();
 }
 
+TEST(test_bplus_tree, test_bulk_load)
+{
+  LoggerFactory::init_default("test.log");
+
+  filesystem::path test_directory("bplus_tree");
+  filesystem::path buffer_pool_file = test_directory / "bulk_load.btree";
+  filesystem::path sort_file        = test_directory / "bulk_load.btree.sort";
+  filesystem::remove_all(test_directory);
+  filesystem::create_directory(test_directory);
+
+  VacuousLogHandler log_handler;
+
+  BufferPoolManager bpm;
+  ASSERT_EQ(RC::SUCCESS, bpm.init(make_unique<VacuousDoubleWriteBuffer>()));
+  ASSERT_EQ(RC::SUCCESS, bpm.create_file(buffer_pool_file.c_str()));
+
+  DiskBufferPool *buffer_pool = nullptr;
+  ASSERT_EQ(RC::SUCCESS, bpm.open_file(log_handler, buffer_pool_file.c_str(), buffer_pool));
+  ASSERT_NE(nullptr, buffer_pool);
+
+  BplusTreeHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(log_handler, *buffer_pool, AttrType::INTS, sizeof(int), ORDER, ORDER));
+
+  // 每个键值有两条记录，乱序加入。排序内存只能放下100条数据，需要外部排序
+  const int   key_num = insert_num;
+  vector<int> keys;
+  for (int i = 0; i < key_num; i++) {
+    keys.push_back(i);
+    keys.push_back(i);
+  }
+  for (size_t i = 0; i < keys.size(); i++) {
+    swap(keys[i], keys[(i * 7919) % keys.size()]);
+  }
+
+  const int           item_size = sizeof(int) + 2 * sizeof(RID);
+  BplusTreeBulkLoader loader(handler);
+  ASSERT_EQ(RC::SUCCESS, loader.init(sort_file.c_str(), false /*unique*/, 0.75, 100 * item_size));
+  for (size_t i = 0; i < keys.size(); i++) {
+    RID rid(keys[i], static_cast<SlotNum>(i));
+    ASSERT_EQ(RC::SUCCESS, loader.add_entry((const char *)&keys[i], rid));
+  }
+  ASSERT_EQ(RC::SUCCESS, loader.finish());
+  ASSERT_FALSE(filesystem::exists(sort_file));
+  ASSERT_TRUE(handler.validate_tree());
+
+  // 所有数据按照顺序出现
+  BplusTreeScanner scanner(handler);
+  ASSERT_EQ(RC::SUCCESS, scanner.open(nullptr, 0, true, nullptr, 0, true));
+  RID rid;
+  int count = 0;
+  while (scanner.next_entry(rid) == RC::SUCCESS) {
+    ASSERT_EQ(count / 2, rid.page_num);
+    count++;
+  }
+  ASSERT_EQ(static_cast<int>(keys.size()), count);
+  scanner.close();
+
+  list<RID> rids;
+  int       key = key_num / 2;
+  ASSERT_EQ(RC::SUCCESS, handler.get_entry((const char *)&key, sizeof(key), rids));
+  ASSERT_EQ(2, static_cast<int>(rids.size()));
+
+  // 构建完成后仍然可以正常的插入和删除
+  for (int i = 0; i < key_num; i += 3) {
+    RID new_rid(i, -1);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry((const char *)&i, &new_rid));
+  }
+  for (size_t i = 0; i < keys.size(); i += 2) {
+    RID old_rid(keys[i], static_cast<SlotNum>(i));
+    ASSERT_EQ(RC::SUCCESS, handler.delete_entry((const char *)&keys[i], &old_rid));
+  }
+  ASSERT_TRUE(handler.validate_tree());
+
+  handler.close();
+
+  // 唯一索引遇到重复的键值时失败
+  filesystem::path unique_file = test_directory / "bulk_load_unique.btree";
+  ASSERT_EQ(RC::SUCCESS, bpm.create_file(unique_file.c_str()));
+  ASSERT_EQ(RC::SUCCESS, bpm.open_file(log_handler, unique_file.c_str(), buffer_pool));
+
+  BplusTreeHandler unique_handler;
+  ASSERT_EQ(RC::SUCCESS, unique_handler.create(log_handler, *buffer_pool, AttrType::INTS, sizeof(int), ORDER, ORDER));
+
+  BplusTreeBulkLoader unique_loader(unique_handler);
+  ASSERT_EQ(RC::SUCCESS, unique_loader.init(sort_file.c_str(), true /*unique*/));
+  for (size_t i = 0; i < keys.size(); i++) {
+    RID rid(keys[i], static_cast<SlotNum>(i));
+    ASSERT_EQ(RC::SUCCESS, unique_loader.add_entry((const char *)&keys[i], rid));
+  }
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, unique_loader.finish());
+  unique_handler.close();
+}
+
+TEST(test_bplus_tree, test_prefix_compression)
+{
+  LoggerFactory::init_default("test.log");
+
+  filesystem::path test_directory("bplus_tree");
+  filesystem::remove_all(test_directory);
+  filesystem::create_directory(test_directory);
+
+  VacuousLogHandler log_handler;
+
+  BufferPoolManager bpm;
+  ASSERT_EQ(RC::SUCCESS, bpm.init(make_unique<VacuousDoubleWriteBuffer>()));
+
+  // 键值分成几组，组内有很长的公共前缀，不同组之间没有公共前缀
+  const int attr_length = 32;
+  const int key_num     = 3000;
+  auto      make_key    = [](int i, char *key) {
+    memset(key, 0, attr_length);
+    snprintf(key, attr_length, "%c/common/key/prefix/%08d", 'a' + i % 3, i);
+  };
+  vector<int> order;
+  for (int i = 0; i < key_num; i++) {
+    order.push_back(i);
+  }
+  for (size_t i = 0; i < order.size(); i++) {
+    swap(order[i], order[(i * 7919) % order.size()]);
+  }
+
+  // 扫描整棵树，键值按照顺序出现，返回记录条数
+  auto scan_all = [&make_key](BplusTreeHandler &handler) {
+    BplusTreeScanner scanner(handler);
+    EXPECT_EQ(RC::SUCCESS, scanner.open(nullptr, 0, true, nullptr, 0, true));
+    char prev_key[attr_length] = {0};
+    char key[attr_length];
+    RID  rid;
+    int  count = 0;
+    while (scanner.next_entry(rid) == RC::SUCCESS) {
+      make_key(rid.page_num, key);
+      EXPECT_LT(memcmp(prev_key, key, attr_length), 0);
+      memcpy(prev_key, key, attr_length);
+      count++;
+    }
+    scanner.close();
+    return count;
+  };
+
+  char key[attr_length];
+  char right_key[attr_length];
+
+  // 节点很小时会频繁的分裂和合并，节点很大时一个节点能放多少元素由公共前缀决定
+  for (int max_size : {ORDER, -1}) {
+    filesystem::path buffer_pool_file = test_directory / ("prefix_" + std::to_string(max_size) + ".btree");
+    ASSERT_EQ(RC::SUCCESS, bpm.create_file(buffer_pool_file.c_str()));
+
+    DiskBufferPool *buffer_pool = nullptr;
+    ASSERT_EQ(RC::SUCCESS, bpm.open_file(log_handler, buffer_pool_file.c_str(), buffer_pool));
+
+    BplusTreeHandler handler;
+    ASSERT_EQ(RC::SUCCESS,
+        handler.create(log_handler, *buffer_pool, AttrType::CHARS, attr_length, max_size, max_size, true));
+    ASSERT_EQ(1, handler.file_header().prefix_compression);
+
+    for (int i = 0; i < key_num; i++) {
+      make_key(order[i], key);
+      RID rid(order[i], 0);
+      ASSERT_EQ(RC::SUCCESS, handler.insert_entry(key, &rid));
+      if (i % 500 == 0) {
+        ASSERT_TRUE(handler.validate_tree());
+      }
+    }
+    ASSERT_TRUE(handler.validate_tree());
+    ASSERT_EQ(key_num, scan_all(handler));
+
+    // 范围扫描只返回一组键值，同时返回的键值是解压之后的完整键值
+    make_key(1, key);
+    make_key(key_num - 2, right_key);
+    BplusTreeScanner scanner(handler);
+    ASSERT_EQ(RC::SUCCESS, scanner.open(key, attr_length, true, right_key, attr_length, true, true /*fetch_key*/));
+    RID         rid;
+    const char *user_key = nullptr;
+    int         count    = 0;
+    while (scanner.next_entry(rid, user_key) == RC::SUCCESS) {
+      ASSERT_EQ(1, rid.page_num % 3);
+      make_key(rid.page_num, key);
+      ASSERT_EQ(0, memcmp(key, user_key, attr_length));
+      count++;
+    }
+    scanner.close();
+    ASSERT_EQ(key_num / 3, count);
+
+    for (int i = 0; i < key_num; i += 2) {
+      make_key(order[i], key);
+      RID rid(order[i], 0);
+      ASSERT_EQ(RC::SUCCESS, handler.delete_entry(key, &rid));
+      if (i % 500 == 0) {
+        ASSERT_TRUE(handler.validate_tree());
+      }
+    }
+    ASSERT_TRUE(handler.validate_tree());
+    ASSERT_EQ(key_num / 2, scan_all(handler));
+
+    for (int i = 1; i < key_num; i += 2) {
+      list<RID> rids;
+      make_key(order[i], key);
+      ASSERT_EQ(RC::SUCCESS, handler.get_entry(key, attr_length, rids));
+      ASSERT_EQ(1, static_cast<int>(rids.size()));
+      ASSERT_EQ(order[i], rids.front().page_num);
+    }
+    handler.close();
+  }
+
+  // 批量构建时按照节点的上下界压缩
+  filesystem::path buffer_pool_file = test_directory / "prefix_bulk_load.btree";
+  filesystem::path sort_file        = test_directory / "prefix_bulk_load.btree.sort";
+  ASSERT_EQ(RC::SUCCESS, bpm.create_file(buffer_pool_file.c_str()));
+
+  DiskBufferPool *buffer_pool = nullptr;
+  ASSERT_EQ(RC::SUCCESS, bpm.open_file(log_handler, buffer_pool_file.c_str(), buffer_pool));
+
+  BplusTreeHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(log_handler, *buffer_pool, AttrType::CHARS, attr_length, -1, -1, true));
+
+  BplusTreeBulkLoader loader(handler);
+  ASSERT_EQ(RC::SUCCESS, loader.init(sort_file.c_str(), true /*unique*/));
+  for (int i = 0; i < key_num; i++) {
+    make_key(order[i], key);
+    ASSERT_EQ(RC::SUCCESS, loader.add_entry(key, RID(order[i], 0)));
+  }
+  ASSERT_EQ(RC::SUCCESS, loader.finish());
+  ASSERT_TRUE(handler.validate_tree());
+  ASSERT_EQ(key_num, scan_all(handler));
+
+  for (int i = 0; i < key_num; i += 2) {
+    make_key(order[i], key);
+    RID rid(order[i], 0);
+    ASSERT_EQ(RC::SUCCESS, handler.delete_entry(key, &rid));
+  }
+  for (int i = 0; i < key_num; i += 4) {
+    make_key(order[i], key);
+    RID rid(order[i], 0);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry(key, &rid));
+  }
+  ASSERT_TRUE(handler.validate_tree());
+  ASSERT_EQ(key_num / 2 + key_num / 4, scan_all(handler));
+  handler.close();
+}
+
 TEST(test_bplus_tree, test_bplus_tree_insert)
 {
   LoggerFactory::init_default("test.log");
@@ -12,7 +12,9 @@ See the Mulan PSL v2 for more details. */
 // Created by wangyunlai on 2024/02/01
 //
 
+#include <chrono>
 #include <filesystem>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "common/log/log.h"
@@ -132,6 +134,294 @@ TEST(BufferPool, create)
   ASSERT_EQ(buffer_pool->id(), buffer_pool2->id());
 }
 
+TEST(DiskBufferPool, flush_dirty_pages)
+{
+  filesystem::path directory("buffer_pool");
+  filesystem::remove_all(directory);
+  filesystem::create_directories(directory);
+
+  filesystem::path buffer_pool_filename = directory / "dirty_pages.bp";
+
+  BufferPoolManager buffer_pool_manager;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.init(make_unique<VacuousDoubleWriteBuffer>()));
+
+  VacuousLogHandler log_handler;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.create_file(buffer_pool_filename.c_str()));
+  DiskBufferPool *buffer_pool = nullptr;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+
+  const int page_num = 10;
+  for (int i = 0; i < page_num; i++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->allocate_page(&frame));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+  ASSERT_EQ(RC::SUCCESS, buffer_pool->flush_all_pages());
+  ASSERT_EQ(0, static_cast<int>(buffer_pool_manager.dirty_page_num()));
+
+  // 页面编号越大，变脏时的LSN越小
+  for (PageNum i = 1; i <= page_num; i++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(i, &frame));
+    frame->set_lsn(100 - i);
+    frame->mark_dirty();
+    frame->set_lsn(200);  // 再次修改页面不会改变它在脏页列表中的位置
+    frame->mark_dirty();
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+  ASSERT_EQ(page_num, static_cast<int>(buffer_pool_manager.dirty_page_num()));
+
+  LSN min_dirty_lsn = 0;
+  ASSERT_TRUE(buffer_pool_manager.min_dirty_lsn(min_dirty_lsn));
+  ASSERT_EQ(100 - page_num, min_dirty_lsn);
+
+  // 先刷新LSN最小的页面
+  ASSERT_EQ(3, buffer_pool_manager.flush_dirty_pages(3));
+  ASSERT_EQ(page_num - 3, static_cast<int>(buffer_pool_manager.dirty_page_num()));
+  ASSERT_TRUE(buffer_pool_manager.min_dirty_lsn(min_dirty_lsn));
+  ASSERT_EQ(100 - (page_num - 3), min_dirty_lsn);
+  for (PageNum i = 1; i <= page_num; i++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(i, &frame));
+    ASSERT_EQ(i <= page_num - 3, frame->dirty());
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+
+  // 释放的页面不再是脏页，但是文件头页面变脏了
+  ASSERT_EQ(RC::SUCCESS, buffer_pool->dispose_page(1));
+  ASSERT_EQ(page_num - 3, static_cast<int>(buffer_pool_manager.dirty_page_num()));
+
+  ASSERT_EQ(page_num - 3, buffer_pool_manager.flush_dirty_pages(page_num));
+  ASSERT_EQ(0, static_cast<int>(buffer_pool_manager.dirty_page_num()));
+  ASSERT_FALSE(buffer_pool_manager.min_dirty_lsn(min_dirty_lsn));
+
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+}
+
+TEST(DiskBufferPool, read_ahead)
+{
+  filesystem::path directory("buffer_pool");
+  filesystem::remove_all(directory);
+  filesystem::create_directories(directory);
+
+  filesystem::path buffer_pool_filename = directory / "read_ahead.bp";
+
+  BufferPoolManager buffer_pool_manager;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.init(make_unique<VacuousDoubleWriteBuffer>()));
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.enable_read_ahead(8, 2));
+
+  VacuousLogHandler log_handler;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.create_file(buffer_pool_filename.c_str()));
+  DiskBufferPool *buffer_pool = nullptr;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+
+  const int page_num = 100;
+  for (int i = 0; i < page_num; i++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->allocate_page(&frame));
+    *reinterpret_cast<PageNum *>(frame->data()) = frame->page_num();
+    frame->mark_dirty();
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+
+  // 重新打开文件，所有页面都不在内存中，顺序扫描会触发预读
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+  BufferPoolIterator iterator;
+  ASSERT_EQ(RC::SUCCESS, iterator.init(*buffer_pool, 1));
+  int count = 0;
+  while (iterator.has_next()) {
+    PageNum page_num = iterator.next();
+    Frame  *frame    = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(page_num, &frame));
+    ASSERT_EQ(page_num, *reinterpret_cast<PageNum *>(frame->data()));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+    count++;
+  }
+  ASSERT_EQ(page_num, count);
+  ASSERT_GT(buffer_pool->read_ahead().hit_count(), page_num / 2);
+  ASSERT_LE(buffer_pool->read_ahead().hit_count(), buffer_pool->read_ahead().read_count());
+
+  // 修改过的页面写回磁盘后，再次顺序读取可以读到新的数据
+  Frame *frame = nullptr;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(1, &frame));
+  *reinterpret_cast<PageNum *>(frame->data()) = 1000;
+  frame->mark_dirty();
+  ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+  for (PageNum i = 1; i <= page_num; i++) {
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(i, &frame));
+    ASSERT_EQ(i == 1 ? 1000 : i, *reinterpret_cast<PageNum *>(frame->data()));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+}
+
+TEST(DiskBufferPool, direct_io)
+{
+  filesystem::path directory("buffer_pool");
+  filesystem::remove_all(directory);
+  filesystem::create_directories(directory);
+
+  filesystem::path buffer_pool_filename = directory / "direct_io.bp";
+  filesystem::path dblwr_filename       = directory / "direct_io.dblwr";
+
+  const int page_num = 100;
+  for (int round = 0; round < 2; round++) {
+    BufferPoolManager buffer_pool_manager(0, 1, "lru", true /*direct_io*/);
+    auto              dblwr_buffer = make_unique<DiskDoubleWriteBuffer>(buffer_pool_manager);
+    ASSERT_EQ(RC::SUCCESS, dblwr_buffer->open_file(dblwr_filename.c_str()));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.init(std::move(dblwr_buffer)));
+
+    VacuousLogHandler log_handler;
+    if (round == 0) {
+      ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.create_file(buffer_pool_filename.c_str()));
+    }
+    DiskBufferPool *buffer_pool = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+
+    for (int i = 0; i < page_num; i++) {
+      Frame *frame = nullptr;
+      if (round == 0) {
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->allocate_page(&frame));
+        *reinterpret_cast<PageNum *>(frame->data()) = frame->page_num();
+        frame->mark_dirty();
+      } else {
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(i + 1, &frame));
+        ASSERT_EQ(i + 1, *reinterpret_cast<PageNum *>(frame->data()));
+      }
+      // 页帧的内存可以直接用于 direct IO
+      ASSERT_EQ(0, reinterpret_cast<uintptr_t>(&frame->page()) % BP_IO_ALIGN);
+      ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+    }
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+  }
+}
+
+TEST(DiskBufferPool, warm_up)
+{
+  filesystem::path directory("buffer_pool");
+  filesystem::remove_all(directory);
+  filesystem::create_directories(directory);
+
+  filesystem::path buffer_pool_filename = directory / "warm_up.bp";
+  filesystem::path dblwr_filename       = directory / "warm_up.dblwr";
+  filesystem::path dump_filename        = directory / "warm_up.dump";
+
+  const int page_num = 100;
+  for (int round = 0; round < 2; round++) {
+    BufferPoolManager buffer_pool_manager;
+    auto              dblwr_buffer = make_unique<DiskDoubleWriteBuffer>(buffer_pool_manager);
+    ASSERT_EQ(RC::SUCCESS, dblwr_buffer->open_file(dblwr_filename.c_str()));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.init(std::move(dblwr_buffer)));
+
+    VacuousLogHandler log_handler;
+    if (round == 0) {
+      ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.create_file(buffer_pool_filename.c_str()));
+    }
+    DiskBufferPool *buffer_pool = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.start_warm_up(dump_filename.c_str(), 3600));
+
+    BPFrameManager &frame_manager = buffer_pool_manager.get_frame_manager();
+    if (round == 0) {
+      ASSERT_EQ(0, buffer_pool_manager.warmer().loaded_page_num());
+      for (int i = 0; i < page_num; i++) {
+        Frame *frame = nullptr;
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->allocate_page(&frame));
+        *reinterpret_cast<PageNum *>(frame->data()) = frame->page_num();
+        frame->mark_dirty();
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+      }
+      // 关闭时保存页面列表
+      buffer_pool_manager.stop_warm_up();
+      ASSERT_TRUE(filesystem::exists(dump_filename));
+    } else {
+      // 启动时已经把上次的页面加载到内存中，访问时全部命中。CONCURRENCY 模式下是在后台加载的
+      for (int i = 0; i < 100 && buffer_pool_manager.warmer().loaded_page_num() < page_num; i++) {
+        this_thread::sleep_for(chrono::milliseconds(100));
+      }
+      ASSERT_EQ(page_num, buffer_pool_manager.warmer().loaded_page_num());
+      const int64_t miss_count = frame_manager.miss_count();
+      for (int i = 0; i < page_num; i++) {
+        Frame *frame = nullptr;
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(i + 1, &frame));
+        ASSERT_EQ(i + 1, *reinterpret_cast<PageNum *>(frame->data()));
+        ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+      }
+      ASSERT_EQ(miss_count, frame_manager.miss_count());
+      buffer_pool_manager.stop_warm_up();
+    }
+    ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+  }
+}
+
+TEST(DiskBufferPool, stats)
+{
+  filesystem::path directory("buffer_pool");
+  filesystem::remove_all(directory);
+  filesystem::create_directories(directory);
+
+  filesystem::path buffer_pool_filename = directory / "stats.bp";
+  filesystem::path dblwr_filename       = directory / "stats.dblwr";
+
+  // 只有一个内存池的页帧，分配更多的页面时需要淘汰
+  BufferPoolManager buffer_pool_manager(DEFAULT_ITEM_NUM_PER_POOL * BP_PAGE_SIZE);
+  auto              dblwr_buffer = make_unique<DiskDoubleWriteBuffer>(buffer_pool_manager);
+  ASSERT_EQ(RC::SUCCESS, dblwr_buffer->open_file(dblwr_filename.c_str()));
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.init(std::move(dblwr_buffer)));
+
+  VacuousLogHandler log_handler;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.create_file(buffer_pool_filename.c_str()));
+  DiskBufferPool *buffer_pool = nullptr;
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.open_file(log_handler, buffer_pool_filename.c_str(), buffer_pool));
+
+  const int page_num = DEFAULT_ITEM_NUM_PER_POOL * 2;
+  for (int i = 0; i < page_num; i++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->allocate_page(&frame));
+    frame->mark_dirty();
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+
+  const BufferPoolStats &stats = buffer_pool->stats();
+  ASSERT_GT(stats.get(BufferPoolStats::Counter::EVICT), 0);
+  ASSERT_GT(stats.get(BufferPoolStats::Counter::WRITE), 0);
+
+  // 最早分配的页面已经被淘汰了，第一次访问需要读文件，第二次访问命中
+  const int64_t read_num = stats.get(BufferPoolStats::Counter::READ);
+  for (int round = 0; round < 2; round++) {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(1, &frame));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  }
+  ASSERT_EQ(read_num + 1, stats.get(BufferPoolStats::Counter::READ));
+  ASSERT_EQ(1, stats.get(BufferPoolStats::Counter::MISS));
+  ASSERT_EQ(1, stats.get(BufferPoolStats::Counter::HIT));
+
+  // 其它线程的计数会在读取时汇总
+  thread counter_thread([&buffer_pool]() {
+    Frame *frame = nullptr;
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->get_this_page(1, &frame));
+    ASSERT_EQ(RC::SUCCESS, buffer_pool->unpin_page(frame));
+  });
+  counter_thread.join();
+  ASSERT_EQ(2, stats.get(BufferPoolStats::Counter::HIT));
+
+  vector<BufferPoolStatus> status_list;
+  buffer_pool_manager.collect_status(status_list);
+  ASSERT_EQ(1, status_list.size());
+  ASSERT_EQ(buffer_pool_filename.string(), status_list[0].file_name);
+  ASSERT_EQ(2, status_list[0].hits);
+  ASSERT_EQ(1, status_list[0].misses);
+  ASSERT_EQ(DEFAULT_ITEM_NUM_PER_POOL, status_list[0].resident_pages);
+  ASSERT_EQ(static_cast<int64_t>(buffer_pool->dirty_pages().size()), status_list[0].dirty_pages);
+
+  ASSERT_EQ(RC::SUCCESS, buffer_pool_manager.close_file(buffer_pool_filename.c_str()));
+}
+
 int main(int argc, char **argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -180,6 +180,41 @@ TEST(DiskLogHandler, multi_thread)
   ASSERT_EQ(RC::SUCCESS, handler.await_termination());
 }
 
+TEST(DiskLogHandler, group_commit)
+{
+  // 多个线程同时提交，每次提交都要等待日志落盘
+  const char *directory = "test_log_handler_group_commit";
+  filesystem::remove_all(directory);
+
+  DiskLogHandler  handler;
+  TestLogReplayer replayer;
+  ASSERT_EQ(RC::SUCCESS, handler.init(directory));
+  ASSERT_EQ(RC::SUCCESS, handler.replay(replayer, 0));
+  ASSERT_EQ(RC::SUCCESS, handler.start());
+
+  const int          times = 2000;
+  ThreadPoolExecutor executor;
+  ASSERT_EQ(0, executor.init("TestGroupCommit", 8, 8, 60 * 1000));
+
+  for (int i = 0; i < times; ++i) {
+    ASSERT_EQ(0, executor.execute([&handler]() -> void {
+      LSN          lsn = 0;
+      vector<char> data(10);
+      ASSERT_EQ(handler.append(lsn, LogModule::Id::TRANSACTION, std::move(data)), RC::SUCCESS);
+      ASSERT_EQ(RC::SUCCESS, handler.wait_lsn(lsn));
+      ASSERT_GE(handler.current_flushed_lsn(), lsn);
+    }));
+  }
+
+  ASSERT_EQ(0, executor.shutdown());
+  ASSERT_EQ(0, executor.await_termination());
+  ASSERT_EQ(handler.current_flushed_lsn(), times);
+  ASSERT_TRUE(handler.waiters_.empty());
+  ASSERT_EQ(RC::SUCCESS, handler.stop());
+  ASSERT_EQ(RC::SUCCESS, handler.await_termination());
+  filesystem::remove_all(directory);
+}
+
 int main(int argc, char **argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,152 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "storage/buffer/frame_replacer.h"
+#include "common/lang/memory.h"
+#include "common/lang/vector.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+class FrameReplacerTest : public testing::Test
+{
+public:
+  void SetUp() override
+  {
+    frames_.resize(FRAME_NUM);
+    for (int i = 0; i < FRAME_NUM; i++) {
+      frames_[i] = make_unique<Frame>();
+      frames_[i]->set_buffer_pool_id(0);
+      frames_[i]->set_page_num(i);
+    }
+  }
+
+  /**
+   * @brief 返回第一个淘汰的页帧
+   */
+  Frame *first_victim(FrameReplacer &replacer)
+  {
+    Frame *victim = nullptr;
+    replacer.foreach_victim([&victim](Frame *frame) {
+      victim = frame;
+      return false;
+    });
+    return victim;
+  }
+
+  /**
+   * @brief 淘汰一个页帧，同时把页帧换成新的页面
+   */
+  Frame *evict_and_load(FrameReplacer &replacer, PageNum page_num)
+  {
+    Frame *victim = first_victim(replacer);
+    replacer.remove(victim);
+    victim->set_page_num(page_num);
+    replacer.insert(victim);
+    return victim;
+  }
+
+protected:
+  static constexpr int      FRAME_NUM = 8;
+  vector<unique_ptr<Frame>> frames_;
+};
+
+TEST_F(FrameReplacerTest, create)
+{
+  FrameReplacer *replacer = nullptr;
+  ASSERT_EQ(RC::SUCCESS, FrameReplacer::create("", FRAME_NUM, replacer));
+  ASSERT_NE(nullptr, dynamic_cast<LruFrameReplacer *>(replacer));
+  delete replacer;
+
+  ASSERT_EQ(RC::SUCCESS, FrameReplacer::create("2Q", FRAME_NUM, replacer));
+  ASSERT_NE(nullptr, dynamic_cast<TwoQueueFrameReplacer *>(replacer));
+  delete replacer;
+
+  ASSERT_EQ(RC::SUCCESS, FrameReplacer::create("clock", FRAME_NUM, replacer));
+  ASSERT_NE(nullptr, dynamic_cast<ClockFrameReplacer *>(replacer));
+  delete replacer;
+
+  ASSERT_EQ(RC::INVALID_ARGUMENT, FrameReplacer::create("unknown", FRAME_NUM, replacer));
+}
+
+TEST_F(FrameReplacerTest, lru)
+{
+  LruFrameReplacer replacer;
+  for (auto &frame : frames_) {
+    replacer.insert(frame.get());
+  }
+
+  ASSERT_EQ(frames_[0].get(), first_victim(replacer));
+  replacer.access(frames_[0].get());
+  ASSERT_EQ(frames_[1].get(), first_victim(replacer));
+
+  replacer.remove(frames_[1].get());
+  ASSERT_EQ(frames_[2].get(), first_victim(replacer));
+
+  int count = 0;
+  replacer.foreach_victim([&count](Frame *) {
+    count++;
+    return true;
+  });
+  ASSERT_EQ(FRAME_NUM - 1, count);
+}
+
+TEST_F(FrameReplacerTest, two_queue_scan_resistant)
+{
+  TwoQueueFrameReplacer replacer(FRAME_NUM);
+
+  // 前两个页面被淘汰后又重新加载，会记录在 A1out 中，再次加载时进入 Am
+  Frame *hot1 = frames_[0].get();
+  Frame *hot2 = frames_[1].get();
+  for (Frame *frame : {hot1, hot2}) {
+    replacer.insert(frame);
+    replacer.remove(frame);
+    replacer.insert(frame);
+  }
+  for (int i = 2; i < FRAME_NUM; i++) {
+    replacer.insert(frames_[i].get());
+  }
+
+  // 扫描大量页面，热点页面不应该被淘汰
+  for (PageNum page_num = 1000; page_num < 1100; page_num++) {
+    Frame *victim = evict_and_load(replacer, page_num);
+    ASSERT_NE(hot1, victim);
+    ASSERT_NE(hot2, victim);
+  }
+}
+
+TEST_F(FrameReplacerTest, clock)
+{
+  ClockFrameReplacer replacer;
+  for (auto &frame : frames_) {
+    replacer.insert(frame.get());
+  }
+
+  // 新插入的页帧都有访问标识，第一圈清除标识，之后按照顺序淘汰
+  ASSERT_EQ(frames_[0].get(), first_victim(replacer));
+
+  // 访问过的页帧会被跳过一次
+  replacer.access(frames_[1].get());
+  ASSERT_EQ(frames_[2].get(), first_victim(replacer));
+
+  replacer.remove(frames_[2].get());
+  int count = 0;
+  replacer.foreach_victim([&count](Frame *) {
+    count++;
+    return true;
+  });
+  ASSERT_GE(count, FRAME_NUM - 1);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,7 @@ See the Mulan PSL v2 for more details. */
 #define protected public
 #include "storage/clog/log_buffer.h"
 #include "storage/clog/log_file.h"
+#include "common/lang/thread.h"
 
 using namespace std;
 using namespace common;
@@ -66,6 +67,146 @@ TEST(LogEntryBuffer, test_append)
   filesystem::remove("test_log_entry_buffer.log");
 }
 
+TEST(LogEntryBuffer, test_concurrent_append)
+{
+  // 多个线程同时追加日志，总的数据量超过缓冲区大小，会绕回到缓冲区开头
+  const char *filename = "test_log_entry_buffer_concurrent.log";
+  filesystem::remove(filename);
+
+  LogEntryBuffer buffer;
+  ASSERT_EQ(RC::SUCCESS, buffer.init(0));
+
+  LogFileWriter writer;
+  ASSERT_EQ(RC::SUCCESS, writer.open(filename, 1000000));
+
+  const int    thread_num        = 4;
+  const int    entry_per_thread  = 100;
+  const size_t payload_size_base = 30 * 1024;
+
+  atomic_bool  appending{true};
+  atomic<int>  flushed_count{0};
+  thread       flusher([&]() {
+    int count = 0;
+    while (appending.load() || buffer.entry_number() > 0) {
+      ASSERT_EQ(RC::SUCCESS, buffer.flush(writer, count));
+      flushed_count += count;
+      if (count == 0) {
+        this_thread::yield();
+      }
+    }
+  });
+
+  vector<thread> threads;
+  for (int t = 0; t < thread_num; t++) {
+    threads.emplace_back([&buffer, t]() {
+      for (int i = 0; i < entry_per_thread; i++) {
+        // 数据大小和内容都与线程编号相关，读取时可以校验
+        vector<char> data(payload_size_base + t, static_cast<char>('a' + t));
+        LSN          lsn = 0;
+        ASSERT_EQ(RC::SUCCESS, buffer.append(lsn, LogModule::Id::BUFFER_POOL, std::move(data)));
+      }
+    });
+  }
+  for (thread &t : threads) {
+    t.join();
+  }
+  appending.store(false);
+  flusher.join();
+  writer.close();
+
+  ASSERT_EQ(thread_num * entry_per_thread, flushed_count.load());
+  ASSERT_EQ(buffer.current_lsn(), buffer.flushed_lsn());
+  ASSERT_EQ(0, buffer.bytes());
+
+  LogFileReader reader;
+  ASSERT_EQ(RC::SUCCESS, reader.open(filename));
+  LSN  expected_lsn = 1;
+  auto callback     = [&expected_lsn](LogEntry &entry) -> RC {
+    EXPECT_EQ(expected_lsn, entry.lsn());
+    expected_lsn++;
+
+    int t = entry.payload_size() - static_cast<int>(payload_size_base);
+    EXPECT_TRUE(t >= 0 && t < thread_num);
+    for (int i = 0; i < entry.payload_size(); i++) {
+      if (entry.data()[i] != static_cast<char>('a' + t)) {
+        return RC::INTERNAL;
+      }
+    }
+    return RC::SUCCESS;
+  };
+  ASSERT_EQ(RC::SUCCESS, reader.iterate(callback));
+  ASSERT_EQ(thread_num * entry_per_thread + 1, expected_lsn);
+  reader.close();
+
+  filesystem::remove(filename);
+}
+
+TEST(LogEntryBuffer, test_append_in_place)
+{
+  // 日志数据直接序列化到缓冲区中，总的数据量超过缓冲区大小，日志头和数据都会有跨越缓冲区末尾的情况
+  const char *filename = "test_log_entry_buffer_in_place.log";
+  filesystem::remove(filename);
+
+  LogEntryBuffer buffer;
+  ASSERT_EQ(RC::SUCCESS, buffer.init(0));
+
+  LogFileWriter writer;
+  ASSERT_EQ(RC::SUCCESS, writer.open(filename, 1000000));
+
+  // 奇数个int32，保证日志的偏移量不是对齐的
+  const int32_t int_num    = 25001;
+  const int     entry_num  = 200;
+  const int32_t size       = int_num * sizeof(int32_t);
+  for (int i = 0; i < entry_num; i++) {
+    LSN lsn = 0;
+    ASSERT_EQ(RC::SUCCESS, buffer.append(lsn, LogModule(LogModule::Id::BUFFER_POOL), size, [i](LogPayloadWriter &writer) {
+      for (int32_t v = 0; v < int_num; v++) {
+        writer.write_int32(i + v);
+      }
+      ASSERT_EQ(-1, writer.write_int32(0));
+    }));
+    ASSERT_EQ(lsn, i + 1);
+
+    int count = 0;
+    ASSERT_EQ(RC::SUCCESS, buffer.flush(writer, count));
+    ASSERT_EQ(1, count);
+  }
+
+  // 写入的数据不够时，剩下的部分补0
+  LSN lsn = 0;
+  ASSERT_EQ(RC::SUCCESS, buffer.append(lsn, LogModule(LogModule::Id::BUFFER_POOL), size, [](LogPayloadWriter &writer) {
+    writer.write_int32(-1);
+  }));
+  int count = 0;
+  ASSERT_EQ(RC::SUCCESS, buffer.flush(writer, count));
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(RC::INVALID_ARGUMENT,
+      buffer.append(lsn, LogModule(LogModule::Id::BUFFER_POOL), -1, [](LogPayloadWriter &) {}));
+  writer.close();
+
+  LogFileReader reader;
+  ASSERT_EQ(RC::SUCCESS, reader.open(filename));
+  LSN  expected_lsn = 1;
+  auto callback     = [&](LogEntry &entry) -> RC {
+    EXPECT_EQ(expected_lsn, entry.lsn());
+    EXPECT_EQ(size, entry.payload_size());
+    const int32_t *values = reinterpret_cast<const int32_t *>(entry.data());
+    for (int32_t v = 0; v < int_num; v++) {
+      int32_t expected = (entry.lsn() <= entry_num) ? static_cast<int32_t>(entry.lsn() - 1 + v) : (v == 0 ? -1 : 0);
+      if (values[v] != expected) {
+        return RC::INTERNAL;
+      }
+    }
+    expected_lsn++;
+    return RC::SUCCESS;
+  };
+  ASSERT_EQ(RC::SUCCESS, reader.iterate(callback));
+  ASSERT_EQ(entry_num + 2, expected_lsn);
+  reader.close();
+
+  filesystem::remove(filename);
+}
+
 int main(int argc, char **argv)
 {
   testing::InitGoogleTest(&argc, argv);
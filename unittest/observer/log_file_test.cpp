@@ -390,6 +390,133 @@ TEST(LogFileManager, next_file)
   filesystem::remove_all(directory);
 }
 
+TEST(LogFileManager, truncate)
+{
+  const char *directory                 = "truncate_log_files";
+  int         max_entry_number_per_file = 1000;
+
+  filesystem::remove_all(directory);
+  ASSERT_TRUE(filesystem::create_directory(directory));
+
+  LogFileManager manager;
+  ASSERT_EQ(RC::SUCCESS, manager.init(directory, max_entry_number_per_file));
+
+  // clog_0 ... clog_3000
+  LogFileWriter writer;
+  for (int i = 0; i < 4; i++) {
+    ASSERT_EQ(RC::SUCCESS, manager.next_file(writer));
+  }
+  writer.close();
+  ASSERT_EQ(4, manager.file_num());
+
+  // 检查点所在的文件要保留
+  int removed_num = 0;
+  ASSERT_EQ(RC::SUCCESS, manager.truncate(999, removed_num));
+  ASSERT_EQ(0, removed_num);
+  ASSERT_EQ(RC::SUCCESS, manager.truncate(1000, removed_num));
+  ASSERT_EQ(1, removed_num);
+  ASSERT_FALSE(filesystem::exists(filesystem::path(directory) / "clog_0.log"));
+
+  ASSERT_EQ(RC::SUCCESS, manager.truncate(2500, removed_num));
+  ASSERT_EQ(1, removed_num);
+
+  vector<string> files;
+  ASSERT_EQ(RC::SUCCESS, manager.list_files(files, 0));
+  ASSERT_EQ(2, files.size());
+
+  // 最后一个文件永远不会删除
+  ASSERT_EQ(RC::SUCCESS, manager.truncate(100000, removed_num));
+  ASSERT_EQ(1, removed_num);
+  ASSERT_EQ(1, manager.file_num());
+  ASSERT_TRUE(filesystem::exists(filesystem::path(directory) / "clog_3000.log"));
+
+  // 重新打开后，新文件接着最后一个文件编号
+  LogFileManager manager2;
+  ASSERT_EQ(RC::SUCCESS, manager2.init(directory, max_entry_number_per_file));
+  ASSERT_EQ(RC::SUCCESS, manager2.next_file(writer));
+  LSN lsn = 0;
+  ASSERT_EQ(RC::SUCCESS, LogFileManager::get_lsn_from_filename(filesystem::path(writer.filename()).filename(), lsn));
+  ASSERT_EQ(4000, lsn);
+
+  writer.close();
+  filesystem::remove_all(directory);
+}
+
+TEST(LogFileManager, recycle)
+{
+  const char   *directory                 = "recycle_log_files";
+  int           max_entry_number_per_file = 10;
+  const int64_t file_size                 = 64 * 1024;
+
+  filesystem::remove_all(directory);
+
+  LogFileManager manager;
+  ASSERT_EQ(RC::SUCCESS, manager.init(directory, max_entry_number_per_file, file_size, 2 /*max_recycled_files*/));
+
+  LogFileWriter writer;
+  ASSERT_EQ(RC::SUCCESS, manager.next_file(writer));
+
+  LogEntry entry;
+  auto     write_entries = [&](LSN begin_lsn, LSN end_lsn) {
+    for (LSN lsn = begin_lsn; lsn < end_lsn; lsn++) {
+      ASSERT_EQ(RC::SUCCESS, entry.init(lsn, LogModule::Id::BUFFER_POOL, vector<char>(100, 'a')));
+      RC rc = writer.write(entry);
+      if (rc == RC::LOG_FILE_FULL) {
+        ASSERT_EQ(RC::SUCCESS, manager.next_file(writer));
+        rc = writer.write(entry);
+      }
+      ASSERT_EQ(RC::SUCCESS, rc);
+    }
+  };
+
+  // clog_0, clog_10, clog_20
+  write_entries(1, 30);
+  ASSERT_EQ(3, manager.file_num());
+  // 新文件预先分配了空间
+  ASSERT_EQ(file_size, filesystem::file_size(filesystem::path(directory) / "clog_0.log"));
+
+  // 检查点之前的文件放到回收池中
+  int removed_num = 0;
+  ASSERT_EQ(RC::SUCCESS, manager.truncate(25, removed_num));
+  ASSERT_EQ(2, removed_num);
+  ASSERT_EQ(1, manager.file_num());
+  ASSERT_EQ(2, manager.recycled_file_num());
+  ASSERT_FALSE(filesystem::exists(filesystem::path(directory) / "clog_0.log"));
+
+  // 下一个文件使用回收池中的文件
+  write_entries(30, 35);
+  writer.close();
+  ASSERT_EQ(2, manager.file_num());
+  ASSERT_EQ(1, manager.recycled_file_num());
+
+  filesystem::path new_file = filesystem::path(directory) / "clog_30.log";
+  ASSERT_EQ(file_size, filesystem::file_size(new_file));
+
+  // 只能读到新写入的日志，文件中残留的老日志和预分配的空间都会被忽略
+  LogFileReader reader;
+  ASSERT_EQ(RC::SUCCESS, reader.open(new_file.c_str()));
+  vector<LSN> lsns;
+  ASSERT_EQ(RC::SUCCESS, reader.iterate([&lsns](LogEntry &entry) -> RC {
+    lsns.push_back(entry.lsn());
+    return RC::SUCCESS;
+  }));
+  reader.close();
+  ASSERT_EQ((vector<LSN>{30, 31, 32, 33, 34}), lsns);
+
+  // 重新打开文件时从最后一条有效日志之后接着写
+  ASSERT_EQ(RC::SUCCESS, writer.open(new_file.c_str(), 39));
+  ASSERT_EQ(34, writer.last_lsn_);
+  writer.close();
+
+  // 重新初始化时能找到回收池中的文件
+  LogFileManager manager2;
+  ASSERT_EQ(RC::SUCCESS, manager2.init(directory, max_entry_number_per_file, file_size, 2));
+  ASSERT_EQ(2, manager2.file_num());
+  ASSERT_EQ(1, manager2.recycled_file_num());
+
+  filesystem::remove_all(directory);
+}
+
 int main(int argc, char **argv)
 {
   testing::InitGoogleTest(&argc, argv);